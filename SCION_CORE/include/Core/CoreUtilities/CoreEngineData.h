@@ -31,6 +31,15 @@ class CoreEngineData
 	void SetScaledHeight( float newHeight );
 
 	inline double GetDeltaTime() const { return m_DeltaTime; }
+
+	/*
+	 * @brief When set to a value greater than zero, UpdateDeltaTime will always use this value
+	 * instead of the measured frame time. Used for deterministic input recording and replay.
+	 */
+	inline void SetFixedDeltaTime( double fixedDeltaTime ) { m_FixedDeltaTime = fixedDeltaTime; }
+	inline double GetFixedDeltaTime() const { return m_FixedDeltaTime; }
+	/* The measured time of the last frame. Unlike GetDeltaTime, this ignores the fixed delta time. */
+	inline double GetFrameTime() const { return m_FrameTime; }
 	inline int WindowWidth() const { return m_WindowWidth; }
 	inline int WindowHeight() const { return m_WindowHeight; }
 
@@ -84,6 +93,8 @@ class CoreEngineData
 
   private:
 	double m_DeltaTime;
+	double m_FixedDeltaTime;
+	double m_FrameTime;
 	float m_ScaledWidth;
 	float m_ScaledHeight;
 	float m_Gravity;
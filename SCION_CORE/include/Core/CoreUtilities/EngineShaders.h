@@ -125,6 +125,54 @@ void main()
 }
 )";
 
+/*
+ * Signed distance field text. Uses the same vertex layout as the font shader.
+ * The atlas stores the distance to the glyph edge, with the edge at 0.5.
+ * The smoothing width comes from the screen space derivative, so text stays sharp at any scale.
+ */
+static const char* sdfFontShaderVert = R"(
+#version 450 core
+
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec4 color;
+layout(location = 2) in vec2 uvs;
+
+uniform mat4 uProjection;
+
+out vec4 vertexColor;
+out vec2 vertexUVs;
+
+void main()
+{
+	gl_Position = uProjection * vec4(position.x, position.y, 0.0, 1.0);
+	vertexColor = color;
+	vertexUVs = uvs;
+}
+)";
+
+static const char* sdfFontShaderFrag = R"(
+#version 450 core
+
+in vec4 vertexColor;
+in vec2 vertexUVs;
+
+uniform sampler2D atlas;
+
+out vec4 finalColor;
+
+void main()
+{
+	float distance = texture(atlas, vertexUVs).r;
+	float smoothing = max(fwidth(distance) * 0.5, 0.001);
+	float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+
+	if (alpha <= 0.0)
+		discard;
+
+	finalColor = vec4(vertexColor.rgb, vertexColor.a * alpha);
+}
+)";
+
 static const char* colorShaderVert = R"(
 #version 450
 
@@ -202,5 +250,101 @@ void main()
 }
 )";
 
+/*
+ * Editor grid shader.
+ * The whole canvas is drawn as a single quad, the checkerboard cell is worked out from the world position.
+ */
+static const char* gridShaderVert = R"(
+#version 450 core
+
+layout (location = 0) in vec2 vertexPosition;
+layout (location = 1) in vec4 vertexColor;
+
+out vec2 worldPosition;
+uniform mat4 uProjection;
+
+void main()
+{
+	gl_Position = uProjection * vec4(vertexPosition, 0.0, 1.0);
+	worldPosition = vertexPosition;
+}
+)";
+
+static const char* gridShaderFrag = R"(
+#version 450 core
+
+in vec2 worldPosition;
+out vec4 color;
+
+// Grid maps use the tile size, iso maps the distance between two cells along each axis.
+uniform vec2 uCellSize;
+// Columns and rows.
+uniform vec2 uGridSize;
+uniform int uIsometric;
+uniform vec4 uEvenColor;
+uniform vec4 uOddColor;
+
+void main()
+{
+	vec2 cell;
+	if (uIsometric == 1)
+	{
+		// Undo the diamond layout, the cell center is at (row - col, row + col) in cell units.
+		vec2 diamond = (worldPosition - uCellSize) / uCellSize;
+		cell = floor(vec2(diamond.y - diamond.x, diamond.y + diamond.x) * 0.5 + 0.5);
+	}
+	else
+	{
+		cell = floor(worldPosition / uCellSize);
+	}
+
+	if (any(lessThan(cell, vec2(0.0))) || any(greaterThanEqual(cell, uGridSize)))
+		discard;
+
+	color = mod(cell.x + cell.y, 2.0) < 0.5 ? uEvenColor : uOddColor;
+}
+)";
+
+/*
+ * Particle shader.
+ * Every particle is an instance of the same unit quad, moved to the particle position and scaled by its size.
+ */
+static const char* particleShaderVert = R"(
+#version 450 core
+
+layout (location = 0) in vec2 aQuadPosition;
+layout (location = 1) in vec2 aTexCoords;
+layout (location = 2) in float aPositionX;
+layout (location = 3) in float aPositionY;
+layout (location = 4) in float aSize;
+layout (location = 5) in vec4 aColor;
+
+out vec2 fragUVs;
+out vec4 fragColor;
+uniform mat4 uProjection;
+
+void main()
+{
+	vec2 position = vec2(aPositionX, aPositionY) + aQuadPosition * aSize;
+	gl_Position = uProjection * vec4(position, 0.0, 1.0);
+	fragUVs = aTexCoords;
+	fragColor = aColor;
+}
+)";
+
+static const char* particleShaderFrag = R"(
+#version 450 core
+
+in vec2 fragUVs;
+in vec4 fragColor;
+out vec4 color;
+uniform sampler2D uTexture;
+
+void main()
+{
+	color = texture(uTexture, fragUVs) * fragColor;
+}
+)";
+
 }
 
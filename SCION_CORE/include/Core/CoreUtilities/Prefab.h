@@ -45,6 +45,7 @@ struct PrefabbedEntity
 	std::optional<Scion::Core::ECS::Identification> id{ std::nullopt };
 	std::optional<Scion::Core::ECS::TextComponent> textComp{ std::nullopt };
 	std::optional<Scion::Core::ECS::UIComponent> uiComp{ std::nullopt };
+	std::optional<Scion::Core::ECS::ParticleEmitterComponent> particleEmitter{ std::nullopt };
 	std::optional<PrefabbedRelationships> relationships{ std::nullopt };
 };
 
@@ -64,6 +65,14 @@ class Prefab
 	inline const std::string& GetFilepath() const { return m_sPrefabPath; }
 	inline EPrefabType GetType() const { return m_eType; }
 
+	/*
+	 * @brief Creates a tag for a new instance of the prefab, the prefab name followed by the instance count.
+	 * Scenes can be loaded with instances tagged in an earlier session, so counts already used by an entity in the
+	 * registry are skipped.
+	 * @param Takes in the registry the instance will be added to.
+	 */
+	std::string CreateInstanceTag( ECS::Registry& registry ) const;
+
   private:
 	void AddChild( const PrefabbedEntity& child );
 
@@ -73,6 +82,8 @@ class Prefab
 	std::vector<std::shared_ptr<PrefabbedEntity>> m_RelatedPrefabs;
 	std::string m_sName;
 	std::string m_sPrefabPath;
+	/* Number of instance tags that have been created. Not part of the prefab data, so it can change on a const prefab. */
+	mutable std::uint32_t m_InstanceCount{ 0 };
 
 	friend class PrefabCreator;
 };
@@ -85,6 +96,9 @@ class PrefabCreator
 	static std::shared_ptr<Prefab> CreatePrefab( const std::string& sPrefabPath );
 	static std::shared_ptr<Scion::Core::ECS::Entity> AddPrefabToScene( const Prefab& prefab,
 																	  Scion::Core::ECS::Registry& registry );
+	static std::shared_ptr<Scion::Core::ECS::Entity> AddPrefabToScene( const Prefab& prefab,
+																	  Scion::Core::ECS::Registry& registry,
+																	  const std::string& sTag );
 	static bool DeletePrefab( Prefab& prefabToDelete );
 };
 
@@ -0,0 +1,88 @@
+#pragma once
+#include <sol/sol.hpp>
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Scion::Core
+{
+namespace ECS
+{
+class Registry;
+}
+
+class Prefab;
+
+/*
+ * PooledComponent
+ * Added to every instance created by a prefab pool, so instances can be returned to the right pool.
+ */
+struct PooledComponent
+{
+	std::uint32_t poolID{ 0 };
+	bool bActive{ false };
+};
+
+/*
+ * PrefabPool
+ * Keeps instances of a prefab in the registry between spawns, for objects that are created and destroyed often
+ * such as projectiles. Dormant instances are hidden, their physics bodies are disabled and they are excluded from
+ * gameplay views. Acquiring and releasing an instance only resets its components, so the strings, components and
+ * physics bodies are created once.
+ */
+class PrefabPool
+{
+  public:
+	PrefabPool( std::shared_ptr<Prefab> pPrefab, ECS::Registry& registry, std::size_t initialSize = 0 );
+	~PrefabPool() = default;
+
+	PrefabPool( const PrefabPool& ) = delete;
+	PrefabPool& operator=( const PrefabPool& ) = delete;
+	PrefabPool( PrefabPool&& ) = default;
+	PrefabPool& operator=( PrefabPool&& ) = default;
+
+	/*
+	 * @brief Creates dormant instances until the pool holds at least the count.
+	 */
+	void Prewarm( std::size_t count );
+
+	/*
+	 * @brief Wakes a dormant instance at the position. A new instance is created if there are none left.
+	 * @param Takes in the world position of the instance.
+	 * @return Returns the entity of the instance, or entt::null if the instance could not be created.
+	 */
+	entt::entity Acquire( const glm::vec2& position );
+
+	/*
+	 * @brief Returns the instance to the pool.
+	 * @return Returns false if the entity does not belong to this pool or has already been released.
+	 */
+	bool Release( entt::entity entity );
+
+	/*
+	 * @brief Destroys the dormant instances. Active instances are left in the scene.
+	 */
+	void Clear();
+
+	inline std::size_t NumDormant() const { return m_DormantInstances.size(); }
+	/* The number of instances acquired and not yet released or destroyed. */
+	std::size_t NumActive() const;
+	inline ECS::Registry& GetRegistry() { return *m_pRegistry; }
+
+	static void CreateLuaBind( sol::state& lua, ECS::Registry& registry );
+
+  private:
+	entt::entity CreateInstance();
+	void SetDormant( entt::entity entity, bool bDormant );
+
+  private:
+	std::shared_ptr<Prefab> m_pPrefab;
+	ECS::Registry* m_pRegistry;
+	std::vector<entt::entity> m_DormantInstances;
+	std::uint32_t m_PoolID;
+
+	static inline std::uint32_t s_NextPoolID{ 1 };
+};
+} // namespace Scion::Core
@@ -1,9 +1,28 @@
 #pragma once
 #include <sol/sol.hpp>
-#include <SDL.h>
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
 
 namespace Scion::Core::ECS
 {
+/*
+ * AnimationFrameTable
+ * The uv offset of every frame of an animation, so stepping a frame is a single array read.
+ * Tables are shared by every animation that uses the same sprite sheet layout.
+ */
+struct AnimationFrameTable
+{
+	int numFrames{ 0 };
+	bool bVertical{ false };
+	int startX{ 0 };
+	int startY{ 0 };
+	float uvWidth{ 0.f };
+	float uvHeight{ 0.f };
+	/* The u and v of each frame. */
+	std::vector<glm::vec2> uvs{};
+};
+
 struct AnimationComponent
 {
 	/* Number of frames in the animation. */
@@ -12,12 +31,18 @@ struct AnimationComponent
 	int frameRate{ 1 };
 	/* The current frame the animation is at. */
 	int currentFrame{ 0 };
-	/* Uses an offset of the ticks to run the frames. This is the start time. */
-	int startTime{ static_cast<int>( SDL_GetTicks() ) };
+	/* Multiplies the frame delta, 2 plays the animation twice as fast. */
+	float timeScale{ 1.f };
+	/* Seconds spent on the current frame. */
+	float frameTime{ 0.f };
 	/* Does the animation scroll vertically? */
 	bool bVertical{ false };
 	/* Is the animation looped? */
 	bool bLooped{ false };
+	/* Is the animation paused? Paused animations keep their current frame. */
+	bool bPaused{ false };
+	/* Runtime only. The uv offsets of the frames, recreated when the sprite sheet layout changes. */
+	std::shared_ptr<const AnimationFrameTable> pFrameTable{ nullptr };
 
 	[[nodiscard]] std::string to_string() const;
 
@@ -41,6 +41,8 @@ class ComponentSerializer
 	static void SerializeComponent( Scion::Filesystem::JSONSerializer& serializer, const RigidBodyComponent& rigidBody );
 	static void SerializeComponent( Scion::Filesystem::JSONSerializer& serializer, const Identification& id);
 	static void SerializeComponent( Scion::Filesystem::JSONSerializer& serializer, const UIComponent& id);
+	static void SerializeComponent( Scion::Filesystem::JSONSerializer& serializer,
+									const ParticleEmitterComponent& emitter );
 
 	static void DeserializeComponent( const rapidjson::Value& jsonValue, TransformComponent& transform );
 	static void DeserializeComponent( const rapidjson::Value& jsonValue, SpriteComponent& sprite );
@@ -52,6 +54,7 @@ class ComponentSerializer
 	static void DeserializeComponent( const rapidjson::Value& jsonValue, RigidBodyComponent& rigidBody );
 	static void DeserializeComponent( const rapidjson::Value& jsonValue, Identification& id);
 	static void DeserializeComponent( const rapidjson::Value& jsonValue, UIComponent& id);
+	static void DeserializeComponent( const rapidjson::Value& jsonValue, ParticleEmitterComponent& emitter );
 
 	// LUA serializer
 	static void SerializeComponent( Scion::Filesystem::LuaSerializer& serializer, const TransformComponent& transform );
@@ -66,6 +69,8 @@ class ComponentSerializer
 	static void SerializeComponent( Scion::Filesystem::LuaSerializer& serializer, const RigidBodyComponent& rigidBody );
 	static void SerializeComponent( Scion::Filesystem::LuaSerializer& serializer, const Identification& id );
 	static void SerializeComponent( Scion::Filesystem::LuaSerializer& serializer, const UIComponent& ui );
+	static void SerializeComponent( Scion::Filesystem::LuaSerializer& serializer,
+									const ParticleEmitterComponent& emitter );
 
 	static void DeserializeComponent( const sol::table& table, TransformComponent& transform );
 	static void DeserializeComponent( const sol::table& table, SpriteComponent& sprite );
@@ -77,6 +82,7 @@ class ComponentSerializer
 	static void DeserializeComponent( const sol::table& table, RigidBodyComponent& rigidBody );
 	static void DeserializeComponent( const sol::table& table, Identification& id );
 	static void DeserializeComponent( const sol::table& table, UIComponent& ui );
+	static void DeserializeComponent( const sol::table& table, ParticleEmitterComponent& emitter );
 };
 
 } // namespace Scion::Core::ECS
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace Scion::Core::ECS
+{
+/*
+ * DormantComponent
+ * Tags entities that are kept in the registry but are not part of the game, such as the dormant instances of a
+ * prefab pool. Gameplay views, including the views returned to scripts, exclude them.
+ */
+struct DormantComponent
+{
+};
+} // namespace Scion::Core::ECS
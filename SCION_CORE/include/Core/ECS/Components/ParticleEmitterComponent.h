@@ -0,0 +1,80 @@
+#pragma once
+#include <sol/sol.hpp>
+#include <Rendering/Essentials/Vertex.h>
+#include <vector>
+
+namespace Scion::Core::ECS
+{
+/*
+ * ParticleBuffer
+ * The live particles of an emitter, stored as separate arrays so the update loops run over contiguous floats.
+ * Dead particles are swapped with the last live particle, so the first numAlive entries are always alive.
+ */
+struct ParticleBuffer
+{
+	std::vector<float> positionsX{};
+	std::vector<float> positionsY{};
+	std::vector<float> velocitiesX{};
+	std::vector<float> velocitiesY{};
+	/* Seconds the particle has been alive. */
+	std::vector<float> ages{};
+	/* One over the lifetime of the particle, so the age can be turned into a 0-1 value with a multiply. */
+	std::vector<float> invLifetimes{};
+	/* Size and color are written by the update and read by the renderer. */
+	std::vector<float> sizes{};
+	std::vector<Scion::Rendering::Color> colors{};
+
+	std::size_t numAlive{ 0 };
+	/* Fractional particles carried over to the next frame, so low emit rates still emit. */
+	float emitAccumulator{ 0.f };
+
+	void Resize( std::size_t capacity );
+	inline std::size_t Capacity() const { return positionsX.size(); }
+	inline void Clear()
+	{
+		numAlive = 0;
+		emitAccumulator = 0.f;
+	}
+};
+
+struct ParticleEmitterComponent
+{
+	/* The name of the texture drawn for each particle. If empty, the particles are drawn as solid squares. */
+	std::string sTextureName{};
+	/* Number of particles emitted each second. */
+	float emitRate{ 50.f };
+	/* The most particles the emitter can have alive at once. */
+	int maxParticles{ 1000 };
+	/* Lifetime of each particle, in seconds, picked between the min and max. */
+	float minLifetime{ 1.f };
+	float maxLifetime{ 2.f };
+	/* Starting velocity of each particle, in pixels per second, picked between the min and max. */
+	glm::vec2 minVelocity{ -50.f };
+	glm::vec2 maxVelocity{ 50.f };
+	/* Acceleration applied to every particle, in pixels per second squared. */
+	glm::vec2 acceleration{ 0.f };
+	/* Offset of the spawn area from the entity position. */
+	glm::vec2 spawnOffset{ 0.f };
+	/* Particles spawn at a random position inside this area. */
+	glm::vec2 spawnArea{ 0.f };
+	/* Size of the particle in pixels, interpolated over its lifetime. */
+	float startSize{ 8.f };
+	float endSize{ 2.f };
+	/* Color of the particle, interpolated over its lifetime. */
+	Scion::Rendering::Color startColor{ 255, 255, 255, 255 };
+	Scion::Rendering::Color endColor{ 255, 255, 255, 0 };
+	/* Should new particles be emitted? Live particles finish their lifetime either way. */
+	bool bEmitting{ true };
+	/* Should the particles be drawn or hidden? */
+	bool bHidden{ false };
+
+	/* Runtime only. Particles to emit at once on the next update. */
+	int pendingBurst{ 0 };
+	/* Runtime only. The live particles. */
+	ParticleBuffer particles{};
+
+	[[nodiscard]] std::string to_string() const;
+
+	static void CreateLuaBind( sol::state& lua );
+};
+} // namespace Scion::Core::ECS
@@ -43,6 +43,8 @@ struct SpriteComponent
 	int isoCellX{ 0 };
 	/* Iso cell is needed to sort when rendering. */
 	int isoCellY{ 0 };
+	/* Runtime only. Set by the visibility system, false if the sprite was outside of the camera last frame. */
+	bool bInView{ true };
 	// void generate_uvs( int textureWidth, int textureHeight );
 	[[nodiscard]] std::string to_string() const;
 
@@ -2,6 +2,11 @@
 #include <sol/sol.hpp>
 #include <Rendering/Essentials/Vertex.h>
 
+namespace Scion::Rendering
+{
+struct TextLayout;
+}
+
 namespace Scion::Core::ECS
 {
 struct TextComponent
@@ -24,6 +29,8 @@ struct TextComponent
 	bool bHidden{ false };
 	/* Text Component has been changed, sizes need to be updated. */
 	bool bDirty{ false };
+	/* Runtime only. The cached glyph layout of the text, recreated when the component is dirty. */
+	std::shared_ptr<const Scion::Rendering::TextLayout> pTextLayout{ nullptr };
 
 	[[nodiscard]] std::string to_string();
 
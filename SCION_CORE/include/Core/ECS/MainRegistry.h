@@ -14,6 +14,7 @@ namespace Scion::Sounds
 {
 class MusicPlayer;
 class SoundFxPlayer;
+class SoftwareMixer;
 } // namespace Scion::Sounds
 
 namespace Scion::Core::Events
@@ -33,6 +34,9 @@ class RenderUISystem;
 class RenderShapeSystem;
 class AnimationSystem;
 class PhysicsSystem;
+class ParticleSystem;
+class VisibilitySystem;
+class AudioSystem;
 } // namespace Scion::Core::Systems
 
 namespace Scion::Core::ECS
@@ -47,6 +51,7 @@ class MainRegistry
 	SCION_RESOURCES::AssetManager& GetAssetManager();
 	Scion::Sounds::MusicPlayer& GetMusicPlayer();
 	Scion::Sounds::SoundFxPlayer& GetSoundPlayer();
+	Scion::Sounds::SoftwareMixer& GetSoftwareMixer();
 	Scion::Rendering::Renderer& GetRenderer();
 
 	template <typename TContext>
@@ -66,6 +71,9 @@ class MainRegistry
 	Scion::Core::Systems::RenderShapeSystem& GetRenderShapeSystem();
 	Scion::Core::Systems::AnimationSystem& GetAnimationSystem();
 	Scion::Core::Systems::PhysicsSystem& GetPhysicsSystem();
+	Scion::Core::Systems::ParticleSystem& GetParticleSystem();
+	Scion::Core::Systems::VisibilitySystem& GetVisibilitySystem();
+	Scion::Core::Systems::AudioSystem& GetAudioSystem();
 	Registry* GetRegistry();
 
   private:
@@ -0,0 +1,159 @@
+#pragma once
+#include <entt/entt.hpp>
+#include <sol/sol.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Scion::Core::Events
+{
+/*
+ * EntityPairEvent
+ * A fixed layout event for interactions between two entities, such as collisions.
+ * Lua scripts can use this with the PooledEventQueue instead of building a table for every event.
+ * What type and value mean is up to the script.
+ */
+struct EntityPairEvent
+{
+	std::uint32_t entityA{ entt::null };
+	std::uint32_t entityB{ entt::null };
+	int type{ 0 };
+	float value{ 0.f };
+};
+
+/*
+ * PooledEventBatch
+ * A read only view of the events delivered to a lua handler. Only valid during the handler call.
+ */
+template <typename TEvent>
+struct PooledEventBatch
+{
+	const TEvent* pEvents{ nullptr };
+	std::size_t count{ 0 };
+};
+
+/*
+ * PooledEventQueue
+ * Typed event queue where events are copied into per type storage that is reused every update.
+ * Once the storage has grown to the number of events sent per frame, enqueueing does not allocate.
+ * Each handler receives all of the pending events of its type in a single batch, instead of one call per event.
+ * Events enqueued while the handlers are running are delivered on the next update.
+ */
+class PooledEventQueue
+{
+  public:
+	using HandlerID = std::uint32_t;
+
+	template <typename TEvent>
+	using BatchHandler = std::function<void( std::span<const TEvent> )>;
+
+	PooledEventQueue() = default;
+	~PooledEventQueue() = default;
+
+	PooledEventQueue( PooledEventQueue&& ) = default;
+	PooledEventQueue& operator=( PooledEventQueue&& ) = default;
+	PooledEventQueue( const PooledEventQueue& ) = delete;
+	PooledEventQueue& operator=( const PooledEventQueue& ) = delete;
+
+	/*
+	 * @brief Copies the event into the pending events of its type.
+	 */
+	template <typename TEvent>
+	void Enqueue( const TEvent& ev );
+
+	/*
+	 * @brief Adds a handler that receives all of the pending events of the type at each update.
+	 * @return Returns the id used to remove the handler.
+	 */
+	template <typename TEvent>
+	HandlerID AddHandler( BatchHandler<TEvent> handler );
+
+	template <typename TEvent>
+	void RemoveHandler( HandlerID handlerID );
+
+	/*
+	 * @brief Delivers all pending events of the type to its handlers.
+	 */
+	template <typename TEvent>
+	void Update();
+
+	template <typename TEvent>
+	std::size_t NumPending() const;
+
+	/*
+	 * @brief Delivers the pending events of every type, in the order the types were first used.
+	 */
+	void UpdateAll();
+
+	/*
+	 * @brief Drops all pending events. The handlers are kept.
+	 */
+	void Clear();
+
+	/*
+	 * @brief Allows the event type to be used with the lua EventQueue.
+	 * The event type must already have a usertype with a type_id.
+	 * @param Takes in the name of the batch usertype that lua handlers receive.
+	 */
+	template <typename TEvent>
+	static void RegisterLuaEventType( sol::state& lua, const std::string& sBatchName );
+
+	static void CreateLuaBind( sol::state& lua );
+
+  private:
+	struct IEventChannel
+	{
+		virtual ~IEventChannel() = default;
+		virtual void Update() = 0;
+		virtual void Clear() = 0;
+	};
+
+	template <typename TEvent>
+	struct EventChannel : public IEventChannel
+	{
+		/* Events are added to pending and swapped into delivering on update. Both keep their capacity. */
+		std::vector<TEvent> pending{};
+		std::vector<TEvent> delivering{};
+		std::vector<std::pair<HandlerID, BatchHandler<TEvent>>> handlers{};
+		/* Handlers added or removed while delivering are applied once the delivery has finished. */
+		std::vector<std::pair<HandlerID, BatchHandler<TEvent>>> addedHandlers{};
+		std::vector<HandlerID> removedHandlers{};
+		bool bDelivering{ false };
+
+		void ApplyHandlerChanges();
+		virtual void Update() override;
+		virtual void Clear() override { pending.clear(); }
+	};
+
+	template <typename TEvent>
+	EventChannel<TEvent>& GetChannel();
+
+	template <typename TEvent>
+	const EventChannel<TEvent>* TryGetChannel() const;
+
+	struct LuaEventFuncs
+	{
+		std::function<void( PooledEventQueue&, const sol::object& )> enqueue;
+		std::function<HandlerID( PooledEventQueue&, const sol::function& )> addHandler;
+		std::function<void( PooledEventQueue&, HandlerID )> removeHandler;
+		std::function<void( PooledEventQueue& )> update;
+	};
+
+	static const LuaEventFuncs* GetLuaEventFuncs( const sol::table& eventType );
+
+  private:
+	std::unordered_map<entt::id_type, std::unique_ptr<IEventChannel>> m_mapChannels{};
+	/* Keeps the update order stable. */
+	std::vector<IEventChannel*> m_Channels{};
+	HandlerID m_NextHandlerID{ 1 };
+
+	static inline std::unordered_map<entt::id_type, LuaEventFuncs> s_mapLuaEventFuncs{};
+};
+
+} // namespace Scion::Core::Events
+
+#include "PooledEventQueue.inl"
@@ -0,0 +1,152 @@
+#include "PooledEventQueue.h"
+#include "Logger/Logger.h"
+
+namespace Scion::Core::Events
+{
+template <typename TEvent>
+void PooledEventQueue::EventChannel<TEvent>::Update()
+{
+	if ( pending.empty() )
+		return;
+
+	// Swap so that handlers can enqueue new events while the current batch is delivered.
+	std::swap( pending, delivering );
+
+	const std::span<const TEvent> batch{ delivering };
+
+	bDelivering = true;
+	for ( auto& [ handlerID, handler ] : handlers )
+	{
+		if ( std::ranges::find( removedHandlers, handlerID ) == removedHandlers.end() )
+			handler( batch );
+	}
+	bDelivering = false;
+
+	delivering.clear();
+	ApplyHandlerChanges();
+}
+
+template <typename TEvent>
+void PooledEventQueue::EventChannel<TEvent>::ApplyHandlerChanges()
+{
+	for ( auto& handler : addedHandlers )
+		handlers.push_back( std::move( handler ) );
+
+	addedHandlers.clear();
+
+	if ( removedHandlers.empty() )
+		return;
+
+	std::erase_if( handlers, [ this ]( const auto& handler ) {
+		return std::ranges::find( removedHandlers, handler.first ) != removedHandlers.end();
+	} );
+	removedHandlers.clear();
+}
+
+template <typename TEvent>
+PooledEventQueue::EventChannel<TEvent>& PooledEventQueue::GetChannel()
+{
+	const auto typeID = entt::type_hash<TEvent>::value();
+	auto channelItr = m_mapChannels.find( typeID );
+	if ( channelItr == m_mapChannels.end() )
+	{
+		auto pChannel = std::make_unique<EventChannel<TEvent>>();
+		m_Channels.push_back( pChannel.get() );
+		channelItr = m_mapChannels.emplace( typeID, std::move( pChannel ) ).first;
+	}
+
+	return static_cast<EventChannel<TEvent>&>( *channelItr->second );
+}
+
+template <typename TEvent>
+const PooledEventQueue::EventChannel<TEvent>* PooledEventQueue::TryGetChannel() const
+{
+	auto channelItr = m_mapChannels.find( entt::type_hash<TEvent>::value() );
+	if ( channelItr == m_mapChannels.end() )
+		return nullptr;
+
+	return static_cast<const EventChannel<TEvent>*>( channelItr->second.get() );
+}
+
+template <typename TEvent>
+void PooledEventQueue::Enqueue( const TEvent& ev )
+{
+	GetChannel<TEvent>().pending.push_back( ev );
+}
+
+template <typename TEvent>
+PooledEventQueue::HandlerID PooledEventQueue::AddHandler( BatchHandler<TEvent> handler )
+{
+	const HandlerID handlerID = m_NextHandlerID++;
+	auto& channel = GetChannel<TEvent>();
+
+	if ( channel.bDelivering )
+		channel.addedHandlers.emplace_back( handlerID, std::move( handler ) );
+	else
+		channel.handlers.emplace_back( handlerID, std::move( handler ) );
+
+	return handlerID;
+}
+
+template <typename TEvent>
+void PooledEventQueue::RemoveHandler( HandlerID handlerID )
+{
+	auto& channel = GetChannel<TEvent>();
+	channel.removedHandlers.push_back( handlerID );
+
+	if ( !channel.bDelivering )
+		channel.ApplyHandlerChanges();
+}
+
+template <typename TEvent>
+void PooledEventQueue::Update()
+{
+	GetChannel<TEvent>().Update();
+}
+
+template <typename TEvent>
+std::size_t PooledEventQueue::NumPending() const
+{
+	const auto* pChannel = TryGetChannel<TEvent>();
+	return pChannel ? pChannel->pending.size() : 0;
+}
+
+template <typename TEvent>
+void PooledEventQueue::RegisterLuaEventType( sol::state& lua, const std::string& sBatchName )
+{
+	using Batch = PooledEventBatch<TEvent>;
+
+	lua.new_usertype<Batch>(
+		sBatchName,
+		sol::no_constructor,
+		"count",
+		sol::readonly( &Batch::count ),
+		"at",
+		[]( const Batch& batch, std::size_t index ) -> const TEvent* {
+			// Lua indices start at 1
+			if ( index < 1 || index > batch.count )
+			{
+				SCION_ERROR( "Failed to get event. Index [{}] is out of range. Batch size [{}]", index, batch.count );
+				return nullptr;
+			}
+
+			return &batch.pEvents[ index - 1 ];
+		},
+		sol::meta_function::length,
+		[]( const Batch& batch ) { return batch.count; } );
+
+	s_mapLuaEventFuncs[ entt::type_hash<TEvent>::value() ] = LuaEventFuncs{
+		.enqueue = []( PooledEventQueue& queue,
+					   const sol::object& event ) { queue.Enqueue<TEvent>( event.as<const TEvent&>() ); },
+		.addHandler =
+			[]( PooledEventQueue& queue, const sol::function& callback ) {
+				return queue.AddHandler<TEvent>( [ callback ]( std::span<const TEvent> events ) {
+					if ( callback.valid() )
+						callback( Batch{ .pEvents = events.data(), .count = events.size() } );
+				} );
+			},
+		.removeHandler = []( PooledEventQueue& queue, HandlerID handlerID ) { queue.RemoveHandler<TEvent>( handlerID ); },
+		.update = []( PooledEventQueue& queue ) { queue.Update<TEvent>(); } };
+}
+
+} // namespace Scion::Core::Events
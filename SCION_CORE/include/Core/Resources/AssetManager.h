@@ -14,11 +14,17 @@ namespace Scion::Core
 class Prefab;
 }
 
+namespace Scion::Filesystem
+{
+class DirectoryWatcher;
+}
+
 namespace Scion::Rendering
 {
 class Texture;
 class Shader;
 class Font;
+class SDFFontAtlas;
 } // namespace Scion::Rendering
 
 namespace Scion::Sounds
@@ -95,6 +101,16 @@ class AssetManager
 	 */
 	bool AddFontFromMemory( const std::string& fontName, unsigned char* fontData, float fontSize = 32.f );
 
+	/*
+	 * @brief Checks to see if the font exists, and if not, creates a signed distance field font.
+	 * SDF fonts loaded from the same file share one dynamic atlas, no matter the font size.
+	 * @param An std::string for the font name to be use as the key.
+	 * @param An std::string for the font file path to be loaded.
+	 * @param A float for the font size
+	 * @return Returns true if the font was created and loaded successfully, false otherwise.
+	 */
+	bool AddSDFFont( const std::string& fontName, const std::string& fontPath, float fontSize = 32.f );
+
 	/*
 	 * @brief Checks to see if the font exists based on the name and returns a std::shared_ptr<Font>.
 	 * @param An std::string for the font name to lookup.
@@ -148,6 +164,24 @@ class AssetManager
 	 */
 	bool AddMusicFromMemory( const std::string& musicName, const unsigned char* musicData, size_t dataSize );
 
+	/*
+	 * @brief Adds a music that is streamed from a file instead of being loaded. The file is only opened when the
+	 * music is played, and only a few blocks of it are kept in memory while it plays.
+	 * @param An std::string for the Music name to be use as the key.
+	 * @param An std::string for the file the music is in, which can be a pack of several tracks.
+	 * @param The offset of the music in the file and its size in bytes.
+	 * @return Returns true if the Music was added successfully, false otherwise.
+	 */
+	bool AddStreamedMusic( const std::string& musicName, const std::string& filepath, std::uint64_t offset,
+						   std::uint64_t size );
+
+	/*
+	 * @brief Closes the streams of the streamed music that is not playing, so only the tracks a scene uses stay
+	 * open. The music of the scene is opened, so it starts without waiting on the file.
+	 * @param An std::string for the default music of the scene, can be empty.
+	 */
+	void UnloadIdleMusic( const std::string& sSceneMusic );
+
 	/*
 	 * @brief Checks to see if the music exists based on the name and returns shared_ptr<Music>.
 	 * @param An std::string for the music name to lookup.
@@ -281,16 +315,19 @@ class AssetManager
 	 */
 	static void CreateLuaAssetManager( sol::state& lua );
 
+	/* @brief Reloads the assets whose files were changed since the last update. */
 	void Update();
 
   private:
-	void FileWatcher();
+	/* @brief Watches the directory of the file, unless it is already inside a watched directory. */
+	void WatchDirectory( const std::string& sFilepath );
+	/* @brief Called from the watcher threads, marks the assets loaded from the path to be reloaded. */
+	void OnFileChanged( const std::filesystem::path& path, bool bModified );
 
 	struct AssetWatchParams
 	{
 		std::string sAssetName{};
 		std::string sFilepath{};
-		std::filesystem::file_time_type lastWrite;
 		Scion::Utilities::AssetType eType{};
 		bool bDirty{ false };
 	};
@@ -307,6 +344,8 @@ class AssetManager
 	std::map<std::string, std::shared_ptr<Scion::Rendering::Texture>> m_mapTextures{};
 	std::map<std::string, std::shared_ptr<Scion::Rendering::Shader>> m_mapShader{};
 	std::map<std::string, std::shared_ptr<Scion::Rendering::Font>> m_mapFonts{};
+	/* SDF atlases by font path. Weak so that the atlas is freed with the last font using it. */
+	std::map<std::string, std::weak_ptr<Scion::Rendering::SDFFontAtlas>> m_mapSDFAtlases{};
 
 	std::map<std::string, std::shared_ptr<Scion::Sounds::Music>> m_mapMusic{};
 	std::map<std::string, std::shared_ptr<Scion::Sounds::SoundFX>> m_mapSoundFx{};
@@ -319,7 +358,10 @@ class AssetManager
 	std::vector<AssetWatchParams> m_FilewatchParams;
 
 	std::atomic<bool> m_bFileWatcherRunning;
-	std::jthread m_WatchThread;
+	/* Set by the watcher threads when an asset needs to be reloaded, so idle updates do not look at the params. */
+	std::atomic<bool> m_bAssetsDirty;
+	/* The directories the watched assets are in. A watcher also watches every directory below it. */
+	std::map<std::string, std::unique_ptr<Scion::Filesystem::DirectoryWatcher>> m_mapDirWatchers;
 	std::mutex m_CallbackMutex;
 	std::shared_mutex m_AssetMutex;
 };
@@ -0,0 +1,122 @@
+#pragma once
+#include <sol/sol.hpp>
+#include <entt/entt.hpp>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Scion::Core
+{
+namespace ECS
+{
+class Registry;
+}
+
+struct StagedSceneObject;
+struct StagedScene;
+
+enum class ESceneLoadState
+{
+	Idle,
+	/* Copying the scene tables into plain component data, time sliced on the main thread. */
+	Reading,
+	/* Creating the entities in the staging registry on a worker thread. */
+	Building,
+	/* The scene has been swapped in, physics bodies are being created over the next frames. */
+	Finalizing
+};
+
+/*
+ * SceneStreamer
+ * Loads the next scene without stalling the game.
+ * The scene tables live in the main lua state, which is not thread safe, so they are read on the main thread a
+ * few milliseconds per frame. The entities are then built into a staging registry on a worker thread. When the
+ * staging registry is ready, the current scene is destroyed and the staged entities are moved into the main registry
+ * at the start of the next frame. Physics bodies are created afterwards, within the same frame budget.
+ */
+class SceneStreamer
+{
+  public:
+	SceneStreamer();
+	~SceneStreamer();
+
+	/*
+	 * @brief Starts loading the scene in the background.
+	 * @param Takes in the name of the scene, the scene's tilemap and objects tables must be loaded in the lua state.
+	 * @return Returns true if the load was started, false if a scene is already loading or the tables are missing.
+	 */
+	bool RequestScene( const std::string& sSceneName, sol::state& lua );
+
+	/*
+	 * @brief Advances the current load. Must be called once per frame on the main thread,
+	 * before the scripts are updated, so that the swap happens on a frame boundary.
+	 */
+	void Update( ECS::Registry& registry );
+
+	/*
+	 * @brief Stops the current load. Work already handed to the worker thread is discarded when it finishes.
+	 */
+	void Cancel();
+
+	/*
+	 * @brief Gets the progress of the current load.
+	 * @return Returns a value from 0 to 1. Returns 1 when nothing is loading.
+	 */
+	float GetProgress() const;
+
+	inline bool IsLoading() const { return m_eState != ESceneLoadState::Idle; }
+	inline ESceneLoadState GetState() const { return m_eState; }
+	inline const std::string& GetLoadingScene() const { return m_sSceneName; }
+
+	/* Sets how long the main thread work can take each frame, in milliseconds. */
+	inline void SetFrameBudget( double budgetMs ) { m_FrameBudget = std::chrono::duration<double, std::milli>{ budgetMs }; }
+
+  private:
+	using Clock = std::chrono::steady_clock;
+
+	/*
+	 * @brief Reads the scene table entries until the deadline.
+	 * @return Returns true once every entry has been read.
+	 */
+	bool ReadTables( Clock::time_point deadline );
+	void StartBuild( ECS::Registry& registry );
+	void SwapIn( ECS::Registry& registry );
+
+	/*
+	 * @brief Creates the physics bodies of the swapped in entities until the deadline.
+	 * @return Returns true once every body has been created.
+	 */
+	bool FinalizePhysics( ECS::Registry& registry, Clock::time_point deadline );
+
+	/* Runs on the worker thread, must not touch lua or the main registry. */
+	static std::unique_ptr<StagedScene> BuildStagedScene( std::vector<StagedSceneObject> objects );
+
+  private:
+	ESceneLoadState m_eState{ ESceneLoadState::Idle };
+	std::string m_sSceneName{};
+	std::string m_sDefaultMusic{};
+
+	sol::table m_TilemapTable{};
+	sol::table m_ObjectsTable{};
+	std::size_t m_NumTiles{ 0 };
+	std::size_t m_NumObjects{ 0 };
+	/* The number of table entries that have been read, tiles are read before the game objects. */
+	std::size_t m_NumRead{ 0 };
+
+	std::vector<StagedSceneObject> m_StagedObjects;
+	std::future<std::unique_ptr<StagedScene>> m_BuildFuture{};
+	/*
+	 * Builds that were cancelled while running. Destroying a future from std::async waits for its thread, so they are
+	 * kept until they are ready and their result is dropped then.
+	 */
+	std::vector<std::future<std::unique_ptr<StagedScene>>> m_CancelledBuilds{};
+
+	/* Entities in the main registry that are waiting for their physics bodies. */
+	std::vector<entt::entity> m_PendingPhysics{};
+	std::size_t m_NumPhysicsFinalized{ 0 };
+
+	std::chrono::duration<double, std::milli> m_FrameBudget{ 4.0 };
+};
+} // namespace Scion::Core
@@ -45,6 +45,13 @@ class InputManager
 	 */
 	std::shared_ptr<Scion::Windowing::Inputs::Gamepad> GetController( int index );
 
+	/*
+	 * @brief Finds the index of the gamepad with the given joystick id.
+	 * @param Takes in the SDL_JoystickID of the gamepad.
+	 * @return Returns the index of the gamepad if found, -1 otherwise.
+	 */
+	int GetGamepadIndex( SDL_JoystickID joystickID ) const;
+
 	/*
 	 * @brief Adds a new gamepad to the map at the given index.
 	 * @param Takes in a Sint32 for the desired index.
@@ -59,6 +66,21 @@ class InputManager
 	 */
 	int RemoveGamepad( Sint32 gamepadID );
 
+	/*
+	 * @brief Adds a virtual gamepad, that is not backed by a device, at the given index.
+	 * @brief Used to replay recorded gamepad input without the recorded devices.
+	 * @param Takes in the index the gamepad was recorded at.
+	 * @return Returns true if the gamepad was added, false otherwise.
+	 */
+	bool AddVirtualGamepad( int index );
+
+	/*
+	 * @brief Removes the gamepad mapped at the given index.
+	 * @param Takes in the index of the gamepad.
+	 * @return Returns true if a gamepad was removed, false otherwise.
+	 */
+	bool RemoveGamepadAt( int index );
+
 	/*
 	 * @brief Finds the Gamepad based on the values provided from the SDL_Event
 	 * and sets the Button to pressed if it exists.
@@ -0,0 +1,122 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Scion::Core
+{
+enum class EInputRecordType : std::uint8_t
+{
+	KeyPressed,
+	KeyReleased,
+	MouseBtnPressed,
+	MouseBtnReleased,
+	MouseWheel,
+	MouseMotion,
+	GamepadBtnPressed,
+	GamepadBtnReleased,
+	GamepadAxis,
+	GamepadHat,
+	GamepadConnected,
+	GamepadDisconnected
+};
+
+/*
+ * InputRecord
+ * A single input change that happened during a frame.
+ * The meaning of the values depends on the type:
+ * Keys/Buttons	- value = key/button.
+ * MouseWheel	- value = wheel x, value2 = wheel y.
+ * MouseMotion	- value = screen x, value2 = screen y.
+ * GamepadAxis	- value = axis, value2 = axis position.
+ * GamepadHat	- value = hat value.
+ * The device is the gamepad index, it is unused for the keyboard and mouse.
+ */
+struct InputRecord
+{
+	std::uint32_t frame{ 0 };
+	std::int32_t value{ 0 };
+	std::int16_t value2{ 0 };
+	EInputRecordType eType{ EInputRecordType::KeyPressed };
+	std::uint8_t device{ 0 };
+};
+
+static_assert( sizeof( InputRecord ) == 12, "InputRecord is written to disk as is and must stay packed." );
+
+/*
+ * InputRecorder
+ * Records the input of a play session to a binary file and replays it at the same frame indices.
+ * Both recording and replaying run with a fixed delta time, so the same sequence of frames produces
+ * the same game state, allowing identical gameplay to be benchmarked across builds.
+ */
+class InputRecorder
+{
+  public:
+	InputRecorder() = default;
+	~InputRecorder();
+
+	/*
+	 * @brief Starts recording input. The records are written to the file when the recording is stopped.
+	 * @param Takes in the path of the file to write.
+	 * @param Takes in the fixed delta time that the session runs at.
+	 * @return Returns true if the recording was started, false otherwise.
+	 */
+	bool StartRecording( const std::string& sFilepath, double fixedDeltaTime );
+
+	/*
+	 * @brief Loads a recorded session for replay.
+	 * @param Takes in the path of a file created with StartRecording.
+	 * @return Returns true if the file was successfully loaded, false otherwise.
+	 */
+	bool StartReplay( const std::string& sFilepath );
+
+	/*
+	 * @brief Stops the current recording or replay. If recording, the records are written to disk.
+	 * @return Returns true if successful or there was nothing to stop, false if the file failed to write.
+	 */
+	bool Stop();
+
+	/*
+	 * @brief Records an input change for the current frame. Does nothing if not recording.
+	 */
+	void Record( EInputRecordType eType, std::int32_t value, std::int16_t value2 = 0, std::uint8_t device = 0 );
+
+	/*
+	 * @brief Gets all of the records of the current frame while replaying.
+	 */
+	std::span<const InputRecord> GetFrameRecords() const;
+
+	/*
+	 * @brief Advances to the next frame. Should be called once at the end of every frame.
+	 */
+	void NextFrame();
+
+	inline bool IsRecording() const { return m_eMode == EMode::Recording; }
+	inline bool IsReplaying() const { return m_eMode == EMode::Replaying; }
+	inline bool IsReplayFinished() const { return IsReplaying() && m_CurrentFrame >= m_NumFrames; }
+	inline double GetFixedDeltaTime() const { return m_FixedDeltaTime; }
+	inline std::uint32_t GetCurrentFrame() const { return m_CurrentFrame; }
+
+  private:
+	bool WriteRecords();
+
+  private:
+	enum class EMode : std::uint8_t
+	{
+		Idle,
+		Recording,
+		Replaying
+	};
+
+	std::vector<InputRecord> m_Records{};
+	std::string m_sFilepath{};
+	double m_FixedDeltaTime{ 0.0 };
+	std::uint32_t m_CurrentFrame{ 0 };
+	std::uint32_t m_NumFrames{ 0 };
+	/* Index of the first record of the current frame while replaying. */
+	std::size_t m_ReplayIndex{ 0 };
+	EMode m_eMode{ EMode::Idle };
+};
+
+} // namespace Scion::Core
@@ -11,7 +11,7 @@ class Registry;
 namespace Scion::Core::Scripting
 {
 /*
- * @brief Binds the MusicPlayer and the SoundPlayer to Lua using Sol2.
+ * @brief Binds the MusicPlayer, the SoundPlayer and the SoftwareMixer to Lua using Sol2.
  */
 struct SoundBinder
 {
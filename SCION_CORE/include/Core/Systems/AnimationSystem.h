@@ -1,26 +1,48 @@
 #pragma once
 #include <sol/sol.hpp>
+#include <map>
+#include <memory>
+#include <tuple>
 
 namespace Scion::Core::ECS
 {
 class Registry;
-}
-
-namespace Scion::Rendering
-{
-class Camera2D;
-}
+struct AnimationComponent;
+struct AnimationFrameTable;
+struct SpriteComponent;
+} // namespace Scion::Core::ECS
 
 namespace Scion::Core::Systems
 {
+/*
+ * AnimationSystem
+ * Steps the frames of every animation by the frame delta. Sprites that the visibility system culled last frame
+ * are skipped, so the camera test is only done once per sprite.
+ */
 class AnimationSystem
 {
   public:
 	AnimationSystem() = default;
 	~AnimationSystem() = default;
 
-	void Update( Scion::Core::ECS::Registry& registry, Scion::Rendering::Camera2D& camera );
+	/*
+	 * @brief Advances the animations.
+	 * @param Takes in the registry and the frame time in seconds.
+	 */
+	void Update( Scion::Core::ECS::Registry& registry, double deltaTime );
 
 	static void CreateAnimationSystemLuaBind( sol::state& lua, Scion::Core::ECS::Registry& registry );
+
+  private:
+	/*
+	 * @brief Gets the frame table for the sprite sheet layout, creating it if no animation is using it.
+	 */
+	std::shared_ptr<const Scion::Core::ECS::AnimationFrameTable> GetFrameTable(
+		const Scion::Core::ECS::AnimationComponent& animation, const Scion::Core::ECS::SpriteComponent& sprite );
+
+  private:
+	/* numFrames, bVertical, start x, start y, uv width, uv height */
+	using FrameTableKey = std::tuple<int, bool, int, int, float, float>;
+	std::map<FrameTableKey, std::weak_ptr<const Scion::Core::ECS::AnimationFrameTable>> m_mapFrameTables;
 };
 } // namespace Scion::Core::Systems
@@ -0,0 +1,43 @@
+#pragma once
+#include <entt/entt.hpp>
+
+namespace Scion::Core::ECS
+{
+class Registry;
+}
+
+namespace Scion::Rendering
+{
+class Camera2D;
+}
+
+namespace Scion::Core::Systems
+{
+/*
+ * AudioSystem
+ * Moves the listener of the software mixer with the game. The listener follows the listener entity when one is set,
+ * otherwise it stays at the center of the camera.
+ */
+class AudioSystem
+{
+  public:
+	AudioSystem();
+	~AudioSystem() = default;
+
+	/*
+	 * @brief Updates the listener and releases the voices the mixer has finished. Should be called once per frame,
+	 * after the camera and the transforms have been updated.
+	 */
+	void Update( Scion::Core::ECS::Registry& registry, const Scion::Rendering::Camera2D& camera );
+
+	/*
+	 * @brief Sets the entity positional sounds are heard from. The entity must have a transform.
+	 * Pass entt::null to go back to the center of the camera.
+	 */
+	inline void SetListenerEntity( entt::entity entity ) { m_ListenerEntity = entity; }
+	inline entt::entity GetListenerEntity() const { return m_ListenerEntity; }
+
+  private:
+	entt::entity m_ListenerEntity;
+};
+} // namespace Scion::Core::Systems
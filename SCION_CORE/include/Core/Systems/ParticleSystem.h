@@ -0,0 +1,52 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <memory>
+#include <random>
+
+namespace Scion::Core::ECS
+{
+class Registry;
+struct ParticleEmitterComponent;
+} // namespace Scion::Core::ECS
+
+namespace Scion::Rendering
+{
+class Camera2D;
+class ParticleBatchRenderer;
+} // namespace Scion::Rendering
+
+namespace Scion::Core::Systems
+{
+/*
+ * ParticleSystem
+ * Simulates and draws the particles of every ParticleEmitterComponent.
+ * Each step of the simulation is a separate loop over the particle arrays, with no branches inside,
+ * so the compiler can vectorize them.
+ */
+class ParticleSystem
+{
+  public:
+	ParticleSystem();
+	~ParticleSystem();
+
+	/*
+	 * @brief Emits new particles, moves the live particles and removes the ones that have expired.
+	 * @param Takes in the registry and the frame time in seconds.
+	 */
+	void Update( Scion::Core::ECS::Registry& registry, double deltaTime );
+	void Render( Scion::Core::ECS::Registry& registry, Scion::Rendering::Camera2D& camera );
+
+  private:
+	void Emit( Scion::Core::ECS::ParticleEmitterComponent& emitter, const glm::vec2& position, float deltaTime );
+	static void Simulate( Scion::Core::ECS::ParticleEmitterComponent& emitter, float deltaTime );
+	static void RemoveExpired( Scion::Core::ECS::ParticleEmitterComponent& emitter );
+	static void UpdateAppearance( Scion::Core::ECS::ParticleEmitterComponent& emitter );
+
+	inline float Random() { return m_Distribution( m_RandomEngine ); }
+
+  private:
+	std::unique_ptr<Scion::Rendering::ParticleBatchRenderer> m_pBatchRenderer;
+	std::minstd_rand m_RandomEngine;
+	std::uniform_real_distribution<float> m_Distribution;
+};
+} // namespace Scion::Core::Systems
@@ -16,6 +16,7 @@ class RenderUISystem
   private:
 	std::unique_ptr<Scion::Rendering::SpriteBatchRenderer> m_pSpriteRenderer;
 	std::unique_ptr<Scion::Rendering::TextBatchRenderer> m_pTextRenderer;
+	std::unique_ptr<Scion::Rendering::TextBatchRenderer> m_pSDFTextRenderer;
 	std::unique_ptr<Scion::Rendering::Camera2D> m_pCamera2D;
 
   public:
@@ -0,0 +1,98 @@
+#pragma once
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Scion::Core::ECS
+{
+class Registry;
+}
+
+namespace Scion::Rendering
+{
+class Camera2D;
+}
+
+namespace Scion::Core::Systems
+{
+/* The size of a spatial grid cell in world units. */
+constexpr float VISIBILITY_CELL_SIZE = 256.f;
+
+/*
+ * VisibilityData
+ * The culling state of a single registry. Lives in the registry context.
+ * Static tiles are kept in a spatial grid that is rebuilt only when tiles are added, removed or changed,
+ * everything else is tested against the camera every frame. Tiles moved or resized by reference do not fire the
+ * registry signals, so their bounds are compared against the ones the grid was built with every frame.
+ */
+struct VisibilityData
+{
+	struct GridEntry
+	{
+		entt::entity entity{ entt::null };
+		/* The first cell the entity overlaps, used so entities that span cells are only reported once. */
+		int minCellX{ 0 };
+		int minCellY{ 0 };
+	};
+
+	struct TileBounds
+	{
+		entt::entity entity{ entt::null };
+		glm::vec2 min{ 0.f };
+		glm::vec2 max{ 0.f };
+	};
+
+	std::unordered_map<std::int64_t, std::vector<GridEntry>> mapCells{};
+	/* The bounds of every tile in the grid, as they were when the grid was built. */
+	std::vector<TileBounds> tileBounds{};
+	/* The sprites that were in view of the camera the last time the registry was culled. */
+	std::vector<entt::entity> visibleEntities{};
+	bool bGridDirty{ true };
+
+	void OnTileChanged( entt::registry& registry, entt::entity entity );
+	void OnSpriteChanged( entt::registry& registry, entt::entity entity );
+};
+
+/*
+ * VisibilitySystem
+ * Culls the sprites of a registry once per frame. The render, picking and animation systems
+ * read the result rather than testing every sprite against the camera themselves.
+ */
+class VisibilitySystem
+{
+  public:
+	VisibilitySystem() = default;
+	~VisibilitySystem() = default;
+
+	/*
+	 * @brief Culls the sprites of the registry against the camera. Should be called once per frame,
+	 * after the camera has been updated and before any of the systems that draw the registry.
+	 * Also sets the bInView flag of every culled sprite.
+	 */
+	void Update( Scion::Core::ECS::Registry& registry, const Scion::Rendering::Camera2D& camera );
+
+	/*
+	 * @brief Gets the sprites that were in view of the camera the last time the registry was culled.
+	 * Sprites with a UIComponent are tested against the same camera, so systems that draw them
+	 * with a different camera must not use this list.
+	 */
+	static const std::vector<entt::entity>& GetVisibleEntities( Scion::Core::ECS::Registry& registry );
+
+	/*
+	 * @brief Forces the tile grid to be rebuilt before the next cull. Moved and resized tiles are found by
+	 * comparing their bounds, so this is only needed when the grid should be rebuilt for another reason.
+	 */
+	static void Invalidate( Scion::Core::ECS::Registry& registry );
+
+  private:
+	static VisibilityData& GetVisibilityData( Scion::Core::ECS::Registry& registry );
+	static void RebuildGrid( Scion::Core::ECS::Registry& registry, VisibilityData& data );
+	/*
+	 * @brief Clears the bInView flag of the tiles in the grid and marks the grid dirty if any of them
+	 * no longer has the bounds it was added with.
+	 */
+	static void CheckTileBounds( Scion::Core::ECS::Registry& registry, VisibilityData& data );
+};
+} // namespace Scion::Core::Systems
@@ -38,6 +38,8 @@ static std::unordered_map< std::string, EGameType > g_mapStrToGameType
 
 CoreEngineData::CoreEngineData()
 	: m_DeltaTime{ 0.f }
+	, m_FixedDeltaTime{ 0.0 }
+	, m_FrameTime{ 0.0 }
 	, m_ScaledWidth{ 0.f }
 	, m_ScaledHeight{ 0.f }
 	, m_Gravity{ 9.8f }
@@ -63,7 +65,8 @@ CoreEngineData& CoreEngineData::GetInstance()
 void CoreEngineData::UpdateDeltaTime()
 {
 	auto now = std::chrono::steady_clock::now();
-	m_DeltaTime = std::chrono::duration<double>( now - m_LastUpdate ).count();
+	m_FrameTime = std::chrono::duration<double>( now - m_LastUpdate ).count();
+	m_DeltaTime = m_FixedDeltaTime > 0.0 ? m_FixedDeltaTime : m_FrameTime;
 	m_LastUpdate = now;
 }
 
@@ -140,6 +143,7 @@ void CoreEngineData::RegisterMetaFunctions()
 	Entity::RegisterMetaComponent<TileComponent>();
 	Entity::RegisterMetaComponent<Relationship>();
 	Entity::RegisterMetaComponent<UIComponent>();
+	Entity::RegisterMetaComponent<ParticleEmitterComponent>();
 
 	Registry::RegisterMetaComponent<Identification>();
 	Registry::RegisterMetaComponent<TransformComponent>();
@@ -153,6 +157,7 @@ void CoreEngineData::RegisterMetaFunctions()
 	Registry::RegisterMetaComponent<TileComponent>();
 	Registry::RegisterMetaComponent<Relationship>();
 	Registry::RegisterMetaComponent<UIComponent>();
+	Registry::RegisterMetaComponent<ParticleEmitterComponent>();
 
 	// Register User Data Types
 	Scion::Core::Scripting::UserDataBinder::register_meta_user_data<ObjectData>();
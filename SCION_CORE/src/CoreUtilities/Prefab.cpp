@@ -271,6 +271,14 @@ bool Prefab::Load( const std::string& sPrefabPath )
 		m_Entity.textComp = textComp;
 	}
 
+	if ( components.HasMember( "particleEmitter" ) )
+	{
+		const rapidjson::Value& particleEmitter = components[ "particleEmitter" ];
+		ParticleEmitterComponent emitterComp{};
+		DESERIALIZE_COMPONENT( particleEmitter, emitterComp );
+		m_Entity.particleEmitter = emitterComp;
+	}
+
 	// TODO: All other components
 	prefabFile.close();
 
@@ -355,12 +363,31 @@ bool Prefab::Save()
 		SERIALIZE_COMPONENT( *pSerializer, ui );
 	}
 
+	if ( m_Entity.particleEmitter )
+	{
+		const auto& emitter = m_Entity.particleEmitter.value();
+		SERIALIZE_COMPONENT( *pSerializer, emitter );
+	}
+
 	pSerializer->EndObject(); // End Components
 	pSerializer->EndObject(); // End Prefab
 	pSerializer->EndDocument();
 	return true;
 }
 
+std::string Prefab::CreateInstanceTag( Scion::Core::ECS::Registry& registry ) const
+{
+	const std::string sTag{ RemoveSuffixCopy( m_Entity.id ? m_Entity.id->name : m_sName, "_pfab" ) };
+
+	std::string sInstanceTag{};
+	do
+	{
+		sInstanceTag = sTag + std::to_string( m_InstanceCount++ );
+	} while ( FindEntityByTag( registry, sInstanceTag ) != entt::null );
+
+	return sInstanceTag;
+}
+
 std::shared_ptr<Prefab> PrefabCreator::CreatePrefab( EPrefabType eType, Scion::Core::ECS::Entity& entityToPrefab )
 {
 	PrefabbedEntity prefabbed{};
@@ -419,6 +446,14 @@ std::shared_ptr<Prefab> PrefabCreator::CreatePrefab( EPrefabType eType, Scion::C
 		prefabbed.textComp = *text;
 	}
 
+	if ( auto* emitter = entityToPrefab.TryGetComponent<ParticleEmitterComponent>() )
+	{
+		prefabbed.particleEmitter = *emitter;
+		// Only the emitter settings are prefabbed, instances start without live particles.
+		prefabbed.particleEmitter->particles = ParticleBuffer{};
+		prefabbed.particleEmitter->pendingBurst = 0;
+	}
+
 	if ( auto* relations = entityToPrefab.TryGetComponent<Relationship>() )
 	{
 		// TODO: handle relationships
@@ -457,18 +492,21 @@ std::shared_ptr<Scion::Core::ECS::Entity> PrefabCreator::AddPrefabToScene( const
 
 	// Remove the _pfab from the prefabbed id
 	std::string sTag{ RemoveSuffixCopy( prefabbed.id->name, "_pfab" ) };
-	std::string sCheckTag{ sTag };
-	int current{ 0 };
 
-	entt::entity hasEntity = FindEntityByTag( registry, sTag );
-	while (hasEntity != entt::null)
+	// Keep the plain tag when it is free, scripts look up single instances such as the player by it.
+	if ( FindEntityByTag( registry, sTag ) != entt::null )
 	{
-		sCheckTag = sTag + std::to_string( current );
-		hasEntity = FindEntityByTag( registry, sTag );
-		++current;
+		sTag = prefab.CreateInstanceTag( registry );
 	}
 
-	sTag = sCheckTag;
+	return AddPrefabToScene( prefab, registry, sTag );
+}
+
+std::shared_ptr<Scion::Core::ECS::Entity> PrefabCreator::AddPrefabToScene( const Prefab& prefab,
+																		  Scion::Core::ECS::Registry& registry,
+																		  const std::string& sTag )
+{
+	const auto& prefabbed = prefab.GetPrefabbedEntity();
 
 	auto newEnt = std::make_shared<Scion::Core::ECS::Entity>( &registry, sTag, prefabbed.id->group );
 
@@ -498,6 +536,11 @@ std::shared_ptr<Scion::Core::ECS::Entity> PrefabCreator::AddPrefabToScene( const
 		newEnt->AddComponent<TextComponent>( prefabbed.textComp.value() );
 	}
 
+	if ( prefabbed.particleEmitter )
+	{
+		newEnt->AddComponent<ParticleEmitterComponent>( prefabbed.particleEmitter.value() );
+	}
+
 	if ( prefabbed.physics )
 	{
 		newEnt->AddComponent<PhysicsComponent>( prefabbed.physics.value() );
@@ -0,0 +1,305 @@
+#include "Core/CoreUtilities/PrefabPool.h"
+#include "Core/CoreUtilities/Prefab.h"
+#include "Core/CoreUtilities/CoreEngineData.h"
+#include "Core/ECS/Components/AllComponents.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/Entity.h"
+#include "Core/Resources/AssetManager.h"
+#include "Physics/Box2DWrappers.h"
+#include "Rendering/Core/Camera2D.h"
+#include "Logger/Logger.h"
+
+
+using namespace Scion::Core::ECS;
+
+namespace Scion::Core
+{
+namespace
+{
+/*
+ * @brief Gets the size that physics bodies are placed relative to. Matches the size used when the runtime
+ * initializes the physics of the scene.
+ */
+glm::vec2 GetPhysicsViewSize( Registry& registry )
+{
+	if ( auto* pCamera = registry.TryGetContext<std::shared_ptr<Scion::Rendering::Camera2D>>(); pCamera && *pCamera )
+		return glm::vec2{ static_cast<float>( ( *pCamera )->GetWidth() ),
+						  static_cast<float>( ( *pCamera )->GetHeight() ) };
+
+	auto& coreGlobals = CORE_GLOBALS();
+	return glm::vec2{ static_cast<float>( coreGlobals.WindowWidth() ),
+					  static_cast<float>( coreGlobals.WindowHeight() ) };
+}
+
+/*
+ * @brief Converts the position of the entity into the position of its body, the same way PhysicsComponent::Init does.
+ */
+b2Vec2 GetBodyPosition( const PhysicsAttributes& attributes, const glm::vec2& position, const glm::vec2& viewSize )
+{
+	const float pixelsToMeters = CORE_GLOBALS().PixelsToMeters();
+	const glm::vec2 shapeSize =
+		attributes.bCircle ? glm::vec2{ attributes.radius } * attributes.scale : attributes.boxSize * attributes.scale;
+
+	const glm::vec2 bodyPosition =
+		( position + attributes.offset - viewSize * 0.5f + shapeSize * 0.5f ) * pixelsToMeters;
+	return b2Vec2{ bodyPosition.x, bodyPosition.y };
+}
+} // namespace
+
+PrefabPool::PrefabPool( std::shared_ptr<Prefab> pPrefab, ECS::Registry& registry, std::size_t initialSize )
+	: m_pPrefab{ std::move( pPrefab ) }
+	, m_pRegistry{ &registry }
+	, m_DormantInstances{}
+	, m_PoolID{ s_NextPoolID++ }
+{
+	if ( !m_pPrefab || !m_pPrefab->GetPrefabbedEntity().id )
+	{
+		SCION_ERROR( "Failed to create prefab pool. Prefab is invalid." );
+		m_pPrefab = nullptr;
+		return;
+	}
+
+	Prewarm( initialSize );
+}
+
+void PrefabPool::Prewarm( std::size_t count )
+{
+	if ( !m_pPrefab )
+		return;
+
+	m_DormantInstances.reserve( count );
+	while ( m_DormantInstances.size() < count )
+	{
+		const auto entity = CreateInstance();
+		if ( entity == entt::null )
+			break;
+
+		m_DormantInstances.push_back( entity );
+	}
+}
+
+entt::entity PrefabPool::Acquire( const glm::vec2& position )
+{
+	if ( !m_pPrefab )
+		return entt::null;
+
+	auto& registry = m_pRegistry->GetRegistry();
+
+	entt::entity entity{ entt::null };
+	while ( entity == entt::null && !m_DormantInstances.empty() )
+	{
+		entity = m_DormantInstances.back();
+		m_DormantInstances.pop_back();
+
+		// Dormant instances are destroyed along with the rest of the scene when the scene changes.
+		if ( !registry.valid( entity ) )
+			entity = entt::null;
+	}
+
+	if ( entity == entt::null )
+	{
+		entity = CreateInstance();
+		if ( entity == entt::null )
+			return entt::null;
+	}
+
+	const auto& prefabbed = m_pPrefab->GetPrefabbedEntity();
+
+	auto& transform = registry.get<TransformComponent>( entity );
+	transform = prefabbed.transform;
+	transform.position = position;
+	transform.bDirty = true;
+
+	if ( auto* pAnimation = registry.try_get<AnimationComponent>( entity ) )
+	{
+		pAnimation->currentFrame = 0;
+		pAnimation->frameTime = 0.f;
+	}
+
+	if ( auto* pPhysics = registry.try_get<PhysicsComponent>( entity ) )
+	{
+		if ( auto* pBody = pPhysics->GetBody() )
+		{
+			const auto viewSize = GetPhysicsViewSize( *m_pRegistry );
+			pBody->SetTransform( GetBodyPosition( pPhysics->GetAttributes(), position, viewSize ), 0.f );
+			pBody->SetLinearVelocity( b2Vec2{ 0.f, 0.f } );
+			pBody->SetAngularVelocity( 0.f );
+		}
+	}
+
+	SetDormant( entity, false );
+
+	return entity;
+}
+
+bool PrefabPool::Release( entt::entity entity )
+{
+	auto& registry = m_pRegistry->GetRegistry();
+	auto* pPooled = registry.valid( entity ) ? registry.try_get<PooledComponent>( entity ) : nullptr;
+	if ( !pPooled || pPooled->poolID != m_PoolID )
+	{
+		SCION_ERROR( "Failed to release entity [{}]. Entity does not belong to the pool.",
+					 static_cast<std::uint32_t>( entity ) );
+		return false;
+	}
+
+	if ( !pPooled->bActive )
+	{
+		SCION_ERROR( "Failed to release entity [{}]. Entity has already been released.",
+					 static_cast<std::uint32_t>( entity ) );
+		return false;
+	}
+
+	SetDormant( entity, true );
+	m_DormantInstances.push_back( entity );
+
+	return true;
+}
+
+std::size_t PrefabPool::NumActive() const
+{
+	// Active instances can be destroyed outside of the pool, so they are counted instead of tracked.
+	std::size_t numActive{ 0 };
+	auto view = m_pRegistry->GetRegistry().view<PooledComponent>();
+	for ( auto entity : view )
+	{
+		const auto& pooled = view.get<PooledComponent>( entity );
+		if ( pooled.poolID == m_PoolID && pooled.bActive )
+			++numActive;
+	}
+
+	return numActive;
+}
+
+void PrefabPool::Clear()
+{
+	auto& registry = m_pRegistry->GetRegistry();
+	for ( auto entity : m_DormantInstances )
+	{
+		if ( registry.valid( entity ) )
+			m_pRegistry->AddToPendingDestruction( entity );
+	}
+
+	m_DormantInstances.clear();
+}
+
+entt::entity PrefabPool::CreateInstance()
+{
+	auto pEntity =
+		PrefabCreator::AddPrefabToScene( *m_pPrefab, *m_pRegistry, m_pPrefab->CreateInstanceTag( *m_pRegistry ) );
+	if ( !pEntity )
+	{
+		SCION_ERROR( "Failed to create prefab pool instance." );
+		return entt::null;
+	}
+
+	const auto entity = pEntity->GetEntity();
+	auto& registry = m_pRegistry->GetRegistry();
+	registry.emplace<PooledComponent>( entity, PooledComponent{ .poolID = m_PoolID } );
+
+	// Create the body now, so acquiring the instance only has to move it.
+	auto* pPhysicsWorld = m_pRegistry->TryGetContext<Scion::Physics::PhysicsWorld>();
+	auto* pPhysics = registry.try_get<PhysicsComponent>( entity );
+	const bool bHasCollider = registry.any_of<BoxColliderComponent, CircleColliderComponent>( entity );
+	if ( pPhysics && pPhysicsWorld && bHasCollider && CORE_GLOBALS().IsPhysicsEnabled() )
+	{
+		auto& physicsAttributes = pPhysics->GetChangableAttributes();
+		if ( const auto* pBoxCollider = registry.try_get<BoxColliderComponent>( entity ) )
+		{
+			physicsAttributes.boxSize = glm::vec2{ pBoxCollider->width, pBoxCollider->height };
+			physicsAttributes.offset = pBoxCollider->offset;
+		}
+		else if ( const auto* pCircleCollider = registry.try_get<CircleColliderComponent>( entity ) )
+		{
+			physicsAttributes.radius = pCircleCollider->radius;
+			physicsAttributes.offset = pCircleCollider->offset;
+		}
+
+		const auto& transform = registry.get<TransformComponent>( entity );
+		physicsAttributes.position = transform.position;
+		physicsAttributes.scale = transform.scale;
+		physicsAttributes.objectData.entityID = static_cast<std::int32_t>( entity );
+
+		const auto viewSize = GetPhysicsViewSize( *m_pRegistry );
+		pPhysics->Init( *pPhysicsWorld, static_cast<int>( viewSize.x ), static_cast<int>( viewSize.y ) );
+
+		if ( pPhysics->UseFilters() )
+		{
+			pPhysics->SetFilterCategory();
+			pPhysics->SetFilterMask();
+			pPhysics->SetGroupIndex();
+		}
+	}
+
+	SetDormant( entity, true );
+	return entity;
+}
+
+void PrefabPool::SetDormant( entt::entity entity, bool bDormant )
+{
+	auto& registry = m_pRegistry->GetRegistry();
+	const auto& prefabbed = m_pPrefab->GetPrefabbedEntity();
+
+	// Awake instances go back to the visibility they were prefabbed with.
+	if ( auto* pSprite = registry.try_get<SpriteComponent>( entity ) )
+		pSprite->bHidden = bDormant || ( prefabbed.sprite && prefabbed.sprite->bHidden );
+
+	if ( auto* pText = registry.try_get<TextComponent>( entity ) )
+		pText->bHidden = bDormant || ( prefabbed.textComp && prefabbed.textComp->bHidden );
+
+	// Dormant emitters stop and drop their particles, so an acquired instance does not start with the old ones.
+	if ( auto* pEmitter = registry.try_get<ParticleEmitterComponent>( entity ) )
+	{
+		pEmitter->bEmitting = !bDormant && ( !prefabbed.particleEmitter || prefabbed.particleEmitter->bEmitting );
+		pEmitter->bHidden = bDormant || ( prefabbed.particleEmitter && prefabbed.particleEmitter->bHidden );
+		pEmitter->pendingBurst = 0;
+		pEmitter->particles.Clear();
+	}
+
+	if ( auto* pPhysics = registry.try_get<PhysicsComponent>( entity ) )
+	{
+		if ( auto* pBody = pPhysics->GetBody() )
+			pBody->SetEnabled( !bDormant );
+	}
+
+	// Dormant instances are kept out of the gameplay views, so scripts do not collide with or update them.
+	if ( bDormant )
+		registry.emplace_or_replace<DormantComponent>( entity );
+	else
+		registry.remove<DormantComponent>( entity );
+
+	registry.get<PooledComponent>( entity ).bActive = !bDormant;
+}
+
+void PrefabPool::CreateLuaBind( sol::state& lua, ECS::Registry& registry )
+{
+	lua.new_usertype<PrefabPool>(
+		"PrefabPool",
+		sol::call_constructor,
+		sol::factories(
+			[ &registry ]( const std::string& sPrefabName ) {
+				return PrefabPool{ ASSET_MANAGER().GetPrefab( sPrefabName ), registry };
+			},
+			[ &registry ]( const std::string& sPrefabName, std::size_t initialSize ) {
+				return PrefabPool{ ASSET_MANAGER().GetPrefab( sPrefabName ), registry, initialSize };
+			} ),
+		"acquire",
+		[]( PrefabPool& pool, const glm::vec2& position, sol::this_state s ) {
+			const auto entity = pool.Acquire( position );
+			return entity == entt::null ? sol::make_object( s, sol::lua_nil )
+										: sol::make_object( s, Entity{ &pool.GetRegistry(), entity } );
+		},
+		"release",
+		[]( PrefabPool& pool, Entity& entity ) { return pool.Release( entity.GetEntity() ); },
+		"prewarm",
+		&PrefabPool::Prewarm,
+		"clear",
+		&PrefabPool::Clear,
+		"numDormant",
+		&PrefabPool::NumDormant,
+		"numActive",
+		&PrefabPool::NumActive );
+}
+
+} // namespace Scion::Core
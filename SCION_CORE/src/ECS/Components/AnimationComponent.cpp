@@ -9,7 +9,9 @@ std::string Scion::Core::ECS::AnimationComponent::to_string() const
 	   << std::boolalpha << "Num Frames: " << numFrames << "\n"
 	   << "Frame Rate: " << frameRate << "\n"
 	   << "bVertical: " << bVertical << "\n"
-	   << "bLooped: " << bLooped << "\n";
+	   << "bLooped: " << bLooped << "\n"
+	   << "bPaused: " << bPaused << "\n"
+	   << "Time Scale: " << timeScale << "\n";
 
 	return ss.str();
 }
@@ -33,16 +35,22 @@ void Scion::Core::ECS::AnimationComponent::CreateAnimationLuaBind( sol::state& l
 		&AnimationComponent::frameRate,
 		"currentFrame",
 		&AnimationComponent::currentFrame,
-		"startTime",
-		&AnimationComponent::startTime,
+		"timeScale",
+		&AnimationComponent::timeScale,
 		"bVertical",
 		&AnimationComponent::bVertical,
 		"bLooped",
 		&AnimationComponent::bLooped,
+		"bPaused",
+		&AnimationComponent::bPaused,
+		"pause",
+		[]( AnimationComponent& anim ) { anim.bPaused = true; },
+		"resume",
+		[]( AnimationComponent& anim ) { anim.bPaused = false; },
 		"reset",
 		[]( AnimationComponent& anim ) {
 			anim.currentFrame = 0;
-			anim.startTime = SDL_GetTicks();
+			anim.frameTime = 0.f;
 		},
 		"toString",
 		&AnimationComponent::to_string );
@@ -189,6 +189,55 @@ void ComponentSerializer::SerializeComponent( Scion::Filesystem::JSONSerializer&
 	// The UI Component is currently only used as a flag for UI Rendering
 }
 
+void ComponentSerializer::SerializeComponent( Scion::Filesystem::JSONSerializer& serializer,
+											  const ParticleEmitterComponent& emitter )
+{
+	serializer
+		.StartNewObject( "particleEmitter" ) // Start particle emitter table
+		.AddKeyValuePair( "texture", emitter.sTextureName )
+		.AddKeyValuePair( "emitRate", emitter.emitRate )
+		.AddKeyValuePair( "maxParticles", emitter.maxParticles )
+		.AddKeyValuePair( "minLifetime", emitter.minLifetime )
+		.AddKeyValuePair( "maxLifetime", emitter.maxLifetime )
+		.AddKeyValuePair( "startSize", emitter.startSize )
+		.AddKeyValuePair( "endSize", emitter.endSize )
+		.AddKeyValuePair( "bEmitting", emitter.bEmitting )
+		.AddKeyValuePair( "bHidden", emitter.bHidden )
+		.StartNewObject( "minVelocity" )
+		.AddKeyValuePair( "x", emitter.minVelocity.x )
+		.AddKeyValuePair( "y", emitter.minVelocity.y )
+		.EndObject() // minVelocity
+		.StartNewObject( "maxVelocity" )
+		.AddKeyValuePair( "x", emitter.maxVelocity.x )
+		.AddKeyValuePair( "y", emitter.maxVelocity.y )
+		.EndObject() // maxVelocity
+		.StartNewObject( "acceleration" )
+		.AddKeyValuePair( "x", emitter.acceleration.x )
+		.AddKeyValuePair( "y", emitter.acceleration.y )
+		.EndObject() // acceleration
+		.StartNewObject( "spawnOffset" )
+		.AddKeyValuePair( "x", emitter.spawnOffset.x )
+		.AddKeyValuePair( "y", emitter.spawnOffset.y )
+		.EndObject() // spawnOffset
+		.StartNewObject( "spawnArea" )
+		.AddKeyValuePair( "x", emitter.spawnArea.x )
+		.AddKeyValuePair( "y", emitter.spawnArea.y )
+		.EndObject() // spawnArea
+		.StartNewObject( "startColor" )
+		.AddKeyValuePair( "r", static_cast<int>( emitter.startColor.r ) )
+		.AddKeyValuePair( "g", static_cast<int>( emitter.startColor.g ) )
+		.AddKeyValuePair( "b", static_cast<int>( emitter.startColor.b ) )
+		.AddKeyValuePair( "a", static_cast<int>( emitter.startColor.a ) )
+		.EndObject() // startColor
+		.StartNewObject( "endColor" )
+		.AddKeyValuePair( "r", static_cast<int>( emitter.endColor.r ) )
+		.AddKeyValuePair( "g", static_cast<int>( emitter.endColor.g ) )
+		.AddKeyValuePair( "b", static_cast<int>( emitter.endColor.b ) )
+		.AddKeyValuePair( "a", static_cast<int>( emitter.endColor.a ) )
+		.EndObject(); // endColor
+	serializer.EndObject(); // End particle emitter table
+}
+
 void ComponentSerializer::DeserializeComponent( const rapidjson::Value& jsonValue, TransformComponent& transform )
 {
 	transform.position =
@@ -338,6 +387,39 @@ void ComponentSerializer::DeserializeComponent( const rapidjson::Value& jsonValu
 	// The UI Component is currently only used as a flag for UI Rendering
 }
 
+void ComponentSerializer::DeserializeComponent( const rapidjson::Value& jsonValue, ParticleEmitterComponent& emitter )
+{
+	emitter.sTextureName = jsonValue[ "texture" ].GetString();
+	emitter.emitRate = jsonValue[ "emitRate" ].GetFloat();
+	emitter.maxParticles = jsonValue[ "maxParticles" ].GetInt();
+	emitter.minLifetime = jsonValue[ "minLifetime" ].GetFloat();
+	emitter.maxLifetime = jsonValue[ "maxLifetime" ].GetFloat();
+	emitter.startSize = jsonValue[ "startSize" ].GetFloat();
+	emitter.endSize = jsonValue[ "endSize" ].GetFloat();
+	emitter.bEmitting = jsonValue[ "bEmitting" ].GetBool();
+	emitter.bHidden = jsonValue[ "bHidden" ].GetBool();
+
+	const auto ReadVec2 = [ & ]( const char* sName ) {
+		return glm::vec2{ jsonValue[ sName ][ "x" ].GetFloat(), jsonValue[ sName ][ "y" ].GetFloat() };
+	};
+
+	emitter.minVelocity = ReadVec2( "minVelocity" );
+	emitter.maxVelocity = ReadVec2( "maxVelocity" );
+	emitter.acceleration = ReadVec2( "acceleration" );
+	emitter.spawnOffset = ReadVec2( "spawnOffset" );
+	emitter.spawnArea = ReadVec2( "spawnArea" );
+
+	const auto ReadColor = [ & ]( const char* sName ) {
+		return Scion::Rendering::Color{ .r = static_cast<GLubyte>( jsonValue[ sName ][ "r" ].GetInt() ),
+									   .g = static_cast<GLubyte>( jsonValue[ sName ][ "g" ].GetInt() ),
+									   .b = static_cast<GLubyte>( jsonValue[ sName ][ "b" ].GetInt() ),
+									   .a = static_cast<GLubyte>( jsonValue[ sName ][ "a" ].GetInt() ) };
+	};
+
+	emitter.startColor = ReadColor( "startColor" );
+	emitter.endColor = ReadColor( "endColor" );
+}
+
 void ComponentSerializer::SerializeComponent( Scion::Filesystem::LuaSerializer& serializer,
 											  const TransformComponent& transform )
 {
@@ -516,6 +598,55 @@ void ComponentSerializer::SerializeComponent( Scion::Filesystem::LuaSerializer&
 	serializer.StartNewTable( "ui" ).EndTable();
 }
 
+void ComponentSerializer::SerializeComponent( Scion::Filesystem::LuaSerializer& serializer,
+											  const ParticleEmitterComponent& emitter )
+{
+	serializer
+		.StartNewTable( "particleEmitter" ) // Start particle emitter table
+		.AddKeyValuePair( "texture", emitter.sTextureName, true, false, false, true )
+		.AddKeyValuePair( "emitRate", emitter.emitRate )
+		.AddKeyValuePair( "maxParticles", emitter.maxParticles )
+		.AddKeyValuePair( "minLifetime", emitter.minLifetime )
+		.AddKeyValuePair( "maxLifetime", emitter.maxLifetime )
+		.AddKeyValuePair( "startSize", emitter.startSize )
+		.AddKeyValuePair( "endSize", emitter.endSize )
+		.AddKeyValuePair( "bEmitting", emitter.bEmitting )
+		.AddKeyValuePair( "bHidden", emitter.bHidden )
+		.StartNewTable( "minVelocity" )
+		.AddKeyValuePair( "x", emitter.minVelocity.x )
+		.AddKeyValuePair( "y", emitter.minVelocity.y )
+		.EndTable() // minVelocity
+		.StartNewTable( "maxVelocity" )
+		.AddKeyValuePair( "x", emitter.maxVelocity.x )
+		.AddKeyValuePair( "y", emitter.maxVelocity.y )
+		.EndTable() // maxVelocity
+		.StartNewTable( "acceleration" )
+		.AddKeyValuePair( "x", emitter.acceleration.x )
+		.AddKeyValuePair( "y", emitter.acceleration.y )
+		.EndTable() // acceleration
+		.StartNewTable( "spawnOffset" )
+		.AddKeyValuePair( "x", emitter.spawnOffset.x )
+		.AddKeyValuePair( "y", emitter.spawnOffset.y )
+		.EndTable() // spawnOffset
+		.StartNewTable( "spawnArea" )
+		.AddKeyValuePair( "x", emitter.spawnArea.x )
+		.AddKeyValuePair( "y", emitter.spawnArea.y )
+		.EndTable() // spawnArea
+		.StartNewTable( "startColor" )
+		.AddKeyValuePair( "r", static_cast<int>( emitter.startColor.r ) )
+		.AddKeyValuePair( "g", static_cast<int>( emitter.startColor.g ) )
+		.AddKeyValuePair( "b", static_cast<int>( emitter.startColor.b ) )
+		.AddKeyValuePair( "a", static_cast<int>( emitter.startColor.a ) )
+		.EndTable() // startColor
+		.StartNewTable( "endColor" )
+		.AddKeyValuePair( "r", static_cast<int>( emitter.endColor.r ) )
+		.AddKeyValuePair( "g", static_cast<int>( emitter.endColor.g ) )
+		.AddKeyValuePair( "b", static_cast<int>( emitter.endColor.b ) )
+		.AddKeyValuePair( "a", static_cast<int>( emitter.endColor.a ) )
+		.EndTable(); // endColor
+	serializer.EndTable(); // End particle emitter table
+}
+
 void ComponentSerializer::DeserializeComponent( const sol::table& table, TransformComponent& transform )
 {
 	transform.position =
@@ -645,4 +776,37 @@ void ComponentSerializer::DeserializeComponent( const sol::table& table, UICompo
 {
 }
 
+void ComponentSerializer::DeserializeComponent( const sol::table& table, ParticleEmitterComponent& emitter )
+{
+	emitter.sTextureName = table[ "texture" ].get_or( std::string{ "" } );
+	emitter.emitRate = table[ "emitRate" ].get_or( 50.f );
+	emitter.maxParticles = table[ "maxParticles" ].get_or( 1000 );
+	emitter.minLifetime = table[ "minLifetime" ].get_or( 1.f );
+	emitter.maxLifetime = table[ "maxLifetime" ].get_or( 2.f );
+	emitter.startSize = table[ "startSize" ].get_or( 8.f );
+	emitter.endSize = table[ "endSize" ].get_or( 2.f );
+	emitter.bEmitting = table[ "bEmitting" ].get_or( true );
+	emitter.bHidden = table[ "bHidden" ].get_or( false );
+
+	const auto ReadVec2 = [ & ]( const char* sName ) {
+		return glm::vec2{ table[ sName ][ "x" ].get_or( 0.f ), table[ sName ][ "y" ].get_or( 0.f ) };
+	};
+
+	emitter.minVelocity = ReadVec2( "minVelocity" );
+	emitter.maxVelocity = ReadVec2( "maxVelocity" );
+	emitter.acceleration = ReadVec2( "acceleration" );
+	emitter.spawnOffset = ReadVec2( "spawnOffset" );
+	emitter.spawnArea = ReadVec2( "spawnArea" );
+
+	const auto ReadColor = [ & ]( const char* sName ) {
+		return Scion::Rendering::Color{ .r = static_cast<GLubyte>( table[ sName ][ "r" ].get_or( 255U ) ),
+									   .g = static_cast<GLubyte>( table[ sName ][ "g" ].get_or( 255U ) ),
+									   .b = static_cast<GLubyte>( table[ sName ][ "b" ].get_or( 255U ) ),
+									   .a = static_cast<GLubyte>( table[ sName ][ "a" ].get_or( 255U ) ) };
+	};
+
+	emitter.startColor = ReadColor( "startColor" );
+	emitter.endColor = ReadColor( "endColor" );
+}
+
 } // namespace Scion::Core::ECS
@@ -0,0 +1,93 @@
+#include "Core/ECS/Components/ParticleEmitterComponent.h"
+#include <entt/entt.hpp>
+
+namespace Scion::Core::ECS
+{
+void ParticleBuffer::Resize( std::size_t capacity )
+{
+	positionsX.resize( capacity );
+	positionsY.resize( capacity );
+	velocitiesX.resize( capacity );
+	velocitiesY.resize( capacity );
+	ages.resize( capacity );
+	invLifetimes.resize( capacity );
+	sizes.resize( capacity );
+	colors.resize( capacity );
+
+	if ( numAlive > capacity )
+		numAlive = capacity;
+}
+
+std::string ParticleEmitterComponent::to_string() const
+{
+	std::stringstream ss;
+	ss << "==== Particle Emitter Component ==== \n"
+	   << std::boolalpha << "Texture Name: " << sTextureName << "\n"
+	   << "Emit Rate: " << emitRate << "\n"
+	   << "Max Particles: " << maxParticles << "\n"
+	   << "Lifetime: [" << minLifetime << ", " << maxLifetime << "]\n"
+	   << "Size: [" << startSize << ", " << endSize << "]\n"
+	   << "Emitting: " << bEmitting << "\n"
+	   << "bHidden: " << bHidden << "\n"
+	   << "Alive: " << particles.numAlive << "\n";
+
+	return ss.str();
+}
+
+void ParticleEmitterComponent::CreateLuaBind( sol::state& lua )
+{
+	lua.new_usertype<ParticleEmitterComponent>(
+		"ParticleEmitter",
+		"type_id",
+		entt::type_hash<ParticleEmitterComponent>::value,
+		sol::call_constructor,
+		sol::factories( [] { return ParticleEmitterComponent{}; },
+						[]( const std::string& sTextureName, float emitRate, int maxParticles ) {
+							return ParticleEmitterComponent{
+								.sTextureName = sTextureName, .emitRate = emitRate, .maxParticles = maxParticles };
+						} ),
+		"textureName",
+		&ParticleEmitterComponent::sTextureName,
+		"emitRate",
+		&ParticleEmitterComponent::emitRate,
+		"maxParticles",
+		&ParticleEmitterComponent::maxParticles,
+		"minLifetime",
+		&ParticleEmitterComponent::minLifetime,
+		"maxLifetime",
+		&ParticleEmitterComponent::maxLifetime,
+		"minVelocity",
+		&ParticleEmitterComponent::minVelocity,
+		"maxVelocity",
+		&ParticleEmitterComponent::maxVelocity,
+		"acceleration",
+		&ParticleEmitterComponent::acceleration,
+		"spawnOffset",
+		&ParticleEmitterComponent::spawnOffset,
+		"spawnArea",
+		&ParticleEmitterComponent::spawnArea,
+		"startSize",
+		&ParticleEmitterComponent::startSize,
+		"endSize",
+		&ParticleEmitterComponent::endSize,
+		"startColor",
+		&ParticleEmitterComponent::startColor,
+		"endColor",
+		&ParticleEmitterComponent::endColor,
+		"bEmitting",
+		&ParticleEmitterComponent::bEmitting,
+		"bHidden",
+		&ParticleEmitterComponent::bHidden,
+		"burst",
+		[]( ParticleEmitterComponent& emitter, int count ) { emitter.pendingBurst += count; },
+		"clear",
+		[]( ParticleEmitterComponent& emitter ) {
+			emitter.particles.Clear();
+			emitter.pendingBurst = 0;
+		},
+		"numAlive",
+		[]( const ParticleEmitterComponent& emitter ) { return emitter.particles.numAlive; },
+		"to_string",
+		&ParticleEmitterComponent::to_string );
+}
+} // namespace Scion::Core::ECS
@@ -1,8 +1,12 @@
 #include "Core/ECS/Components/PhysicsComponent.h"
 #include "Core/CoreUtilities/CoreEngineData.h"
+#include "Core/ECS/MainRegistry.h"
 
 #include "Physics/RayCastCallback.h"
 #include "Physics/BoxTraceCallback.h"
+#include "Physics/BatchQueries.h"
+
+#include <ScionUtilities/ThreadPool.h>
 
 #include <Logger/Logger.h>
 
@@ -10,6 +14,20 @@ using namespace Scion::Physics;
 
 namespace Scion::Core::ECS
 {
+/*
+ * @brief Gets the thread pool used for batched physics queries. The runtime stores the pool in the
+ * registry passed in, while the editor only has one in the main registry.
+ */
+static Scion::Utilities::ThreadPool* GetQueryThreadPool( entt::registry& registry )
+{
+	if ( auto* pThreadPool = registry.ctx().find<SharedThreadPool>() )
+		return pThreadPool->get();
+
+	if ( auto* pThreadPool = MAIN_REGISTRY().GetRegistry()->TryGetContext<SharedThreadPool>() )
+		return pThreadPool->get();
+
+	return nullptr;
+}
 
 PhysicsComponent::PhysicsComponent( const PhysicsAttributes& physicsAttr )
 	: m_pRigidBody{ nullptr }
@@ -652,5 +670,144 @@ void PhysicsComponent::CreatePhysicsLuaBind( sol::state& lua, entt::registry& re
 		[]( PhysicsComponent& pc ) { return pc.GetCurrentObjectData(); }
 
 	);
+
+	/*
+	 * Batched queries. The hit points are converted back into pixels before being returned to lua.
+	 */
+	lua.new_usertype<RayCastHit>(
+		"RayCastHit",
+		sol::no_constructor,
+		"bHit",
+		sol::readonly( &RayCastHit::bHit ),
+		"entityID",
+		sol::readonly( &RayCastHit::entityID ),
+		"fraction",
+		sol::readonly( &RayCastHit::fraction ),
+		"point",
+		sol::readonly_property( []( const RayCastHit& hit ) { return glm::vec2{ hit.point.x, hit.point.y }; } ),
+		"normal",
+		sol::readonly_property( []( const RayCastHit& hit ) { return glm::vec2{ hit.normal.x, hit.normal.y }; } ) );
+
+	lua.new_usertype<BoxTraceResults>(
+		"BoxTraceResults",
+		sol::no_constructor,
+		"numBoxes",
+		[]( const BoxTraceResults& results ) { return results.NumBoxes(); },
+		"numHits",
+		[]( const BoxTraceResults& results, std::size_t box ) {
+			return box > 0 && box <= results.NumBoxes() ? results.NumHits( box - 1 ) : 0U;
+		},
+		"entity",
+		[]( const BoxTraceResults& results, std::size_t box, std::size_t hit, sol::this_state s ) {
+			if ( box == 0 || box > results.NumBoxes() || hit == 0 || hit > results.NumHits( box - 1 ) )
+				return sol::make_object( s, sol::lua_nil );
+
+			return sol::make_object( s, results.entities[ results.offsets[ box - 1 ] + hit - 1 ] );
+		},
+		"entities",
+		[]( const BoxTraceResults& results, std::size_t box, sol::this_state s ) {
+			sol::state_view lua{ s };
+			if ( box == 0 || box > results.NumBoxes() )
+				return lua.create_table();
+
+			const auto begin = results.offsets[ box - 1 ];
+			const auto numHits = results.NumHits( box - 1 );
+			auto entities = lua.create_table( static_cast<int>( numHits ), 0 );
+			for ( std::uint32_t i = 0; i < numHits; ++i )
+				entities[ i + 1 ] = results.entities[ begin + i ];
+
+			return entities;
+		} );
+
+	lua.create_named_table(
+		"PhysicsQuery",
+		"castRays", // Takes a flat array of pixel coords { x1, y1, x2, y2, ... } and returns one hit per ray.
+		[ &registry ]( const sol::table& rays, sol::optional<int> maskBits ) {
+			std::vector<RayCastHit> hits{};
+			auto* pPhysicsWorld = registry.ctx().find<Scion::Physics::PhysicsWorld>();
+			if ( !pPhysicsWorld || !*pPhysicsWorld )
+			{
+				SCION_ERROR( "Failed to cast rays. Physics world is invalid." );
+				return hits;
+			}
+
+			const std::size_t numValues = rays.size();
+			if ( numValues % 4 != 0 )
+			{
+				SCION_ERROR( "Failed to cast rays. Expected 4 values per ray, got [{}] values.", numValues );
+				return hits;
+			}
+
+			auto& coreGlobals = CORE_GLOBALS();
+			const float M2P = coreGlobals.MetersToPixels();
+			const float hScaledWidth = coreGlobals.ScaledWidth() * 0.5f;
+			const float hScaledHeight = coreGlobals.ScaledHeight() * 0.5f;
+
+			std::vector<RayCastQuery> queries( numValues / 4 );
+			for ( std::size_t i = 0; i < queries.size(); ++i )
+			{
+				const int index = static_cast<int>( i * 4 ) + 1;
+				queries[ i ].start = b2Vec2{ rays.get_or( index, 0.f ) / M2P - hScaledWidth,
+											 rays.get_or( index + 1, 0.f ) / M2P - hScaledHeight };
+				queries[ i ].end = b2Vec2{ rays.get_or( index + 2, 0.f ) / M2P - hScaledWidth,
+										   rays.get_or( index + 3, 0.f ) / M2P - hScaledHeight };
+			}
+
+			BatchRayCast( **pPhysicsWorld,
+						  queries,
+						  hits,
+						  static_cast<std::uint16_t>( maskBits.value_or( 0xFFFF ) ),
+						  GetQueryThreadPool( registry ) );
+
+			for ( auto& hit : hits )
+			{
+				if ( !hit.bHit )
+					continue;
+
+				hit.point = b2Vec2{ ( hit.point.x + hScaledWidth ) * M2P, ( hit.point.y + hScaledHeight ) * M2P };
+			}
+
+			return hits;
+		},
+		"boxTraces", // Takes a flat array of pixel bounds { lx, ly, ux, uy, ... } and returns BoxTraceResults.
+		[ &registry ]( const sol::table& boxes, sol::optional<int> maskBits ) {
+			BoxTraceResults results{};
+			auto* pPhysicsWorld = registry.ctx().find<Scion::Physics::PhysicsWorld>();
+			if ( !pPhysicsWorld || !*pPhysicsWorld )
+			{
+				SCION_ERROR( "Failed to trace boxes. Physics world is invalid." );
+				return results;
+			}
+
+			const std::size_t numValues = boxes.size();
+			if ( numValues % 4 != 0 )
+			{
+				SCION_ERROR( "Failed to trace boxes. Expected 4 values per box, got [{}] values.", numValues );
+				return results;
+			}
+
+			auto& coreGlobals = CORE_GLOBALS();
+			const float M2P = coreGlobals.MetersToPixels();
+			const float hScaledWidth = coreGlobals.ScaledWidth() * 0.5f;
+			const float hScaledHeight = coreGlobals.ScaledHeight() * 0.5f;
+
+			std::vector<b2AABB> aabbs( numValues / 4 );
+			for ( std::size_t i = 0; i < aabbs.size(); ++i )
+			{
+				const int index = static_cast<int>( i * 4 ) + 1;
+				aabbs[ i ].lowerBound = b2Vec2{ boxes.get_or( index, 0.f ) / M2P - hScaledWidth,
+												boxes.get_or( index + 1, 0.f ) / M2P - hScaledHeight };
+				aabbs[ i ].upperBound = b2Vec2{ boxes.get_or( index + 2, 0.f ) / M2P - hScaledWidth,
+												boxes.get_or( index + 3, 0.f ) / M2P - hScaledHeight };
+			}
+
+			BatchBoxTrace( **pPhysicsWorld,
+						   aabbs,
+						   results,
+						   static_cast<std::uint16_t>( maskBits.value_or( 0xFFFF ) ),
+						   GetQueryThreadPool( registry ) );
+
+			return results;
+		} );
 }
 } // namespace Scion::Core::ECS
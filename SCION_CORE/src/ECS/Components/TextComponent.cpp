@@ -38,16 +38,33 @@ void Scion::Core::ECS::TextComponent::CreateLuaTextBindings( sol::state& lua )
 			[]( const std::string& sFontName, const std::string& sTextStr ) {
 				return TextComponent{ .sFontName = sFontName, .sTextStr = sTextStr };
 			} ),
+		// Setting these marks the component dirty, so the cached layout is recreated.
 		"textStr",
-		&TextComponent::sTextStr,
+		sol::property( []( const TextComponent& text ) { return text.sTextStr; },
+					   []( TextComponent& text, const std::string& sText ) {
+						   text.sTextStr = sText;
+						   text.bDirty = true;
+					   } ),
 		"fontName",
-		&TextComponent::sFontName,
+		sol::property( []( const TextComponent& text ) { return text.sFontName; },
+					   []( TextComponent& text, const std::string& sFont ) {
+						   text.sFontName = sFont;
+						   text.bDirty = true;
+					   } ),
 		"padding",
-		&TextComponent::padding,
+		sol::property( []( const TextComponent& text ) { return text.padding; },
+					   []( TextComponent& text, int padding ) {
+						   text.padding = padding;
+						   text.bDirty = true;
+					   } ),
 		"bHidden",
 		&TextComponent::bHidden,
 		"wrap",
-		&TextComponent::wrap,
+		sol::property( []( const TextComponent& text ) { return text.wrap; },
+					   []( TextComponent& text, float wrap ) {
+						   text.wrap = wrap;
+						   text.bDirty = true;
+					   } ),
 		"color",
 		&TextComponent::color,
 		"setWrap", // Should be used instead of direct member variables
@@ -3,12 +3,16 @@
 #include <Logger/Logger.h>
 #include <Sounds/MusicPlayer/MusicPlayer.h>
 #include <Sounds/SoundPlayer/SoundFxPlayer.h>
+#include <Sounds/Mixer/SoftwareMixer.h>
 #include <Core/Systems/ScriptingSystem.h>
 #include <Core/Systems/RenderSystem.h>
 #include <Core/Systems/RenderUISystem.h>
 #include <Core/Systems/RenderShapeSystem.h>
 #include <Core/Systems/AnimationSystem.h>
 #include <Core/Systems/PhysicsSystem.h>
+#include <Core/Systems/ParticleSystem.h>
+#include <Core/Systems/VisibilitySystem.h>
+#include <Core/Systems/AudioSystem.h>
 #include <Core/Events/EventDispatcher.h>
 #include <Rendering/Core/Renderer.h>
 #include <ScionUtilities/HelperUtilities.h>
@@ -42,6 +46,11 @@ bool MainRegistry::Initialize( bool bEnableFilewatcher )
 	auto pSoundPlayer = std::make_shared<Scion::Sounds::SoundFxPlayer>();
 	m_pMainRegistry->AddToContext<std::shared_ptr<Scion::Sounds::SoundFxPlayer>>( std::move( pSoundPlayer ) );
 
+	// The music player opens the audio device, the software mixer mixes into it.
+	auto pSoftwareMixer = std::make_shared<Scion::Sounds::SoftwareMixer>();
+	pSoftwareMixer->Attach();
+	m_pMainRegistry->AddToContext<std::shared_ptr<Scion::Sounds::SoftwareMixer>>( std::move( pSoftwareMixer ) );
+
 	auto renderer = std::make_shared<Scion::Rendering::Renderer>();
 
 	// Enable Alpha Blending
@@ -112,6 +121,15 @@ bool MainRegistry::RegisterMainSystems()
 	AddToContext<std::shared_ptr<Scion::Core::Systems::AnimationSystem>>(
 		std::make_shared<Scion::Core::Systems::AnimationSystem>() );
 
+	AddToContext<std::shared_ptr<Scion::Core::Systems::ParticleSystem>>(
+		std::make_shared<Scion::Core::Systems::ParticleSystem>() );
+
+	AddToContext<std::shared_ptr<Scion::Core::Systems::VisibilitySystem>>(
+		std::make_shared<Scion::Core::Systems::VisibilitySystem>() );
+
+	AddToContext<std::shared_ptr<Scion::Core::Systems::AudioSystem>>(
+		std::make_shared<Scion::Core::Systems::AudioSystem>() );
+
 	AddToContext<std::shared_ptr<Scion::Core::Events::EventDispatcher>>(
 		std::make_shared<Scion::Core::Events::EventDispatcher>() );
 
@@ -148,6 +166,12 @@ Scion::Sounds::SoundFxPlayer& MainRegistry::GetSoundPlayer()
 	return *m_pMainRegistry->GetContext<std::shared_ptr<Scion::Sounds::SoundFxPlayer>>();
 }
 
+Scion::Sounds::SoftwareMixer& MainRegistry::GetSoftwareMixer()
+{
+	SCION_ASSERT( m_bInitialized && "Main Registry must be initialized before use." );
+	return *m_pMainRegistry->GetContext<std::shared_ptr<Scion::Sounds::SoftwareMixer>>();
+}
+
 Scion::Rendering::Renderer& MainRegistry::GetRenderer()
 {
 	SCION_ASSERT( m_bInitialized && "Main Registry must be initialized before use." );
@@ -184,6 +208,24 @@ Scion::Core::Systems::PhysicsSystem& MainRegistry::GetPhysicsSystem()
 	return *m_pMainRegistry->GetContext<std::shared_ptr<Scion::Core::Systems::PhysicsSystem>>();
 }
 
+Scion::Core::Systems::ParticleSystem& MainRegistry::GetParticleSystem()
+{
+	SCION_ASSERT( m_bInitialized && "Main Registry must be initialized before use." );
+	return *m_pMainRegistry->GetContext<std::shared_ptr<Scion::Core::Systems::ParticleSystem>>();
+}
+
+Scion::Core::Systems::VisibilitySystem& MainRegistry::GetVisibilitySystem()
+{
+	SCION_ASSERT( m_bInitialized && "Main Registry must be initialized before use." );
+	return *m_pMainRegistry->GetContext<std::shared_ptr<Scion::Core::Systems::VisibilitySystem>>();
+}
+
+Scion::Core::Systems::AudioSystem& MainRegistry::GetAudioSystem()
+{
+	SCION_ASSERT( m_bInitialized && "Main Registry must be initialized before use." );
+	return *m_pMainRegistry->GetContext<std::shared_ptr<Scion::Core::Systems::AudioSystem>>();
+}
+
 Registry* MainRegistry::GetRegistry()
 {
 	if ( !m_pMainRegistry )
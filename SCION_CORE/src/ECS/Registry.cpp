@@ -3,6 +3,7 @@
 #include "Core/ECS/MetaUtilities.h"
 #include "Core/ECS/ECSUtils.h"
 #include "Core/ECS/Components/PersistentComponent.h"
+#include "Core/ECS/Components/DormantComponent.h"
 
 using namespace Scion::Core::Utils;
 
@@ -125,6 +126,9 @@ void Scion::Core::ECS::Registry::CreateLuaRegistryBind( sol::state& lua, Registr
 				view = entities ? entities.cast<entt::runtime_view>() : view;
 			}
 
+			// Dormant entities, such as pooled prefab instances, are not part of the game.
+			view.exclude( reg.GetRegistry().storage<DormantComponent>() );
+
 			return view;
 		},
 		"findEntityByTag",
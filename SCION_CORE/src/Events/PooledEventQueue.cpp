@@ -0,0 +1,100 @@
+#include "Core/Events/PooledEventQueue.h"
+#include "Core/Events/EngineEventTypes.h"
+#include "Core/ECS/MetaUtilities.h"
+
+using namespace Scion::Core::Utils;
+
+namespace Scion::Core::Events
+{
+void PooledEventQueue::UpdateAll()
+{
+	// Handlers can enqueue events of types that have not been used yet, which adds to the channels.
+	for ( std::size_t i = 0; i < m_Channels.size(); ++i )
+		m_Channels[ i ]->Update();
+}
+
+void PooledEventQueue::Clear()
+{
+	for ( auto* pChannel : m_Channels )
+		pChannel->Clear();
+}
+
+const PooledEventQueue::LuaEventFuncs* PooledEventQueue::GetLuaEventFuncs( const sol::table& eventType )
+{
+	auto funcsItr = s_mapLuaEventFuncs.find( GetIdType( eventType ) );
+	if ( funcsItr == s_mapLuaEventFuncs.end() )
+	{
+		SCION_ERROR( "Event type has not been registered with the EventQueue." );
+		return nullptr;
+	}
+
+	return &funcsItr->second;
+}
+
+void PooledEventQueue::CreateLuaBind( sol::state& lua )
+{
+	lua.new_usertype<EntityPairEvent>(
+		"EntityPairEvent",
+		"type_id",
+		&entt::type_hash<EntityPairEvent>::value,
+		sol::call_constructor,
+		sol::factories( [] { return EntityPairEvent{}; },
+						[]( std::uint32_t entityA, std::uint32_t entityB ) {
+							return EntityPairEvent{ .entityA = entityA, .entityB = entityB };
+						},
+						[]( std::uint32_t entityA, std::uint32_t entityB, int type, float value ) {
+							return EntityPairEvent{ .entityA = entityA, .entityB = entityB, .type = type, .value = value };
+						} ),
+		"entityA",
+		&EntityPairEvent::entityA,
+		"entityB",
+		&EntityPairEvent::entityB,
+		"type",
+		&EntityPairEvent::type,
+		"value",
+		&EntityPairEvent::value );
+
+	RegisterLuaEventType<EntityPairEvent>( lua, "EntityPairEventBatch" );
+	RegisterLuaEventType<KeyEvent>( lua, "KeyEventBatch" );
+	RegisterLuaEventType<GamepadConnectEvent>( lua, "GamepadConnectEventBatch" );
+
+	lua.new_usertype<PooledEventQueue>(
+		"EventQueue",
+		sol::call_constructor,
+		sol::constructors<PooledEventQueue()>(),
+		"addHandler",
+		[]( PooledEventQueue& queue, const sol::table& eventType, const sol::function& callback ) -> HandlerID {
+			if ( const auto* pFuncs = GetLuaEventFuncs( eventType ) )
+				return pFuncs->addHandler( queue, callback );
+
+			return 0;
+		},
+		"removeHandler",
+		[]( PooledEventQueue& queue, const sol::table& eventType, HandlerID handlerID ) {
+			if ( const auto* pFuncs = GetLuaEventFuncs( eventType ) )
+				pFuncs->removeHandler( queue, handlerID );
+		},
+		"enqueue",
+		[]( PooledEventQueue& queue, const sol::table& event ) {
+			if ( const auto* pFuncs = GetLuaEventFuncs( event ) )
+				pFuncs->enqueue( queue, event );
+		},
+		"enqueuePair",
+		[]( PooledEventQueue& queue, std::uint32_t entityA, std::uint32_t entityB, sol::optional<int> type,
+			sol::optional<float> value ) {
+			// Does not create an event object in lua at all.
+			queue.Enqueue( EntityPairEvent{
+				.entityA = entityA, .entityB = entityB, .type = type.value_or( 0 ), .value = value.value_or( 0.f ) } );
+		},
+		"updateEvent",
+		[]( PooledEventQueue& queue, const sol::table& eventType ) {
+			if ( const auto* pFuncs = GetLuaEventFuncs( eventType ) )
+				pFuncs->update( queue );
+		},
+		"update",
+		&PooledEventQueue::UpdateAll,
+		"clear",
+		&PooledEventQueue::Clear );
+}
+
+} // namespace Scion::Core::Events
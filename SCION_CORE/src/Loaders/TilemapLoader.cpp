@@ -261,6 +261,12 @@ bool TilemapLoader::SaveObjectMapJSON( Scion::Core::ECS::Registry& registry, con
 			SERIALIZE_COMPONENT( *pSerializer, ui );
 		}
 
+		if ( objectEnt.HasComponent<ParticleEmitterComponent>() )
+		{
+			const auto& emitter = objectEnt.GetComponent<ParticleEmitterComponent>();
+			SERIALIZE_COMPONENT( *pSerializer, emitter );
+		}
+
 		if ( auto* relations = objectEnt.TryGetComponent<Relationship>() )
 		{
 			pSerializer->StartNewObject( "relationship" );
@@ -427,6 +433,13 @@ bool TilemapLoader::LoadObjectMapJSON( Scion::Core::ECS::Registry& registry, con
 			DESERIALIZE_COMPONENT( jsonUI, ui );
 		}
 
+		if ( components.HasMember( "particleEmitter" ) )
+		{
+			const auto& jsonEmitter = components[ "particleEmitter" ];
+			auto& emitter = gameObject.AddComponent<ParticleEmitterComponent>();
+			DESERIALIZE_COMPONENT( jsonEmitter, emitter );
+		}
+
 		if ( components.HasMember( "relationship" ) )
 		{
 			const rapidjson::Value& relations = components[ "relationship" ];
@@ -718,6 +731,11 @@ bool TilemapLoader::SaveObjectMapLua( Scion::Core::ECS::Registry& registry, cons
 			SERIALIZE_COMPONENT( *pSerializer, *text );
 		}
 
+		if ( auto* emitter = objectEnt.TryGetComponent<ParticleEmitterComponent>() )
+		{
+			SERIALIZE_COMPONENT( *pSerializer, *emitter );
+		}
+
 		if ( auto* relations = objectEnt.TryGetComponent<Relationship>() )
 		{
 			pSerializer->StartNewTable( "relationship" );
@@ -862,6 +880,13 @@ bool TilemapLoader::LoadObjectMapLua( Scion::Core::ECS::Registry& registry, cons
 			DESERIALIZE_COMPONENT( *luaUI, ui );
 		}
 
+		const sol::optional<sol::table> luaEmitter = ( *components )[ "particleEmitter" ];
+		if ( luaEmitter )
+		{
+			auto& emitter = gameObject.AddComponent<ParticleEmitterComponent>();
+			DESERIALIZE_COMPONENT( *luaEmitter, emitter );
+		}
+
 		const sol::optional<sol::table> luaRelations = ( *components )[ "relationship" ];
 		if ( luaRelations )
 		{
@@ -1104,6 +1129,13 @@ bool TilemapLoader::LoadGameObjectsFromLuaTable( Scion::Core::ECS::Registry& reg
 			auto& ui = newTile.AddComponent<UIComponent>();
 			DESERIALIZE_COMPONENT( *optUI, ui );
 		}
+
+		sol::optional<sol::table> optEmitter = ( *components )[ "particleEmitter" ];
+		if ( optEmitter )
+		{
+			auto& emitter = newTile.AddComponent<ParticleEmitterComponent>();
+			DESERIALIZE_COMPONENT( *optEmitter, emitter );
+		}
 	}
 
 	return true;
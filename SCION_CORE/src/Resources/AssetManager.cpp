@@ -10,12 +10,16 @@
 #include <Rendering/Essentials/Shader.h>
 #include <Rendering/Essentials/Texture.h>
 #include <Rendering/Essentials/Font.h>
+#include <Rendering/Essentials/SDFFontAtlas.h>
 #include <Sounds/Essentials/Music.h>
+#include <Sounds/MusicPlayer/MusicPlayer.h>
 #include <Sounds/Essentials/SoundFX.h>
 
 #include <ScionUtilities/ScionUtilities.h>
 #include <ScionUtilities/SDL_Wrappers.h>
 #include <Logger/Logger.h>
+#include <ScionUtilities/Profiler.h>
+#include <ScionFilesystem/Utilities/DirectoryWatcher.h>
 #include <SDL_image.h>
 
 namespace fs = std::filesystem;
@@ -25,12 +29,8 @@ namespace SCION_RESOURCES
 {
 AssetManager::AssetManager( bool bEnableFilewatcher )
 	: m_bFileWatcherRunning{ bEnableFilewatcher }
+	, m_bAssetsDirty{ false }
 {
-	if ( bEnableFilewatcher )
-	{
-		m_WatchThread = std::jthread( &AssetManager::FileWatcher, this );
-	}
-
 #ifdef IN_SCION_EDITOR
 	IMG_Init( IMG_INIT_PNG );
 	m_mapCursors.emplace( "default", MakeSharedFromSDLType<Cursor>( SDL_GetDefaultCursor() ) );
@@ -40,10 +40,8 @@ AssetManager::AssetManager( bool bEnableFilewatcher )
 AssetManager::~AssetManager()
 {
 	m_bFileWatcherRunning = false;
-	if ( m_WatchThread.joinable() )
-	{
-		m_WatchThread.join();
-	}
+	// Joins the watcher threads, they must not be running while the rest of the manager is destroyed.
+	m_mapDirWatchers.clear();
 }
 
 bool AssetManager::CreateDefaultFonts()
@@ -68,6 +66,8 @@ bool AssetManager::CreateDefaultFonts()
 bool AssetManager::AddTexture( const std::string& textureName, const std::string& texturePath, bool pixelArt,
 							   bool bTileset )
 {
+	SCION_PROFILE_SCOPE( "AssetManager::AddTexture" );
+
 	// Check to see if the texture already exists
 	if ( m_mapTextures.find( textureName ) != m_mapTextures.end() )
 	{
@@ -92,15 +92,13 @@ bool AssetManager::AddTexture( const std::string& textureName, const std::string
 	{
 		std::lock_guard lock{ m_AssetMutex };
 
-		fs::path path{ texturePath };
-		auto lastWrite = fs::last_write_time( path );
 		if ( Scion::Utilities::CheckContainsValue( m_FilewatchParams,
 											 [ & ]( const auto& params ) { return params.sFilepath == texturePath; } ) )
 		{
 			m_FilewatchParams.emplace_back( AssetWatchParams{ .sAssetName = textureName,
 															  .sFilepath = texturePath,
-															  .lastWrite = lastWrite,
 															  .eType = Scion::Utilities::AssetType::TEXTURE } );
+			WatchDirectory( texturePath );
 		}
 	}
 
@@ -110,6 +108,8 @@ bool AssetManager::AddTexture( const std::string& textureName, const std::string
 bool AssetManager::AddTextureFromMemory( const std::string& textureName, const unsigned char* imageData, size_t length,
 										 bool pixelArt, bool bTileset )
 {
+	SCION_PROFILE_SCOPE( "AssetManager::AddTextureFromMemory" );
+
 	// Check to see if the Texture already exist
 	if ( m_mapTextures.contains( textureName ) )
 	{
@@ -151,6 +151,8 @@ std::vector<std::string> AssetManager::GetTilesetNames() const
 
 bool AssetManager::AddFont( const std::string& fontName, const std::string& fontPath, float fontSize )
 {
+	SCION_PROFILE_SCOPE( "AssetManager::AddFont" );
+
 	if ( m_mapFonts.contains( fontName ) )
 	{
 		SCION_ERROR( "Failed to add font [{0}] -- Already Exists!", fontName );
@@ -171,15 +173,13 @@ bool AssetManager::AddFont( const std::string& fontName, const std::string& font
 	{
 		std::lock_guard lock{ m_AssetMutex };
 
-		fs::path path{ fontPath };
-		auto lastWrite = fs::last_write_time( path );
 		if ( Scion::Utilities::CheckContainsValue( m_FilewatchParams,
 											 [ & ]( const auto& params ) { return params.sFilepath == fontPath; } ) )
 		{
 			m_FilewatchParams.emplace_back( AssetWatchParams{ .sAssetName = fontName,
 															  .sFilepath = fontPath,
-															  .lastWrite = lastWrite,
 															  .eType = Scion::Utilities::AssetType::FONT } );
+			WatchDirectory( fontPath );
 		}
 	}
 
@@ -208,6 +208,49 @@ bool AssetManager::AddFontFromMemory( const std::string& fontName, unsigned char
 	return bSuccess;
 }
 
+bool AssetManager::AddSDFFont( const std::string& fontName, const std::string& fontPath, float fontSize )
+{
+	SCION_PROFILE_SCOPE( "AssetManager::AddSDFFont" );
+
+	if ( m_mapFonts.contains( fontName ) )
+	{
+		SCION_ERROR( "Failed to add font [{0}] -- Already Exists!", fontName );
+		return false;
+	}
+
+	auto pAtlas = m_mapSDFAtlases[ fontPath ].lock();
+	if ( !pAtlas )
+	{
+		pAtlas = Scion::Rendering::FontLoader::CreateSDFAtlas( fontPath );
+		if ( !pAtlas )
+		{
+			SCION_ERROR( "Failed to add SDF font [{}] at path [{}] -- to the asset manager!", fontName, fontPath );
+			return false;
+		}
+
+		m_mapSDFAtlases[ fontPath ] = pAtlas;
+	}
+
+	auto [ itr, bSuccess ] =
+		m_mapFonts.emplace( fontName, std::make_shared<Scion::Rendering::Font>( pAtlas, fontSize, fontPath ) );
+
+	if ( m_bFileWatcherRunning && bSuccess )
+	{
+		std::lock_guard lock{ m_AssetMutex };
+
+		if ( Scion::Utilities::CheckContainsValue( m_FilewatchParams,
+												   [ & ]( const auto& params ) { return params.sFilepath == fontPath; } ) )
+		{
+			m_FilewatchParams.emplace_back( AssetWatchParams{ .sAssetName = fontName,
+															  .sFilepath = fontPath,
+															  .eType = Scion::Utilities::AssetType::FONT } );
+			WatchDirectory( fontPath );
+		}
+	}
+
+	return bSuccess;
+}
+
 std::shared_ptr<Scion::Rendering::Font> AssetManager::GetFont( const std::string& fontName )
 {
 	auto fontItr = m_mapFonts.find( fontName );
@@ -223,6 +266,8 @@ std::shared_ptr<Scion::Rendering::Font> AssetManager::GetFont( const std::string
 bool AssetManager::AddShader( const std::string& shaderName, const std::string& vertexPath,
 							  const std::string& fragmentPath )
 {
+	SCION_PROFILE_SCOPE( "AssetManager::AddShader" );
+
 	// Check to see if the shader already exists
 	if ( m_mapShader.contains( shaderName ) )
 	{
@@ -248,26 +293,22 @@ bool AssetManager::AddShader( const std::string& shaderName, const std::string&
 	{
 		std::lock_guard lock{ m_AssetMutex };
 
-		fs::path pathVert{ vertexPath };
-		auto lastWriteVert = fs::last_write_time( pathVert );
 		if ( Scion::Utilities::CheckContainsValue( m_FilewatchParams,
 											 [ & ]( const auto& params ) { return params.sFilepath == vertexPath; } ) )
 		{
 			m_FilewatchParams.emplace_back( AssetWatchParams{ .sAssetName = shaderName + "_vert",
 															  .sFilepath = vertexPath,
-															  .lastWrite = lastWriteVert,
 															  .eType = Scion::Utilities::AssetType::SHADER } );
+			WatchDirectory( vertexPath );
 		}
 
-		fs::path pathFrag{ fragmentPath };
-		auto lastWriteFrag = fs::last_write_time( pathFrag );
 		if ( Scion::Utilities::CheckContainsValue(
 				 m_FilewatchParams, [ & ]( const auto& params ) { return params.sFilepath == fragmentPath; } ) )
 		{
 			m_FilewatchParams.emplace_back( AssetWatchParams{ .sAssetName = shaderName + "_frag",
 															  .sFilepath = fragmentPath,
-															  .lastWrite = lastWriteFrag,
 															  .eType = Scion::Utilities::AssetType::SHADER } );
+			WatchDirectory( fragmentPath );
 		}
 	}
 	return bSuccess;
@@ -276,6 +317,8 @@ bool AssetManager::AddShader( const std::string& shaderName, const std::string&
 bool AssetManager::AddShaderFromMemory( const std::string& shaderName, const char* vertexShader,
 										const char* fragShader )
 {
+	SCION_PROFILE_SCOPE( "AssetManager::AddShaderFromMemory" );
+
 	if ( m_mapShader.contains( shaderName ) )
 	{
 		SCION_ERROR( "Failed to add shader - [{0}] -- Already exists!", shaderName );
@@ -302,6 +345,8 @@ std::shared_ptr<Scion::Rendering::Shader> AssetManager::GetShader( const std::st
 
 bool AssetManager::AddMusic( const std::string& musicName, const std::string& filepath )
 {
+	SCION_PROFILE_SCOPE( "AssetManager::AddMusic" );
+
 	if ( m_mapMusic.contains( musicName ) )
 	{
 		SCION_ERROR( "Failed to add music [{}] -- Already exists!", musicName );
@@ -335,15 +380,13 @@ bool AssetManager::AddMusic( const std::string& musicName, const std::string& fi
 	{
 		std::lock_guard lock{ m_AssetMutex };
 
-		fs::path path{ filepath };
-		auto lastWrite = fs::last_write_time( path );
 		if ( Scion::Utilities::CheckContainsValue( m_FilewatchParams,
 											 [ & ]( const auto& params ) { return params.sFilepath == filepath; } ) )
 		{
 			m_FilewatchParams.emplace_back( AssetWatchParams{ .sAssetName = musicName,
 															  .sFilepath = filepath,
-															  .lastWrite = lastWrite,
 															  .eType = Scion::Utilities::AssetType::MUSIC } );
+			WatchDirectory( filepath );
 		}
 	}
 
@@ -352,6 +395,8 @@ bool AssetManager::AddMusic( const std::string& musicName, const std::string& fi
 
 bool AssetManager::AddMusicFromMemory( const std::string& musicName, const unsigned char* musicData, size_t dataSize )
 {
+	SCION_PROFILE_SCOPE( "AssetManager::AddMusicFromMemory" );
+
 	if ( m_mapMusic.contains( musicName ) )
 	{
 		SCION_ERROR( "Failed to add music [{}] -- Already exists!", musicName );
@@ -391,6 +436,60 @@ bool AssetManager::AddMusicFromMemory( const std::string& musicName, const unsig
 	return bSuccess;
 }
 
+bool AssetManager::AddStreamedMusic( const std::string& musicName, const std::string& filepath, std::uint64_t offset,
+									 std::uint64_t size )
+{
+	SCION_PROFILE_SCOPE( "AssetManager::AddStreamedMusic" );
+
+	if ( m_mapMusic.contains( musicName ) )
+	{
+		SCION_ERROR( "Failed to add music [{}] -- Already exists!", musicName );
+		return false;
+	}
+
+	// Only the header is read to find the type, the rest of the file is read when the music is played.
+	std::array<unsigned char, 64> header{};
+	std::ifstream file{ filepath, std::ios::in | std::ios::binary };
+	file.seekg( static_cast<std::streamoff>( offset ) );
+	file.read( reinterpret_cast<char*>( header.data() ),
+			   static_cast<std::streamsize>( std::min<std::uint64_t>( header.size(), size ) ) );
+
+	const auto headerSize = static_cast<std::size_t>( file.gcount() );
+	Mix_MusicType type = DetectAudioFormat( header.data(), headerSize );
+
+	if ( type == MUS_NONE )
+	{
+		SCION_ERROR( "Failed to add streamed music [{}] at path [{}]. Unable to determine music type.",
+					 musicName,
+					 filepath );
+		return false;
+	}
+
+	Scion::Sounds::SoundParams params{ .name = musicName, .filename = filepath };
+	Scion::Sounds::MusicSource source{ .sFilepath = filepath, .offset = offset, .size = size, .eType = type };
+
+	auto [ itr, bSuccess ] =
+		m_mapMusic.emplace( musicName, std::make_shared<Scion::Sounds::Music>( params, source ) );
+
+	return bSuccess;
+}
+
+void AssetManager::UnloadIdleMusic( const std::string& sSceneMusic )
+{
+	auto& musicPlayer = MAIN_REGISTRY().GetMusicPlayer();
+
+	for ( auto& [ sName, pMusic ] : m_mapMusic )
+	{
+		if ( !pMusic->IsStreamed() )
+			continue;
+
+		if ( sName == sSceneMusic )
+			pMusic->Load();
+		else if ( pMusic->IsLoaded() && !musicPlayer.IsCurrent( *pMusic ) )
+			pMusic->Unload();
+	}
+}
+
 std::shared_ptr<Scion::Sounds::Music> AssetManager::GetMusic( const std::string& musicName )
 {
 	auto musicItr = m_mapMusic.find( musicName );
@@ -447,6 +546,8 @@ Mix_MusicType AssetManager::DetectAudioFormat( const unsigned char* audioData, s
 
 bool AssetManager::AddSoundFx( const std::string& soundFxName, const std::string& filepath )
 {
+	SCION_PROFILE_SCOPE( "AssetManager::AddSoundFx" );
+
 	if ( m_mapSoundFx.contains( soundFxName ) )
 	{
 		SCION_ERROR( "Failed to add soundfx [{}] -- Already exists!", soundFxName );
@@ -467,18 +568,16 @@ bool AssetManager::AddSoundFx( const std::string& soundFxName, const std::string
 	auto pSoundFx = std::make_shared<Scion::Sounds::SoundFX>( params, SoundFxPtr{ pChunk } );
 	auto [ itr, bSuccess ] = m_mapSoundFx.emplace( soundFxName, std::move( pSoundFx ) );
 
-	if ( bSuccess )
+	if ( m_bFileWatcherRunning && bSuccess )
 	{
 		std::lock_guard lock{ m_AssetMutex };
-		fs::path path{ filepath };
-		auto lastWrite = fs::last_write_time( path );
 		if ( Scion::Utilities::CheckContainsValue( m_FilewatchParams,
 											 [ & ]( const auto& params ) { return params.sFilepath == filepath; } ) )
 		{
 			m_FilewatchParams.emplace_back( AssetWatchParams{ .sAssetName = soundFxName,
 															  .sFilepath = filepath,
-															  .lastWrite = lastWrite,
 															  .eType = Scion::Utilities::AssetType::SOUNDFX } );
+			WatchDirectory( filepath );
 		}
 	}
 
@@ -488,6 +587,8 @@ bool AssetManager::AddSoundFx( const std::string& soundFxName, const std::string
 bool AssetManager::AddSoundFxFromMemory( const std::string& soundFxName, const unsigned char* soundFxData,
 										 size_t dataSize )
 {
+	SCION_PROFILE_SCOPE( "AssetManager::AddSoundFxFromMemory" );
+
 	if ( m_mapSoundFx.contains( soundFxName ) )
 	{
 		SCION_ERROR( "Failed to add soundfx [{}] -- Already exists!", soundFxName );
@@ -811,45 +912,82 @@ void AssetManager::CreateLuaAssetManager( sol::state& lua )
 		"addFont",
 		[ & ]( const std::string& fontName, const std::string& fontPath, float fontSize ) {
 			return asset_manager.AddFont( fontName, fontPath, fontSize );
+		},
+		"addSDFFont",
+		[ & ]( const std::string& fontName, const std::string& fontPath, float fontSize ) {
+			return asset_manager.AddSDFFont( fontName, fontPath, fontSize );
+		},
+		"addPrefab",
+		[ & ]( const std::string& prefabName, const std::string& prefabPath ) {
+			auto pPrefab = Scion::Core::PrefabCreator::CreatePrefab( prefabPath );
+			return pPrefab && asset_manager.AddPrefab( prefabName, std::move( pPrefab ) );
 		} );
 }
 void AssetManager::Update()
 {
-	std::shared_lock sharedLock{ m_AssetMutex };
-	auto dirtyView = m_FilewatchParams | std::views::filter( []( const auto& param ) { return param.bDirty; } );
+	SCION_PROFILE_SCOPE( "AssetManager::Update" );
 
-	if ( !dirtyView.empty() )
+	if ( !m_bAssetsDirty.exchange( false ) )
+		return;
+
+	// Copy the dirty params, reloading an asset removes and adds its params again.
+	std::vector<AssetWatchParams> dirtyParams;
 	{
-		sharedLock.unlock();
-		std::unique_lock lock{ m_AssetMutex };
-		for ( auto& param : dirtyView )
+		std::lock_guard lock{ m_AssetMutex };
+		for ( auto& param : m_FilewatchParams )
 		{
-			ReloadAsset( param );
+			if ( !param.bDirty )
+				continue;
+
 			param.bDirty = false;
+			dirtyParams.push_back( param );
 		}
 	}
+
+	for ( const auto& param : dirtyParams )
+	{
+		ReloadAsset( param );
+	}
 }
 
-void AssetManager::FileWatcher()
+void AssetManager::WatchDirectory( const std::string& sFilepath )
 {
-	while ( m_bFileWatcherRunning )
-	{
-		std::this_thread::sleep_for( 2s );
+	fs::path directory{ fs::path{ sFilepath }.parent_path().lexically_normal() };
+	if ( directory.empty() )
+		directory = ".";
 
-		for ( auto& fileParam : m_FilewatchParams )
-		{
-			std::shared_lock sharedLock{ m_AssetMutex };
-			fs::path path{ fileParam.sFilepath };
-			if ( !fs::exists( path ) )
-				continue;
+	// Watchers also watch the directories below them.
+	bool bWatched = std::ranges::any_of( m_mapDirWatchers, [ & ]( const auto& pair ) {
+		fs::path relative = directory.lexically_relative( pair.first );
+		return !relative.empty() && *relative.begin() != "..";
+	} );
 
-			if ( fileParam.lastWrite != fs::last_write_time( path ) )
-			{
-				sharedLock.unlock();
-				std::unique_lock lock{ m_AssetMutex };
-				fileParam.bDirty = true;
-			}
-		}
+	if ( bWatched )
+		return;
+
+	m_mapDirWatchers.emplace( directory.string(),
+							  std::make_unique<Scion::Filesystem::DirectoryWatcher>(
+								  directory, [ this ]( const fs::path& path, bool bModified ) {
+									  OnFileChanged( path, bModified );
+								  } ) );
+}
+
+void AssetManager::OnFileChanged( const std::filesystem::path& path, bool bModified )
+{
+	// Removed files are left loaded, the asset is only removed when it is deleted in the editor.
+	if ( !bModified || !m_bFileWatcherRunning )
+		return;
+
+	const fs::path changedPath{ path.lexically_normal() };
+
+	std::lock_guard lock{ m_AssetMutex };
+	for ( auto& param : m_FilewatchParams )
+	{
+		if ( fs::path{ param.sFilepath }.lexically_normal() != changedPath )
+			continue;
+
+		param.bDirty = true;
+		m_bAssetsDirty = true;
 	}
 }
 
@@ -880,7 +1018,6 @@ void AssetManager::ReloadTexture( const std::string& sTextureName )
 	// Could potentially cause a crash, will look more into this.
 	auto& pTexture = m_mapTextures[ sTextureName ];
 
-	fileParamItr->lastWrite = fs::last_write_time( fs::path{ pTexture->GetPath() } );
 	// Delete the old texture and then reload
 	auto id = pTexture->GetID();
 	glDeleteTextures( 1, &id );
@@ -903,7 +1040,8 @@ void AssetManager::ReloadSoundFx( const std::string& sSoundFxName )
 		return;
 	}
 
-	fileParamItr->lastWrite = fs::last_write_time( fs::path{ fileParamItr->sFilepath } );
+	// Deleting the asset also removes its params.
+	const std::string sFilepath{ fileParamItr->sFilepath };
 
 	if ( !DeleteAsset( sSoundFxName, Scion::Utilities::AssetType::SOUNDFX ) )
 	{
@@ -911,7 +1049,7 @@ void AssetManager::ReloadSoundFx( const std::string& sSoundFxName )
 		return;
 	}
 
-	if ( !AddSoundFx( sSoundFxName, fileParamItr->sFilepath ) )
+	if ( !AddSoundFx( sSoundFxName, sFilepath ) )
 	{
 		SCION_ERROR( "Failed to Reload SoundFx: {}", sSoundFxName );
 		return;
@@ -931,7 +1069,8 @@ void AssetManager::ReloadMusic( const std::string& sMusicName )
 		return;
 	}
 
-	fileParamItr->lastWrite = fs::last_write_time( fs::path{ fileParamItr->sFilepath } );
+	// Deleting the asset also removes its params.
+	const std::string sFilepath{ fileParamItr->sFilepath };
 
 	if ( !DeleteAsset( sMusicName, Scion::Utilities::AssetType::MUSIC ) )
 	{
@@ -939,7 +1078,7 @@ void AssetManager::ReloadMusic( const std::string& sMusicName )
 		return;
 	}
 
-	if ( !AddMusic( sMusicName, fileParamItr->sFilepath ) )
+	if ( !AddMusic( sMusicName, sFilepath ) )
 	{
 		SCION_ERROR( "Failed to Reload SoundFx: {}", sMusicName );
 		return;
@@ -959,10 +1098,11 @@ void AssetManager::ReloadFont( const std::string& sFontName )
 		return;
 	}
 
-	fileParamItr->lastWrite = fs::last_write_time( fs::path{ fileParamItr->sFilepath } );
-
 	auto& pFont = m_mapFonts[ sFontName ];
 	float fontSize = pFont->GetFontSize();
+	bool bSDF = pFont->IsSDF();
+	// Deleting the asset also removes its params.
+	const std::string sFilepath{ fileParamItr->sFilepath };
 
 	if ( !DeleteAsset( sFontName, Scion::Utilities::AssetType::FONT ) )
 	{
@@ -970,7 +1110,11 @@ void AssetManager::ReloadFont( const std::string& sFontName )
 		return;
 	}
 
-	if ( !AddFont( sFontName, fileParamItr->sFilepath, fontSize ) )
+	// Make sure the reloaded file gets a new atlas.
+	if ( bSDF )
+		m_mapSDFAtlases.erase( sFilepath );
+
+	if ( bSDF ? !AddSDFFont( sFontName, sFilepath, fontSize ) : !AddFont( sFontName, sFilepath, fontSize ) )
 	{
 		SCION_ERROR( "Failed to Reload SoundFx: {}", sFontName );
 		return;
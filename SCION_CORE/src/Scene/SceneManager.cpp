@@ -1,9 +1,13 @@
 #include "Core/Scene/SceneManager.h"
 #include "Core/Scene/Scene.h"
+#include "Core/Scene/SceneStreamer.h"
 
 #include "ScionUtilities/ScionUtilities.h"
+#include "ScionUtilities/Profiler.h"
 #include "Core/ECS/Components/AllComponents.h"
 #include "Core/ECS/Registry.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Core/Resources/AssetManager.h"
 #include "Core/Loaders/TilemapLoader.h"
 
 using namespace Scion::Core::ECS;
@@ -70,6 +74,8 @@ std::vector<std::string> SceneManager::GetSceneNames() const
 
 bool SceneManager::LoadCurrentScene()
 {
+	SCION_PROFILE_SCOPE( "SceneManager::LoadCurrentScene" );
+
 	if ( auto pCurrentScene = GetCurrentScene() )
 	{
 		return pCurrentScene->LoadScene();
@@ -124,6 +130,12 @@ void SceneManager::CreateLuaBind( sol::state& lua, ECS::Registry& registry )
 				return false;
 			}
 
+			// A scene that is still streaming in would replace this one when it finishes.
+			if ( auto* pSceneStreamer = registry.TryGetContext<std::shared_ptr<SceneStreamer>>() )
+			{
+				( *pSceneStreamer )->Cancel();
+			}
+
 			( *pSceneManagerData )->sSceneName = sSceneName;
 
 			sol::optional<sol::table> optSceneData = lua[ sSceneName + "_data" ];
@@ -132,6 +144,9 @@ void SceneManager::CreateLuaBind( sol::state& lua, ECS::Registry& registry )
 				( *pSceneManagerData )->sDefaultMusic = ( *optSceneData )[ "default_music" ].get_or( std::string{} );
 			}
 
+			// Only keep the streams of the music the new scene uses open.
+			ASSET_MANAGER().UnloadIdleMusic( ( *pSceneManagerData )->sDefaultMusic );
+
 			registry.DestroyEntities();
 
 			Scion::Core::Loaders::TilemapLoader tl{};
@@ -141,6 +156,27 @@ void SceneManager::CreateLuaBind( sol::state& lua, ECS::Registry& registry )
 
 			return true;
 		},
+		"changeSceneAsync", // Loads the scene over the next frames, the current scene keeps running until it is ready.
+		[ & ]( const std::string& sSceneName ) {
+			auto* pSceneStreamer = registry.TryGetContext<std::shared_ptr<SceneStreamer>>();
+			if ( !pSceneStreamer )
+			{
+				SCION_ERROR( "Failed to change scene asynchronously. Scene streamer was not set." );
+				return false;
+			}
+
+			return ( *pSceneStreamer )->RequestScene( sSceneName, lua );
+		},
+		"getLoadProgress", // Returns the progress of the scene being loaded from 0 to 1.
+		[ & ] {
+			auto* pSceneStreamer = registry.TryGetContext<std::shared_ptr<SceneStreamer>>();
+			return pSceneStreamer ? ( *pSceneStreamer )->GetProgress() : 1.f;
+		},
+		"isSceneLoading",
+		[ & ] {
+			auto* pSceneStreamer = registry.TryGetContext<std::shared_ptr<SceneStreamer>>();
+			return pSceneStreamer && ( *pSceneStreamer )->IsLoading();
+		},
 		"getCanvas", // Returns the canvas of the current scene or an empty canvas object.
 		[ & ] {
 			auto* pSceneManagerData = registry.TryGetContext<std::shared_ptr<SceneManagerData>>();
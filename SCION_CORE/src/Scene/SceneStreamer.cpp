@@ -0,0 +1,492 @@
+#include "Core/Scene/SceneStreamer.h"
+#include "Core/Scene/SceneManager.h"
+#include "Core/ECS/Components/AllComponents.h"
+#include "Core/ECS/Components/ComponentSerializer.h"
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/Entity.h"
+#include "Core/CoreUtilities/CoreEngineData.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Core/Resources/AssetManager.h"
+#include "Physics/Box2DWrappers.h"
+#include "Rendering/Core/Camera2D.h"
+#include "ScionUtilities/ThreadPool.h"
+#include "Logger/Logger.h"
+#include "ScionUtilities/Profiler.h"
+
+#include <optional>
+
+using namespace Scion::Core::ECS;
+
+/* Share of the progress given to each phase of the load. */
+constexpr float READ_PROGRESS = 0.6f;
+constexpr float BUILD_PROGRESS = 0.2f;
+constexpr float FINALIZE_PROGRESS = 0.2f;
+
+namespace Scion::Core
+{
+/*
+ * StagedSceneObject
+ * The components of a scene table entry, copied out of lua so that they can be used off of the main thread.
+ */
+struct StagedSceneObject
+{
+	TransformComponent transform{};
+	std::optional<SpriteComponent> sprite{};
+	std::optional<Identification> id{};
+	std::optional<BoxColliderComponent> boxCollider{};
+	std::optional<CircleColliderComponent> circleCollider{};
+	std::optional<AnimationComponent> animation{};
+	std::optional<PhysicsComponent> physics{};
+	std::optional<TextComponent> text{};
+	std::optional<UIComponent> ui{};
+	std::optional<ParticleEmitterComponent> particleEmitter{};
+	bool bTile{ false };
+};
+
+/*
+ * StagedScene
+ * The scene built by the worker thread, waiting to be swapped into the main registry.
+ */
+struct StagedScene
+{
+	Registry registry{};
+	/* The entities in the order they were read, so the swapped in scene matches a synchronous load. */
+	std::vector<entt::entity> entities{};
+	/* Entities with a physics component but no collider to size the body with. */
+	std::size_t numInvalidPhysics{ 0 };
+};
+
+namespace
+{
+/*
+ * @brief Copies the components out of the table entry.
+ * @return Returns the staged object, or an empty optional if the entry has no components table.
+ */
+std::optional<StagedSceneObject> ReadSceneObject( const sol::table& entry, bool bTile )
+{
+	const sol::optional<sol::table> components = entry[ "components" ];
+	if ( !components )
+		return std::nullopt;
+
+	StagedSceneObject object{ .bTile = bTile };
+
+	const sol::table luaTransform = ( *components )[ "transform" ];
+	DESERIALIZE_COMPONENT( luaTransform, object.transform );
+
+	if ( sol::optional<sol::table> optLuaSprite = ( *components )[ "sprite" ] )
+	{
+		object.sprite.emplace();
+		DESERIALIZE_COMPONENT( *optLuaSprite, *object.sprite );
+	}
+	else if ( bTile )
+	{
+		// Tiles always have a sprite
+		object.sprite.emplace();
+	}
+
+	if ( sol::optional<sol::table> luaID = ( *components )[ "id" ]; luaID && !bTile )
+	{
+		object.id.emplace();
+		DESERIALIZE_COMPONENT( *luaID, *object.id );
+	}
+
+	if ( sol::optional<sol::table> luaBoxCollider = ( *components )[ "boxCollider" ] )
+	{
+		object.boxCollider.emplace();
+		DESERIALIZE_COMPONENT( *luaBoxCollider, *object.boxCollider );
+	}
+
+	if ( sol::optional<sol::table> luaCircleCollider = ( *components )[ "circleCollider" ] )
+	{
+		object.circleCollider.emplace();
+		DESERIALIZE_COMPONENT( *luaCircleCollider, *object.circleCollider );
+	}
+
+	if ( sol::optional<sol::table> luaAnimations = ( *components )[ "animation" ] )
+	{
+		object.animation.emplace();
+		DESERIALIZE_COMPONENT( *luaAnimations, *object.animation );
+	}
+
+	if ( sol::optional<sol::table> luaPhysics = ( *components )[ "physics" ] )
+	{
+		object.physics.emplace();
+		DESERIALIZE_COMPONENT( *luaPhysics, *object.physics );
+	}
+
+	// Text and UI are only saved with the game objects
+	if ( bTile )
+		return object;
+
+	if ( sol::optional<sol::table> optLuaText = ( *components )[ "text" ] )
+	{
+		object.text.emplace();
+		DESERIALIZE_COMPONENT( *optLuaText, *object.text );
+	}
+
+	if ( sol::optional<sol::table> optUI = ( *components )[ "ui" ] )
+	{
+		object.ui.emplace();
+		DESERIALIZE_COMPONENT( *optUI, *object.ui );
+	}
+
+	if ( sol::optional<sol::table> optEmitter = ( *components )[ "particleEmitter" ] )
+	{
+		object.particleEmitter.emplace();
+		DESERIALIZE_COMPONENT( *optEmitter, *object.particleEmitter );
+	}
+
+	return object;
+}
+
+/*
+ * @brief Moves the component from the staging entity to the main registry entity.
+ * @return Returns the moved component, or nullptr if the staging entity does not have it.
+ */
+template <typename TComponent>
+TComponent* MoveComponent( entt::registry& from, entt::entity src, entt::registry& to, entt::entity dst )
+{
+	auto* pComponent = from.try_get<TComponent>( src );
+	if ( !pComponent )
+		return nullptr;
+
+	return &to.emplace<TComponent>( dst, std::move( *pComponent ) );
+}
+} // namespace
+
+SceneStreamer::SceneStreamer() = default;
+
+SceneStreamer::~SceneStreamer() = default;
+
+bool SceneStreamer::RequestScene( const std::string& sSceneName, sol::state& lua )
+{
+	if ( IsLoading() )
+	{
+		SCION_ERROR( "Failed to load scene [{}]. Scene [{}] is still loading.", sSceneName, m_sSceneName );
+		return false;
+	}
+
+	sol::optional<sol::table> optTilemap = lua[ sSceneName + "_tilemap" ];
+	sol::optional<sol::table> optObjects = lua[ sSceneName + "_objects" ];
+	if ( !optTilemap || !optObjects )
+	{
+		SCION_ERROR( "Failed to load scene [{}]. The tilemap or objects table is missing.", sSceneName );
+		return false;
+	}
+
+	sol::optional<sol::table> optTiles = ( *optTilemap )[ "tilemap" ];
+	sol::optional<sol::table> optGameObjects = ( *optObjects )[ "game_objects" ];
+	if ( !optTiles || !optGameObjects )
+	{
+		SCION_ERROR( "Failed to load scene [{}]. \"tilemap\" or \"game_objects\" table is missing or invalid.",
+					 sSceneName );
+		return false;
+	}
+
+	m_sSceneName = sSceneName;
+	m_sDefaultMusic.clear();
+	if ( sol::optional<sol::table> optSceneData = lua[ sSceneName + "_data" ] )
+	{
+		m_sDefaultMusic = ( *optSceneData )[ "default_music" ].get_or( std::string{} );
+	}
+
+	// The serializer saves both tables as arrays, so they can be read by index across frames.
+	m_TilemapTable = *optTiles;
+	m_ObjectsTable = *optGameObjects;
+	m_NumTiles = m_TilemapTable.size();
+	m_NumObjects = m_ObjectsTable.size();
+	m_NumRead = 0;
+
+	m_StagedObjects.clear();
+	m_StagedObjects.reserve( m_NumTiles + m_NumObjects );
+
+	m_eState = ESceneLoadState::Reading;
+	return true;
+}
+
+void SceneStreamer::Update( ECS::Registry& registry )
+{
+	SCION_PROFILE_SCOPE( "SceneStreamer::Update" );
+
+	std::erase_if( m_CancelledBuilds, []( const auto& build ) {
+		return build.wait_for( std::chrono::seconds{ 0 } ) == std::future_status::ready;
+	} );
+
+	if ( m_eState == ESceneLoadState::Idle )
+		return;
+
+	const auto deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>( m_FrameBudget );
+
+	switch ( m_eState )
+	{
+	case ESceneLoadState::Reading:
+		if ( ReadTables( deadline ) )
+			StartBuild( registry );
+		break;
+	case ESceneLoadState::Building:
+		if ( m_BuildFuture.wait_for( std::chrono::seconds{ 0 } ) == std::future_status::ready )
+		{
+			SwapIn( registry );
+			// Bodies are created on the frame after the swap, the swap itself can use up the budget.
+			m_eState = ESceneLoadState::Finalizing;
+		}
+		break;
+	case ESceneLoadState::Finalizing:
+		if ( FinalizePhysics( registry, deadline ) )
+		{
+			SCION_LOG( "Scene [{}] loaded.", m_sSceneName );
+			m_PendingPhysics.clear();
+			m_eState = ESceneLoadState::Idle;
+		}
+		break;
+	default: break;
+	}
+}
+
+void SceneStreamer::Cancel()
+{
+	// A build that is still running is left to finish on the worker thread, its result is dropped in Update.
+	if ( m_BuildFuture.valid() )
+		m_CancelledBuilds.push_back( std::move( m_BuildFuture ) );
+
+	m_BuildFuture = {};
+	m_StagedObjects.clear();
+	m_PendingPhysics.clear();
+	m_TilemapTable = sol::table{};
+	m_ObjectsTable = sol::table{};
+	m_eState = ESceneLoadState::Idle;
+}
+
+float SceneStreamer::GetProgress() const
+{
+	switch ( m_eState )
+	{
+	case ESceneLoadState::Reading: {
+		const std::size_t numTotal = m_NumTiles + m_NumObjects;
+		return numTotal > 0 ? READ_PROGRESS * static_cast<float>( m_NumRead ) / numTotal : READ_PROGRESS;
+	}
+	case ESceneLoadState::Building: return READ_PROGRESS;
+	case ESceneLoadState::Finalizing: {
+		const float finalized = m_PendingPhysics.empty()
+									? 1.f
+									: static_cast<float>( m_NumPhysicsFinalized ) / m_PendingPhysics.size();
+		return READ_PROGRESS + BUILD_PROGRESS + FINALIZE_PROGRESS * finalized;
+	}
+	default: return 1.f;
+	}
+}
+
+bool SceneStreamer::ReadTables( Clock::time_point deadline )
+{
+	const std::size_t numTotal = m_NumTiles + m_NumObjects;
+	while ( m_NumRead < numTotal )
+	{
+		const bool bTile = m_NumRead < m_NumTiles;
+		// Lua arrays start at 1
+		const std::size_t index = ( bTile ? m_NumRead : m_NumRead - m_NumTiles ) + 1;
+		const sol::table& table = bTile ? m_TilemapTable : m_ObjectsTable;
+		sol::optional<sol::table> optEntry = table[ index ];
+		++m_NumRead;
+
+		auto optObject = optEntry ? ReadSceneObject( *optEntry, bTile ) : std::nullopt;
+		if ( !optObject )
+		{
+			SCION_ERROR( "Failed to read scene [{}] entry [{}]: \"components\" table is missing or invalid.",
+						 m_sSceneName,
+						 index );
+		}
+		else
+		{
+			m_StagedObjects.push_back( std::move( *optObject ) );
+		}
+
+		if ( Clock::now() >= deadline )
+			break;
+	}
+
+	if ( m_NumRead < numTotal )
+		return false;
+
+	m_TilemapTable = sol::table{};
+	m_ObjectsTable = sol::table{};
+	return true;
+}
+
+void SceneStreamer::StartBuild( ECS::Registry& registry )
+{
+	m_eState = ESceneLoadState::Building;
+
+	auto buildTask = [ objects = std::move( m_StagedObjects ) ]() mutable {
+		return BuildStagedScene( std::move( objects ) );
+	};
+
+	if ( auto* pThreadPool = registry.TryGetContext<SharedThreadPool>(); pThreadPool && *pThreadPool )
+		m_BuildFuture = ( *pThreadPool )->Enqueue( std::move( buildTask ) );
+	else
+		m_BuildFuture = std::async( std::launch::async, std::move( buildTask ) );
+
+	m_StagedObjects = {};
+}
+
+std::unique_ptr<StagedScene> SceneStreamer::BuildStagedScene( std::vector<StagedSceneObject> objects )
+{
+	auto pStagedScene = std::make_unique<StagedScene>();
+	pStagedScene->entities.reserve( objects.size() );
+
+	for ( auto& object : objects )
+	{
+		Entity newEntity{ &pStagedScene->registry, "", "" };
+		pStagedScene->entities.push_back( newEntity.GetEntity() );
+
+		if ( object.id )
+		{
+			newEntity.GetComponent<Identification>() = std::move( *object.id );
+			newEntity.ChangeName( newEntity.GetComponent<Identification>().name );
+		}
+
+		const auto& transform = newEntity.AddComponent<TransformComponent>( object.transform );
+
+		if ( object.sprite )
+			newEntity.AddComponent<SpriteComponent>( std::move( *object.sprite ) );
+		if ( object.boxCollider )
+			newEntity.AddComponent<BoxColliderComponent>( *object.boxCollider );
+		if ( object.circleCollider )
+			newEntity.AddComponent<CircleColliderComponent>( *object.circleCollider );
+		if ( object.animation )
+			newEntity.AddComponent<AnimationComponent>( *object.animation );
+		if ( object.text )
+			newEntity.AddComponent<TextComponent>( std::move( *object.text ) );
+		if ( object.ui )
+			newEntity.AddComponent<UIComponent>( std::move( *object.ui ) );
+		if ( object.particleEmitter )
+			newEntity.AddComponent<ParticleEmitterComponent>( std::move( *object.particleEmitter ) );
+		if ( object.bTile )
+			newEntity.AddComponent<TileComponent>();
+
+		if ( !object.physics )
+			continue;
+
+		// Size and place the body ahead of time, so only the box2d calls are left for the main thread.
+		auto& physicsAttributes = object.physics->GetChangableAttributes();
+		if ( object.boxCollider )
+		{
+			physicsAttributes.boxSize = glm::vec2{ object.boxCollider->width, object.boxCollider->height };
+			physicsAttributes.offset = object.boxCollider->offset;
+		}
+		else if ( object.circleCollider )
+		{
+			physicsAttributes.radius = object.circleCollider->radius;
+			physicsAttributes.offset = object.circleCollider->offset;
+		}
+		else
+		{
+			++pStagedScene->numInvalidPhysics;
+		}
+
+		physicsAttributes.position = transform.position;
+		physicsAttributes.scale = transform.scale;
+
+		newEntity.AddComponent<PhysicsComponent>( std::move( *object.physics ) );
+	}
+
+	return pStagedScene;
+}
+
+void SceneStreamer::SwapIn( ECS::Registry& registry )
+{
+	auto pStagedScene = m_BuildFuture.get();
+	m_BuildFuture = {};
+
+	if ( pStagedScene->numInvalidPhysics > 0 )
+	{
+		SCION_ERROR( "Scene [{}] has [{}] entities with physics but no box or circle collider. "
+					 "Physics will not be initialized on them.",
+					 m_sSceneName,
+					 pStagedScene->numInvalidPhysics );
+	}
+
+	if ( auto* pSceneManagerData = registry.TryGetContext<std::shared_ptr<SceneManagerData>>() )
+	{
+		( *pSceneManagerData )->sSceneName = m_sSceneName;
+		( *pSceneManagerData )->sDefaultMusic = m_sDefaultMusic;
+	}
+
+	// Only keep the streams of the music the new scene uses open.
+	ASSET_MANAGER().UnloadIdleMusic( m_sDefaultMusic );
+
+	registry.DestroyEntities();
+
+	auto& from = pStagedScene->registry.GetRegistry();
+	auto& to = registry.GetRegistry();
+
+	m_PendingPhysics.clear();
+	m_NumPhysicsFinalized = 0;
+
+	// Entity ids are only unique per registry, so every id stored in a component is remapped.
+	for ( auto src : pStagedScene->entities )
+	{
+		const auto dst = registry.CreateEntity();
+		const auto dstID = static_cast<std::uint32_t>( dst );
+
+		if ( auto* pID = MoveComponent<Identification>( from, src, to, dst ) )
+			pID->entity_id = dstID;
+		if ( auto* pRelationship = MoveComponent<Relationship>( from, src, to, dst ) )
+			pRelationship->self = dst;
+		if ( auto* pTile = MoveComponent<TileComponent>( from, src, to, dst ) )
+			pTile->id = dstID;
+
+		MoveComponent<TransformComponent>( from, src, to, dst );
+		MoveComponent<SpriteComponent>( from, src, to, dst );
+		MoveComponent<BoxColliderComponent>( from, src, to, dst );
+		MoveComponent<CircleColliderComponent>( from, src, to, dst );
+		MoveComponent<AnimationComponent>( from, src, to, dst );
+		MoveComponent<TextComponent>( from, src, to, dst );
+		MoveComponent<UIComponent>( from, src, to, dst );
+		MoveComponent<ParticleEmitterComponent>( from, src, to, dst );
+
+		if ( auto* pPhysics = MoveComponent<PhysicsComponent>( from, src, to, dst ) )
+		{
+			pPhysics->GetChangableAttributes().objectData.entityID = static_cast<std::int32_t>( dst );
+			if ( to.any_of<BoxColliderComponent, CircleColliderComponent>( dst ) )
+				m_PendingPhysics.push_back( dst );
+		}
+	}
+}
+
+bool SceneStreamer::FinalizePhysics( ECS::Registry& registry, Clock::time_point deadline )
+{
+	if ( m_NumPhysicsFinalized >= m_PendingPhysics.size() )
+		return true;
+
+	auto* pPhysicsWorld = registry.TryGetContext<Scion::Physics::PhysicsWorld>();
+	auto* pCamera = registry.TryGetContext<std::shared_ptr<Scion::Rendering::Camera2D>>();
+	if ( !CORE_GLOBALS().IsPhysicsEnabled() || !pPhysicsWorld || !pCamera || !*pCamera )
+		return true;
+
+	auto& entt = registry.GetRegistry();
+	while ( m_NumPhysicsFinalized < m_PendingPhysics.size() )
+	{
+		const auto entity = m_PendingPhysics[ m_NumPhysicsFinalized++ ];
+
+		// Scripts run between the budgeted frames and can destroy the entity or create the body themselves.
+		auto* pPhysics = entt.valid( entity ) ? entt.try_get<PhysicsComponent>( entity ) : nullptr;
+		if ( pPhysics && !pPhysics->GetBody() )
+		{
+			pPhysics->Init( *pPhysicsWorld, ( *pCamera )->GetWidth(), ( *pCamera )->GetHeight() );
+
+			if ( pPhysics->UseFilters() )
+			{
+				pPhysics->SetFilterCategory();
+				pPhysics->SetFilterMask();
+				pPhysics->SetGroupIndex();
+			}
+		}
+
+		if ( Clock::now() >= deadline )
+			break;
+	}
+
+	return m_NumPhysicsFinalized >= m_PendingPhysics.size();
+}
+
+} // namespace Scion::Core
@@ -225,6 +225,30 @@ InputManager& InputManager::GetInstance()
 	return instance;
 }
 
+/*
+ * @brief Gets the keys for the bulk keyboard queries. The keys can either be passed in
+ * as separate arguments, Keyboard.pressedMask(KEY_A, KEY_D), or as a single array table.
+ */
+static std::vector<int> GetMaskKeys( const sol::variadic_args& args )
+{
+	std::vector<int> keys;
+	if ( args.size() == 1 && args[ 0 ].get_type() == sol::type::table )
+	{
+		sol::table keyTable = args[ 0 ];
+		keys.reserve( keyTable.size() );
+		for ( std::size_t i = 1; i <= keyTable.size(); ++i )
+			keys.push_back( keyTable.get_or( i, KEY_UNKNOWN ) );
+
+		return keys;
+	}
+
+	keys.reserve( args.size() );
+	for ( const auto& arg : args )
+		keys.push_back( arg.get_type() == sol::type::number ? arg.as<int>() : KEY_UNKNOWN );
+
+	return keys;
+}
+
 void InputManager::CreateLuaInputBindings( sol::state& lua, Scion::Core::ECS::Registry& registry )
 {
 	RegisterLuaKeyNames( lua );
@@ -245,15 +269,11 @@ void InputManager::CreateLuaInputBindings( sol::state& lua, Scion::Core::ECS::Re
 		"pressed",
 		[ & ]( int key ) { return keyboard.IsKeyPressed( key ); },
 		"pressedKeys",
-		[ & ]() {
-			std::vector<int> keys;
-			for ( const auto& [ key, button ] : keyboard.GetButtonMap() )
-			{
-				if ( button.bIsPressed )
-					keys.push_back( key );
-			}
-			return keys;
-		} );
+		[ & ]() { return keyboard.GetPressedKeys(); },
+		"pressedMask",
+		[ & ]( sol::variadic_args args ) { return keyboard.PressedMask( GetMaskKeys( args ) ); },
+		"justPressedMask",
+		[ & ]( sol::variadic_args args ) { return keyboard.PressedMask( GetMaskKeys( args ), true ); } );
 
 /*
  * In order for this to work in the editor, we need to take into account
@@ -400,6 +420,17 @@ std::shared_ptr<Gamepad> InputManager::GetController( int index )
 	return gamepadItr->second;
 }
 
+int InputManager::GetGamepadIndex( SDL_JoystickID joystickID ) const
+{
+	for ( const auto& [ index, gamepad ] : m_mapGameControllers )
+	{
+		if ( gamepad && gamepad->CheckJoystickID( joystickID ) )
+			return index;
+	}
+
+	return -1;
+}
+
 int InputManager::AddGamepad( Sint32 gamepadIndex )
 {
 	// Trying to add a controller with the same id.
@@ -464,6 +495,34 @@ int InputManager::RemoveGamepad( Sint32 gamepadID )
 	return index;
 }
 
+bool InputManager::AddVirtualGamepad( int index )
+{
+	if ( index < 1 || index > MAX_CONTROLLERS )
+	{
+		SCION_ERROR( "Failed to add virtual gamepad. Index [{}] is out of range.", index );
+		return false;
+	}
+
+	if ( m_mapGameControllers.contains( index ) )
+	{
+		SCION_WARN( "Trying to add a virtual gamepad at index [{}] that is already mapped.", index );
+		return false;
+	}
+
+	m_mapGameControllers.emplace( index, std::make_shared<Gamepad>() );
+	SCION_LOG( "Virtual gamepad was added at index [{}]", index );
+	return true;
+}
+
+bool InputManager::RemoveGamepadAt( int index )
+{
+	if ( m_mapGameControllers.erase( index ) == 0 )
+		return false;
+
+	SCION_LOG( "Gamepad at index [{}] was removed", index );
+	return true;
+}
+
 void InputManager::GamepadBtnPressed( const SDL_Event& event )
 {
 	for ( const auto& [ index, gamepad ] : m_mapGameControllers )
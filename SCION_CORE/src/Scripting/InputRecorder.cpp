@@ -0,0 +1,179 @@
+#include "Core/Scripting/InputRecorder.h"
+#include <Logger/Logger.h>
+
+#include <cstring>
+#include <fstream>
+
+namespace Scion::Core
+{
+namespace
+{
+constexpr char INPUT_RECORD_MAGIC[ 4 ]{ 'S', '2', 'D', 'I' };
+constexpr std::uint32_t INPUT_RECORD_VERSION{ 1 };
+
+struct InputRecordHeader
+{
+	char magic[ 4 ];
+	std::uint32_t version;
+	std::uint32_t numFrames;
+	std::uint32_t numRecords;
+	double fixedDeltaTime;
+};
+} // namespace
+
+InputRecorder::~InputRecorder()
+{
+	Stop();
+}
+
+bool InputRecorder::StartRecording( const std::string& sFilepath, double fixedDeltaTime )
+{
+	if ( m_eMode != EMode::Idle )
+	{
+		SCION_ERROR( "Failed to start recording input. A recording or replay is already in progress." );
+		return false;
+	}
+
+	if ( fixedDeltaTime <= 0.0 )
+	{
+		SCION_ERROR( "Failed to start recording input. Fixed delta time must be greater than zero." );
+		return false;
+	}
+
+	m_Records.clear();
+	m_sFilepath = sFilepath;
+	m_FixedDeltaTime = fixedDeltaTime;
+	m_CurrentFrame = 0;
+	m_NumFrames = 0;
+	m_eMode = EMode::Recording;
+
+	SCION_LOG( "Started recording input to [{}]", sFilepath );
+	return true;
+}
+
+bool InputRecorder::StartReplay( const std::string& sFilepath )
+{
+	if ( m_eMode != EMode::Idle )
+	{
+		SCION_ERROR( "Failed to start input replay. A recording or replay is already in progress." );
+		return false;
+	}
+
+	std::ifstream file{ sFilepath, std::ios::binary };
+	if ( !file )
+	{
+		SCION_ERROR( "Failed to start input replay. Could not open [{}]", sFilepath );
+		return false;
+	}
+
+	InputRecordHeader header{};
+	if ( !file.read( reinterpret_cast<char*>( &header ), sizeof( InputRecordHeader ) ) ||
+		 std::memcmp( header.magic, INPUT_RECORD_MAGIC, sizeof( INPUT_RECORD_MAGIC ) ) != 0 )
+	{
+		SCION_ERROR( "Failed to start input replay. [{}] is not an input recording.", sFilepath );
+		return false;
+	}
+
+	if ( header.version != INPUT_RECORD_VERSION )
+	{
+		SCION_ERROR( "Failed to start input replay. Unsupported version [{}]", header.version );
+		return false;
+	}
+
+	m_Records.resize( header.numRecords );
+	if ( !file.read( reinterpret_cast<char*>( m_Records.data() ), header.numRecords * sizeof( InputRecord ) ) )
+	{
+		SCION_ERROR( "Failed to start input replay. [{}] is truncated.", sFilepath );
+		m_Records.clear();
+		return false;
+	}
+
+	m_sFilepath = sFilepath;
+	m_FixedDeltaTime = header.fixedDeltaTime;
+	m_NumFrames = header.numFrames;
+	m_CurrentFrame = 0;
+	m_ReplayIndex = 0;
+	m_eMode = EMode::Replaying;
+
+	SCION_LOG( "Replaying [{}] frames of input from [{}]", m_NumFrames, sFilepath );
+	return true;
+}
+
+bool InputRecorder::Stop()
+{
+	bool bSuccess{ true };
+	if ( m_eMode == EMode::Recording )
+	{
+		m_NumFrames = m_CurrentFrame;
+		bSuccess = WriteRecords();
+	}
+
+	m_Records.clear();
+	m_eMode = EMode::Idle;
+	return bSuccess;
+}
+
+void InputRecorder::Record( EInputRecordType eType, std::int32_t value, std::int16_t value2, std::uint8_t device )
+{
+	if ( m_eMode != EMode::Recording )
+		return;
+
+	m_Records.emplace_back(
+		InputRecord{ .frame = m_CurrentFrame, .value = value, .value2 = value2, .eType = eType, .device = device } );
+}
+
+std::span<const InputRecord> InputRecorder::GetFrameRecords() const
+{
+	if ( m_eMode != EMode::Replaying )
+		return {};
+
+	std::size_t end = m_ReplayIndex;
+	while ( end < m_Records.size() && m_Records[ end ].frame == m_CurrentFrame )
+		++end;
+
+	return std::span<const InputRecord>{ m_Records.data() + m_ReplayIndex, end - m_ReplayIndex };
+}
+
+void InputRecorder::NextFrame()
+{
+	if ( m_eMode == EMode::Replaying )
+	{
+		// Records are stored in frame order, skip past the ones for this frame.
+		while ( m_ReplayIndex < m_Records.size() && m_Records[ m_ReplayIndex ].frame <= m_CurrentFrame )
+			++m_ReplayIndex;
+	}
+
+	if ( m_eMode != EMode::Idle )
+		++m_CurrentFrame;
+}
+
+bool InputRecorder::WriteRecords()
+{
+	std::ofstream file{ m_sFilepath, std::ios::binary | std::ios::trunc };
+	if ( !file )
+	{
+		SCION_ERROR( "Failed to write input recording. Could not open [{}]", m_sFilepath );
+		return false;
+	}
+
+	InputRecordHeader header{ .magic = {},
+							  .version = INPUT_RECORD_VERSION,
+							  .numFrames = m_NumFrames,
+							  .numRecords = static_cast<std::uint32_t>( m_Records.size() ),
+							  .fixedDeltaTime = m_FixedDeltaTime };
+	std::memcpy( header.magic, INPUT_RECORD_MAGIC, sizeof( INPUT_RECORD_MAGIC ) );
+
+	file.write( reinterpret_cast<const char*>( &header ), sizeof( InputRecordHeader ) );
+	file.write( reinterpret_cast<const char*>( m_Records.data() ), m_Records.size() * sizeof( InputRecord ) );
+
+	if ( !file )
+	{
+		SCION_ERROR( "Failed to write input recording to [{}]", m_sFilepath );
+		return false;
+	}
+
+	SCION_LOG( "Wrote [{}] input records over [{}] frames to [{}]", m_Records.size(), m_NumFrames, m_sFilepath );
+	return true;
+}
+
+} // namespace Scion::Core
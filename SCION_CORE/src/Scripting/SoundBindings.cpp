@@ -2,13 +2,46 @@
 #include "Core/ECS/Registry.h"
 #include "Core/ECS/MainRegistry.h"
 #include "Core/Resources/AssetManager.h"
+#include "Core/ECS/Entity.h"
+#include "Core/Systems/AudioSystem.h"
 #include <Sounds/MusicPlayer/MusicPlayer.h>
 #include <Sounds/SoundPlayer/SoundFxPlayer.h>
+#include <Sounds/Essentials/SoundFX.h>
+#include <Sounds/Mixer/SoftwareMixer.h>
 #include <Logger/Logger.h>
 
 using namespace Scion::Sounds;
 using namespace SCION_RESOURCES;
 
+namespace
+{
+Scion::Sounds::MixerVoiceID PlayOnMixer( const std::string& soundName, const MixerVoiceParams& params )
+{
+	auto pSoundFx = ASSET_MANAGER().GetSoundFx( soundName );
+	if ( !pSoundFx )
+	{
+		SCION_ERROR( "Failed to get [{}] from the Asset Manager", soundName );
+		return INVALID_MIXER_VOICE;
+	}
+
+	return MAIN_REGISTRY().GetSoftwareMixer().Play( pSoundFx->GetPCMBuffer(), params );
+}
+
+/* @brief Changes one of the params of a playing voice, keeping the rest. */
+template <typename TFunc>
+void ChangeMixerParams( Scion::Sounds::MixerVoiceID voiceId, TFunc&& func )
+{
+	auto& softwareMixer = MAIN_REGISTRY().GetSoftwareMixer();
+	const auto* pParams = softwareMixer.GetParams( voiceId );
+	if ( !pParams )
+		return;
+
+	auto params = *pParams;
+	func( params );
+	softwareMixer.SetParams( voiceId, params );
+}
+} // namespace
+
 void Scion::Core::Scripting::SoundBinder::CreateSoundBind( sol::state& lua )
 {
 	auto& mainRegistry = MAIN_REGISTRY();
@@ -84,5 +117,83 @@ void Scion::Core::Scripting::SoundBinder::CreateSoundBind( sol::state& lua )
 		"setVolume",
 		[ & ]( int channel, int volume ) { soundFxPlayer.SetVolume( channel, volume ); },
 		"isPlaying",
-		[ & ]( int channel ) { return soundFxPlayer.IsPlaying( channel ); } );
+		[ & ]( int channel ) { return soundFxPlayer.IsPlaying( channel ); },
+		"setPriority",
+		[ & ]( const std::string& soundName, int priority ) {
+			auto pSoundFx = assetManager.GetSoundFx( soundName );
+			if ( !pSoundFx )
+			{
+				SCION_ERROR( "Failed to get [{}] from the Asset Manager", soundName );
+				return;
+			}
+
+			pSoundFx->SetPriority( priority );
+		},
+		"setMaxInstances",
+		[ & ]( const std::string& soundName, int maxInstances ) {
+			auto pSoundFx = assetManager.GetSoundFx( soundName );
+			if ( !pSoundFx )
+			{
+				SCION_ERROR( "Failed to get [{}] from the Asset Manager", soundName );
+				return;
+			}
+
+			pSoundFx->SetMaxInstances( maxInstances );
+		} );
+
+	// Create the SoftwareMixer Bindings
+	auto& softwareMixer = mainRegistry.GetSoftwareMixer();
+	auto& audioSystem = mainRegistry.GetAudioSystem();
+
+	lua.new_usertype<SoftwareMixer>(
+		"Mixer",
+		sol::no_constructor,
+		"play",
+		sol::overload(
+			[]( const std::string& soundName ) { return PlayOnMixer( soundName, MixerVoiceParams{} ); },
+			[]( const std::string& soundName, int loops ) {
+				return PlayOnMixer( soundName, MixerVoiceParams{ .loops = loops } );
+			} ),
+		"playAt",
+		sol::overload(
+			[]( const std::string& soundName, float x, float y ) {
+				return PlayOnMixer( soundName, MixerVoiceParams{ .bPositional = true, .x = x, .y = y } );
+			},
+			[]( const std::string& soundName, float x, float y, int loops ) {
+				return PlayOnMixer( soundName,
+									MixerVoiceParams{ .bPositional = true, .x = x, .y = y, .loops = loops } );
+			} ),
+		"stop",
+		[ & ]( MixerVoiceID voiceId ) { softwareMixer.Stop( voiceId ); },
+		"stopAll",
+		[ & ]() { softwareMixer.StopAll(); },
+		"isPlaying",
+		[ & ]( MixerVoiceID voiceId ) { return softwareMixer.IsPlaying( voiceId ); },
+		"setGain",
+		[]( MixerVoiceID voiceId, float gain ) {
+			ChangeMixerParams( voiceId, [ gain ]( MixerVoiceParams& params ) { params.gain = std::max( gain, 0.f ); } );
+		},
+		"setPan",
+		[]( MixerVoiceID voiceId, float pan ) {
+			ChangeMixerParams( voiceId, [ pan ]( MixerVoiceParams& params ) { params.pan = pan; } );
+		},
+		"setPosition",
+		[]( MixerVoiceID voiceId, float x, float y ) {
+			ChangeMixerParams( voiceId, [ x, y ]( MixerVoiceParams& params ) {
+				params.bPositional = true;
+				params.x = x;
+				params.y = y;
+			} );
+		},
+		"setDistance",
+		[]( MixerVoiceID voiceId, float minDistance, float maxDistance ) {
+			ChangeMixerParams( voiceId, [ minDistance, maxDistance ]( MixerVoiceParams& params ) {
+				params.minDistance = minDistance;
+				params.maxDistance = maxDistance;
+			} );
+		},
+		"setListenerEntity",
+		[ & ]( Scion::Core::ECS::Entity& entity ) { audioSystem.SetListenerEntity( entity.GetEntity() ); },
+		"clearListenerEntity",
+		[ & ]() { audioSystem.SetListenerEntity( entt::null ); } );
 }
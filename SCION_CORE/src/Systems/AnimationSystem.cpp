@@ -1,73 +1,131 @@
 #include "Core/Systems/AnimationSystem.h"
 #include "Core/ECS/Components/AnimationComponent.h"
 #include "Core/ECS/Components/SpriteComponent.h"
-#include "Core/ECS/Components/TransformComponent.h"
-#include "Core/CoreUtilities/CoreUtilities.h"
+#include "Core/ECS/Components/UIComponent.h"
+#include "Core/ECS/Components/DormantComponent.h"
+#include "Core/CoreUtilities/CoreEngineData.h"
 #include "Core/ECS/Registry.h"
 
 #include "Logger/Logger.h"
+#include "ScionUtilities/Profiler.h"
 
-#include <SDL.h>
+#include <algorithm>
 
 using namespace Scion::Core::ECS;
-using namespace Scion::Rendering;
 
 namespace Scion::Core::Systems
 {
+namespace
+{
+bool FrameTableMatches( const AnimationFrameTable& table, const AnimationComponent& animation,
+						const SpriteComponent& sprite )
+{
+	return table.numFrames == animation.numFrames && table.bVertical == animation.bVertical &&
+		   table.startX == sprite.start_x && table.startY == sprite.start_y && table.uvWidth == sprite.uvs.uv_width &&
+		   table.uvHeight == sprite.uvs.uv_height;
+}
+} // namespace
 
-void AnimationSystem::Update( Scion::Core::ECS::Registry& registry, Scion::Rendering::Camera2D& camera )
+void AnimationSystem::Update( Scion::Core::ECS::Registry& registry, double deltaTime )
 {
-	auto view = registry.GetRegistry().view<AnimationComponent, SpriteComponent, TransformComponent>();
+	SCION_PROFILE_SCOPE( "AnimationSystem::Update" );
+
+	auto view = registry.GetRegistry().view<AnimationComponent, SpriteComponent>( entt::exclude<DormantComponent> );
 	if ( view.size_hint() < 1 )
 		return;
 
+	const float dt = static_cast<float>( deltaTime );
+
 	for ( auto entity : view )
 	{
-		const auto& transform = view.get<TransformComponent>( entity );
 		auto& sprite = view.get<SpriteComponent>( entity );
 		auto& animation = view.get<AnimationComponent>( entity );
 
-		// We don't want to check if entities with UIComponents are out of the camera.
-		// Since they use a different camera.
-		if ( !registry.GetRegistry().all_of<UIComponent>( entity ) &&
-			 !Scion::Core::EntityInView( transform, sprite.width, sprite.height, camera ) )
+		// The visibility system has already tested the sprite against the camera.
+		// UI sprites are never culled, since they use a different camera.
+		if ( !sprite.bInView && !registry.GetRegistry().all_of<UIComponent>( entity ) )
 			continue;
 
-		if ( animation.numFrames <= 0 )
+		if ( animation.numFrames <= 0 || animation.frameRate <= 0 )
 			continue;
 
-		// if we are not looped and the current from == num frames, skip
-		if ( !animation.bLooped && animation.currentFrame >= animation.numFrames - 1 )
-			continue;
+		if ( !animation.pFrameTable || !FrameTableMatches( *animation.pFrameTable, animation, sprite ) )
+			animation.pFrameTable = GetFrameTable( animation, sprite );
+
+		if ( !animation.bPaused )
+		{
+			animation.frameTime += dt * animation.timeScale;
+
+			const float frameDuration = 1.f / static_cast<float>( animation.frameRate );
+			if ( animation.frameTime >= frameDuration )
+			{
+				const int numSteps = static_cast<int>( animation.frameTime * animation.frameRate );
+				animation.frameTime -= numSteps * frameDuration;
+
+				animation.currentFrame = animation.bLooped
+											 ? ( animation.currentFrame + numSteps ) % animation.numFrames
+											 : std::min( animation.currentFrame + numSteps, animation.numFrames - 1 );
+			}
+		}
+
+		// Scripts can set the current frame directly.
+		animation.currentFrame = std::clamp( animation.currentFrame, 0, animation.numFrames - 1 );
 
-		// Get the current frame
-		animation.currentFrame =
-			( ( SDL_GetTicks() - animation.startTime ) * animation.frameRate / 1000 ) % animation.numFrames;
+		const auto& frameUVs = animation.pFrameTable->uvs[ animation.currentFrame ];
+		sprite.uvs.u = frameUVs.x;
+		sprite.uvs.v = frameUVs.y;
+	}
+}
+
+std::shared_ptr<const AnimationFrameTable> AnimationSystem::GetFrameTable( const AnimationComponent& animation,
+																		   const SpriteComponent& sprite )
+{
+	const FrameTableKey key{ animation.numFrames,
+							 animation.bVertical,
+							 sprite.start_x,
+							 sprite.start_y,
+							 sprite.uvs.uv_width,
+							 sprite.uvs.uv_height };
+
+	if ( auto tableItr = m_mapFrameTables.find( key ); tableItr != m_mapFrameTables.end() )
+	{
+		if ( auto pTable = tableItr->second.lock() )
+			return pTable;
+	}
+
+	auto pTable = std::make_shared<AnimationFrameTable>( AnimationFrameTable{ .numFrames = animation.numFrames,
+																			  .bVertical = animation.bVertical,
+																			  .startX = sprite.start_x,
+																			  .startY = sprite.start_y,
+																			  .uvWidth = sprite.uvs.uv_width,
+																			  .uvHeight = sprite.uvs.uv_height } );
 
+	pTable->uvs.reserve( animation.numFrames );
+	for ( int frame = 0; frame < animation.numFrames; ++frame )
+	{
 		if ( animation.bVertical )
 		{
-			sprite.uvs.v = (animation.currentFrame + sprite.start_y) * sprite.uvs.uv_height;
-			sprite.uvs.u = sprite.start_x * sprite.uvs.uv_width;
+			pTable->uvs.emplace_back( sprite.start_x * sprite.uvs.uv_width,
+									  ( frame + sprite.start_y ) * sprite.uvs.uv_height );
 		}
 		else
 		{
-			sprite.uvs.u = ( ( animation.currentFrame + sprite.start_x ) * sprite.uvs.uv_width );
-			sprite.uvs.v = sprite.start_y * sprite.uvs.uv_height;
+			pTable->uvs.emplace_back( ( frame + sprite.start_x ) * sprite.uvs.uv_width,
+									  sprite.start_y * sprite.uvs.uv_height );
 		}
 	}
+
+	m_mapFrameTables[ key ] = pTable;
+	return pTable;
 }
 
 void AnimationSystem::CreateAnimationSystemLuaBind( sol::state& lua, Scion::Core::ECS::Registry& registry )
 {
-	auto& pCamera = registry.GetContext<std::shared_ptr<Camera2D>>();
-
-	SCION_ASSERT( pCamera && "A camera must exist in the current scene!" );
-
 	lua.new_usertype<AnimationSystem>(
 		"AnimationSystem",
 		sol::call_constructor,
 		sol::constructors<AnimationSystem()>(),
 		"update",
-		[ & ]( AnimationSystem& system, Registry& reg ) { system.Update( reg, *pCamera ); } );
+		[]( AnimationSystem& system, Registry& reg ) { system.Update( reg, CORE_GLOBALS().GetDeltaTime() ); } );
 }
 } // namespace Scion::Core::Systems
@@ -0,0 +1,45 @@
+#include "Core/Systems/AudioSystem.h"
+#include "Core/ECS/Components/TransformComponent.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Core/ECS/Registry.h"
+#include "Rendering/Core/Camera2D.h"
+#include <Sounds/Mixer/SoftwareMixer.h>
+
+#include "ScionUtilities/Profiler.h"
+
+using namespace Scion::Core::ECS;
+
+namespace Scion::Core::Systems
+{
+AudioSystem::AudioSystem()
+	: m_ListenerEntity{ entt::null }
+{
+}
+
+void AudioSystem::Update( Scion::Core::ECS::Registry& registry, const Scion::Rendering::Camera2D& camera )
+{
+	SCION_PROFILE_SCOPE( "AudioSystem::Update" );
+
+	auto& softwareMixer = MAIN_REGISTRY().GetSoftwareMixer();
+	auto& enttRegistry = registry.GetRegistry();
+
+	if ( enttRegistry.valid( m_ListenerEntity ) )
+	{
+		if ( const auto* pTransform = enttRegistry.try_get<TransformComponent>( m_ListenerEntity ) )
+		{
+			softwareMixer.SetListener( pTransform->position.x, pTransform->position.y );
+			softwareMixer.Update();
+			return;
+		}
+	}
+
+	// The same view the visibility system culls against, so sounds in view are the ones heard the loudest.
+	const float invCameraScale = 1.f / camera.GetScale();
+	const glm::vec2 cameraPos = camera.GetPosition() - camera.GetScreenOffset();
+	const glm::vec2 cameraCenter{ ( cameraPos.x + camera.GetWidth() * 0.5f ) * invCameraScale,
+								  ( cameraPos.y + camera.GetHeight() * 0.5f ) * invCameraScale };
+
+	softwareMixer.SetListener( cameraCenter.x, cameraCenter.y );
+	softwareMixer.Update();
+}
+} // namespace Scion::Core::Systems
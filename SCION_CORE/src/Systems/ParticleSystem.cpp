@@ -0,0 +1,224 @@
+#include "Core/Systems/ParticleSystem.h"
+#include "Core/ECS/Components/ParticleEmitterComponent.h"
+#include "Core/ECS/Components/TransformComponent.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Core/Resources/AssetManager.h"
+#include <Rendering/Core/Camera2D.h>
+#include <Rendering/Core/ParticleBatchRenderer.h>
+#include <Rendering/Essentials/Shader.h>
+#include <Rendering/Essentials/Texture.h>
+
+#include <Logger/Logger.h>
+#include <ScionUtilities/Profiler.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Scion::Core::ECS;
+using namespace Scion::Rendering;
+
+namespace Scion::Core::Systems
+{
+ParticleSystem::ParticleSystem()
+	: m_pBatchRenderer{ std::make_unique<ParticleBatchRenderer>() }
+	, m_RandomEngine{ std::random_device{}() }
+	, m_Distribution{ 0.f, 1.f }
+{
+}
+
+ParticleSystem::~ParticleSystem() = default;
+
+void ParticleSystem::Update( Scion::Core::ECS::Registry& registry, double deltaTime )
+{
+	SCION_PROFILE_SCOPE( "ParticleSystem::Update" );
+
+	const float dt = static_cast<float>( deltaTime );
+
+	auto view = registry.GetRegistry().view<ParticleEmitterComponent, TransformComponent>();
+	for ( auto entity : view )
+	{
+		auto& emitter = view.get<ParticleEmitterComponent>( entity );
+		const auto& transform = view.get<TransformComponent>( entity );
+
+		const auto capacity = static_cast<std::size_t>( std::max( emitter.maxParticles, 0 ) );
+		if ( emitter.particles.Capacity() != capacity )
+			emitter.particles.Resize( capacity );
+
+		Simulate( emitter, dt );
+		RemoveExpired( emitter );
+		Emit( emitter, transform.position, dt );
+		UpdateAppearance( emitter );
+	}
+}
+
+void ParticleSystem::Render( Scion::Core::ECS::Registry& registry, Scion::Rendering::Camera2D& camera )
+{
+	SCION_PROFILE_SCOPE( "ParticleSystem::Render" );
+
+	auto view = registry.GetRegistry().view<ParticleEmitterComponent>();
+	if ( view.empty() )
+		return;
+
+	auto& assetManager = MAIN_REGISTRY().GetAssetManager();
+	auto pShader = assetManager.GetShader( "particle" );
+	if ( !pShader || pShader->ShaderProgramID() == 0 )
+	{
+		SCION_ERROR( "Particle shader program has not been set correctly!" );
+		return;
+	}
+
+	pShader->Enable();
+	pShader->SetUniformMat4( "uProjection", camera.GetCameraMatrix() );
+
+	m_pBatchRenderer->Begin();
+
+	for ( auto entity : view )
+	{
+		const auto& emitter = view.get<ParticleEmitterComponent>( entity );
+		const auto& particles = emitter.particles;
+		if ( emitter.bHidden || particles.numAlive == 0 )
+			continue;
+
+		GLuint textureID{ 0 };
+		if ( !emitter.sTextureName.empty() )
+		{
+			const auto pTexture = assetManager.GetTexture( emitter.sTextureName );
+			if ( !pTexture )
+			{
+				SCION_ERROR( "Texture [{}] was not created correctly!", emitter.sTextureName );
+				continue;
+			}
+
+			textureID = pTexture->GetID();
+		}
+
+		m_pBatchRenderer->AddParticles( particles.positionsX.data(),
+										particles.positionsY.data(),
+										particles.sizes.data(),
+										particles.colors.data(),
+										particles.numAlive,
+										textureID );
+	}
+
+	m_pBatchRenderer->End();
+	m_pBatchRenderer->Render();
+
+	pShader->Disable();
+}
+
+void ParticleSystem::Emit( ParticleEmitterComponent& emitter, const glm::vec2& position, float deltaTime )
+{
+	auto& particles = emitter.particles;
+
+	if ( emitter.bEmitting )
+		particles.emitAccumulator += emitter.emitRate * deltaTime;
+
+	const float numWhole = std::floor( particles.emitAccumulator );
+	particles.emitAccumulator -= numWhole;
+
+	const std::size_t numRequested =
+		static_cast<std::size_t>( numWhole ) + static_cast<std::size_t>( std::max( emitter.pendingBurst, 0 ) );
+	emitter.pendingBurst = 0;
+
+	const std::size_t numToEmit = std::min( numRequested, particles.Capacity() - particles.numAlive );
+	if ( numToEmit == 0 )
+		return;
+
+	const glm::vec2 origin = position + emitter.spawnOffset;
+	const glm::vec2 velocityRange = emitter.maxVelocity - emitter.minVelocity;
+	const float lifetimeRange = emitter.maxLifetime - emitter.minLifetime;
+
+	const std::size_t first = particles.numAlive;
+	const std::size_t last = first + numToEmit;
+	for ( std::size_t i = first; i < last; ++i )
+	{
+		particles.positionsX[ i ] = origin.x + Random() * emitter.spawnArea.x;
+		particles.positionsY[ i ] = origin.y + Random() * emitter.spawnArea.y;
+		particles.velocitiesX[ i ] = emitter.minVelocity.x + Random() * velocityRange.x;
+		particles.velocitiesY[ i ] = emitter.minVelocity.y + Random() * velocityRange.y;
+		particles.ages[ i ] = 0.f;
+		particles.invLifetimes[ i ] = 1.f / std::max( emitter.minLifetime + Random() * lifetimeRange, 0.001f );
+	}
+
+	particles.numAlive = last;
+}
+
+void ParticleSystem::Simulate( ParticleEmitterComponent& emitter, float deltaTime )
+{
+	auto& particles = emitter.particles;
+	const std::size_t numAlive = particles.numAlive;
+
+	float* __restrict pPositionsX = particles.positionsX.data();
+	float* __restrict pPositionsY = particles.positionsY.data();
+	float* __restrict pVelocitiesX = particles.velocitiesX.data();
+	float* __restrict pVelocitiesY = particles.velocitiesY.data();
+	float* __restrict pAges = particles.ages.data();
+
+	const float accelerationX = emitter.acceleration.x * deltaTime;
+	const float accelerationY = emitter.acceleration.y * deltaTime;
+
+	for ( std::size_t i = 0; i < numAlive; ++i )
+	{
+		pVelocitiesX[ i ] += accelerationX;
+		pVelocitiesY[ i ] += accelerationY;
+		pPositionsX[ i ] += pVelocitiesX[ i ] * deltaTime;
+		pPositionsY[ i ] += pVelocitiesY[ i ] * deltaTime;
+	}
+
+	for ( std::size_t i = 0; i < numAlive; ++i )
+		pAges[ i ] += deltaTime;
+}
+
+void ParticleSystem::RemoveExpired( ParticleEmitterComponent& emitter )
+{
+	auto& particles = emitter.particles;
+
+	// Move the last live particle into the slot of the expired one, so the live particles stay packed.
+	std::size_t i{ 0 };
+	while ( i < particles.numAlive )
+	{
+		if ( particles.ages[ i ] * particles.invLifetimes[ i ] < 1.f )
+		{
+			++i;
+			continue;
+		}
+
+		const std::size_t last = --particles.numAlive;
+		particles.positionsX[ i ] = particles.positionsX[ last ];
+		particles.positionsY[ i ] = particles.positionsY[ last ];
+		particles.velocitiesX[ i ] = particles.velocitiesX[ last ];
+		particles.velocitiesY[ i ] = particles.velocitiesY[ last ];
+		particles.ages[ i ] = particles.ages[ last ];
+		particles.invLifetimes[ i ] = particles.invLifetimes[ last ];
+	}
+}
+
+void ParticleSystem::UpdateAppearance( ParticleEmitterComponent& emitter )
+{
+	auto& particles = emitter.particles;
+	const std::size_t numAlive = particles.numAlive;
+
+	const float* __restrict pAges = particles.ages.data();
+	const float* __restrict pInvLifetimes = particles.invLifetimes.data();
+	float* __restrict pSizes = particles.sizes.data();
+	Color* __restrict pColors = particles.colors.data();
+
+	const float startSize = emitter.startSize;
+	const float sizeRange = emitter.endSize - emitter.startSize;
+
+	const glm::vec4 startColor{ emitter.startColor.r, emitter.startColor.g, emitter.startColor.b, emitter.startColor.a };
+	const glm::vec4 colorRange =
+		glm::vec4{ emitter.endColor.r, emitter.endColor.g, emitter.endColor.b, emitter.endColor.a } - startColor;
+
+	for ( std::size_t i = 0; i < numAlive; ++i )
+	{
+		const float t = std::min( pAges[ i ] * pInvLifetimes[ i ], 1.f );
+		pSizes[ i ] = startSize + sizeRange * t;
+		pColors[ i ] = Color{ .r = static_cast<GLubyte>( startColor.r + colorRange.r * t ),
+							  .g = static_cast<GLubyte>( startColor.g + colorRange.g * t ),
+							  .b = static_cast<GLubyte>( startColor.b + colorRange.b * t ),
+							  .a = static_cast<GLubyte>( startColor.a + colorRange.a * t ) };
+	}
+}
+
+} // namespace Scion::Core::Systems
@@ -6,6 +6,7 @@
 #include "Core/ECS/Components/PhysicsComponent.h"
 #include "Core/CoreUtilities/CoreEngineData.h"
 #include <Logger/Logger.h>
+#include <ScionUtilities/Profiler.h>
 
 using namespace Scion::Core::ECS;
 
@@ -18,6 +19,8 @@ PhysicsSystem::PhysicsSystem()
 
 void PhysicsSystem::Update( Scion::Core::ECS::Registry& registry )
 {
+	SCION_PROFILE_SCOPE( "PhysicsSystem::Update" );
+
 	auto boxView = registry.GetRegistry().view<PhysicsComponent, TransformComponent, BoxColliderComponent>();
 	auto& coreEngine = CoreEngineData::GetInstance();
 
@@ -1,4 +1,5 @@
 #include "Core/Systems/RenderPickingSystem.h"
+#include "Core/Systems/VisibilitySystem.h"
 #include "Core/Resources/AssetManager.h"
 #include "Core/ECS/Components/SpriteComponent.h"
 #include "Core/ECS/Components/TransformComponent.h"
@@ -10,6 +11,7 @@
 #include "Rendering/Essentials/Texture.h"
 #include "Rendering/Essentials/Shader.h"
 #include "Logger/Logger.h"
+#include "ScionUtilities/Profiler.h"
 
 using namespace Scion::Rendering;
 using namespace Scion::Core::ECS;
@@ -27,6 +29,8 @@ RenderPickingSystem::~RenderPickingSystem()
 
 void RenderPickingSystem::Update( Scion::Core::ECS::Registry& registry, Scion::Rendering::Camera2D& camera )
 {
+	SCION_PROFILE_SCOPE( "RenderPickingSystem::Update" );
+
 	auto& mainRegistry = MAIN_REGISTRY();
 	auto& assetManager = mainRegistry.GetAssetManager();
 
@@ -44,15 +48,17 @@ void RenderPickingSystem::Update( Scion::Core::ECS::Registry& registry, Scion::R
 	pickingShader->SetUniformMat4( "uProjection", cam_mat );
 
 	m_pBatchRenderer->Begin();
-	auto spriteView = registry.GetRegistry().view<SpriteComponent, TransformComponent>(entt::exclude<TileComponent>);
-	for ( auto entity : spriteView )
-	{
-		const auto& transform = spriteView.get<TransformComponent>( entity );
-		const auto& sprite = spriteView.get<SpriteComponent>( entity );
+	auto& reg = registry.GetRegistry();
 
-		if ( !Scion::Core::EntityInView( transform, sprite.width, sprite.height, camera ) )
+	// The sprites have already been culled by the visibility system.
+	for ( auto entity : VisibilitySystem::GetVisibleEntities( registry ) )
+	{
+		if ( reg.all_of<TileComponent>( entity ) )
 			continue;
 
+		const auto& transform = reg.get<TransformComponent>( entity );
+		const auto& sprite = reg.get<SpriteComponent>( entity );
+
 		if ( sprite.sTextureName.empty() || sprite.bHidden )
 			continue;
 
@@ -4,6 +4,7 @@
 #include "Core/ECS/Components/CircleColliderComponent.h"
 #include "Core/ECS/Components/TransformComponent.h"
 #include "Core/ECS/Components/PhysicsComponent.h"
+#include "Core/ECS/Components/DormantComponent.h"
 #include "Core/ECS/MainRegistry.h"
 #include "Core/Resources/AssetManager.h"
 #include "Core/CoreUtilities/CoreEngineData.h"
@@ -16,6 +17,7 @@
 #include <Rendering/Core/CircleBatchRenderer.h>
 
 #include "ScionUtilities/MathUtilities.h"
+#include "ScionUtilities/Profiler.h"
 
 using namespace Scion::Core::ECS;
 using namespace Scion::Rendering;
@@ -32,6 +34,8 @@ RenderShapeSystem::RenderShapeSystem()
 
 void RenderShapeSystem::Update( Scion::Core::ECS::Registry& registry, Scion::Rendering::Camera2D& camera )
 {
+	SCION_PROFILE_SCOPE( "RenderShapeSystem::Update" );
+
 	auto& assetManager = MAIN_REGISTRY().GetAssetManager();
 
 	auto colorShader = assetManager.GetShader( "color" );
@@ -41,7 +45,8 @@ void RenderShapeSystem::Update( Scion::Core::ECS::Registry& registry, Scion::Ren
 	colorShader->SetUniformMat4( "uProjection", cam_mat );
 	m_pRectRenderer->Begin();
 
-	auto boxView = registry.GetRegistry().view<TransformComponent, BoxColliderComponent>();
+	auto boxView =
+		registry.GetRegistry().view<TransformComponent, BoxColliderComponent>( entt::exclude<DormantComponent> );
 	for ( auto entity : boxView )
 	{
 		const auto& transform = boxView.get<TransformComponent>( entity );
@@ -106,7 +111,8 @@ void RenderShapeSystem::Update( Scion::Core::ECS::Registry& registry, Scion::Ren
 	circleShader->SetUniformMat4( "uProjection", cam_mat );
 	m_pCircleRenderer->Begin();
 
-	auto circleView = registry.GetRegistry().view<TransformComponent, CircleColliderComponent>();
+	auto circleView =
+		registry.GetRegistry().view<TransformComponent, CircleColliderComponent>( entt::exclude<DormantComponent> );
 	for ( auto entity : circleView )
 	{
 		const auto& transform = circleView.get<TransformComponent>( entity );
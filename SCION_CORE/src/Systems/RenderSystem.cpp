@@ -1,4 +1,5 @@
 #include "Core/Systems/RenderSystem.h"
+#include "Core/Systems/VisibilitySystem.h"
 #include "Core/Resources/AssetManager.h"
 #include "Core/ECS/Components/AllComponents.h"
 #include "Core/ECS/MainRegistry.h"
@@ -11,6 +12,7 @@
 #include "ScionUtilities/HelperUtilities.h"
 
 #include <Logger/Logger.h>
+#include <ScionUtilities/Profiler.h>
 
 #include <ranges>
 
@@ -29,6 +31,8 @@ RenderSystem::~RenderSystem() = default;
 
 void RenderSystem::Update( Scion::Core::ECS::Registry& registry, Scion::Rendering::Camera2D& camera )
 {
+	SCION_PROFILE_SCOPE( "RenderSystem::Update" );
+
 	auto& mainRegistry = MAIN_REGISTRY();
 	auto& assetManager = mainRegistry.GetAssetManager();
 
@@ -47,16 +51,17 @@ void RenderSystem::Update( Scion::Core::ECS::Registry& registry, Scion::Renderin
 
 	m_pBatchRenderer->Begin();
 
-	auto spriteView = registry.GetRegistry().view<SpriteComponent, TransformComponent>( entt::exclude<UIComponent> );
+	auto& reg = registry.GetRegistry();
 
-	for ( const auto entity : spriteView )
+	// The sprites have already been culled by the visibility system.
+	for ( const auto entity : VisibilitySystem::GetVisibleEntities( registry ) )
 	{
-		const auto& transform = spriteView.get<TransformComponent>( entity );
-		const auto& sprite = spriteView.get<SpriteComponent>( entity );
-
-		if ( !Scion::Core::EntityInView( transform, sprite.width, sprite.height, camera ) )
+		if ( reg.all_of<UIComponent>( entity ) )
 			continue;
 
+		const auto& transform = reg.get<TransformComponent>( entity );
+		const auto& sprite = reg.get<SpriteComponent>( entity );
+
 		if ( sprite.sTextureName.empty() || sprite.bHidden )
 			continue;
 
@@ -105,7 +110,10 @@ void RenderSystem::CreateRenderSystemLuaBind( sol::state& lua, Scion::Core::ECS:
 									sol::call_constructor,
 									sol::constructors<RenderSystem()>(),
 									"update",
-									[ & ]( RenderSystem& system, Registry& reg ) { system.Update( reg, *pCamera ); } );
+									[ & ]( RenderSystem& system, Registry& reg ) {
+										MAIN_REGISTRY().GetVisibilitySystem().Update( reg, *pCamera );
+										system.Update( reg, *pCamera );
+									} );
 }
 
 } // namespace Scion::Core::Systems
@@ -15,6 +15,7 @@
 #include <Rendering/Core/Camera2D.h>
 
 #include <Logger/Logger.h>
+#include <ScionUtilities/Profiler.h>
 
 using namespace Scion::Core::ECS;
 using namespace SCION_RESOURCES;
@@ -25,6 +26,7 @@ namespace Scion::Core::Systems
 RenderUISystem::RenderUISystem()
 	: m_pSpriteRenderer{ std::make_unique<Scion::Rendering::SpriteBatchRenderer>() }
 	, m_pTextRenderer{ std::make_unique<Scion::Rendering::TextBatchRenderer>() }
+	, m_pSDFTextRenderer{ std::make_unique<Scion::Rendering::TextBatchRenderer>() }
 	, m_pCamera2D{ nullptr }
 {
 	auto& coreEngine = CoreEngineData::GetInstance();
@@ -40,6 +42,8 @@ RenderUISystem::~RenderUISystem()
 
 void RenderUISystem::Update( Scion::Core::ECS::Registry& registry )
 {
+	SCION_PROFILE_SCOPE( "RenderUISystem::Update" );
+
 	auto& mainRegistry = MAIN_REGISTRY();
 	auto& assetManager = mainRegistry.GetAssetManager();
 
@@ -100,10 +104,9 @@ void RenderUISystem::Update( Scion::Core::ECS::Registry& registry )
 		return;
 	}
 
-	pFontShader->Enable();
-	pFontShader->SetUniformMat4( "uProjection", cam_mat );
-
 	m_pTextRenderer->Begin();
+	m_pSDFTextRenderer->Begin();
+	bool bHasSDFText{ false };
 
 	for ( auto entity : textView )
 	{
@@ -127,16 +130,50 @@ void RenderUISystem::Update( Scion::Core::ECS::Registry& registry )
 			text.textBoxHeight = textHeight;
 		}
 
+		// SDF fonts need a different shader, so they are drawn in their own batches.
+		auto& pRenderer = pFont->IsSDF() ? m_pSDFTextRenderer : m_pTextRenderer;
+		bHasSDFText |= pFont->IsSDF();
+
+		// Only shape the text again when it has changed or the font has been reloaded.
+		if ( text.bDirty || !text.pTextLayout || text.pTextLayout->IsStale( *pFont ) )
+		{
+			text.pTextLayout = pRenderer->GetTextLayout( text.sTextStr, pFont, text.padding, text.wrap );
+		}
+
+		// The box size and layout are up to date. Only the editor clears the dirty flags of the scene, so the runtime
+		// would otherwise measure and look up the layout again every frame.
+		text.bDirty = false;
+
 		glm::mat4 model = Scion::Core::RSTModel( transform, text.textBoxWidth, text.textBoxHeight );
 
-		m_pTextRenderer->AddText(
-			text.sTextStr, pFont, transform.position, text.padding, text.wrap, text.color, model );
+		pRenderer->AddText( text.pTextLayout, transform.position, text.color, model );
 	}
 
+	pFontShader->Enable();
+	pFontShader->SetUniformMat4( "uProjection", cam_mat );
+
 	m_pTextRenderer->End();
 	m_pTextRenderer->Render();
 
 	pFontShader->Disable();
+
+	if ( !bHasSDFText )
+		return;
+
+	auto pSDFFontShader = assetManager.GetShader( "sdf_font" );
+	if ( !pSDFFontShader )
+	{
+		SCION_ERROR( "Failed to get the sdf font shader from the asset manager!" );
+		return;
+	}
+
+	pSDFFontShader->Enable();
+	pSDFFontShader->SetUniformMat4( "uProjection", cam_mat );
+
+	m_pSDFTextRenderer->End();
+	m_pSDFTextRenderer->Render();
+
+	pSDFFontShader->Disable();
 }
 
 void RenderUISystem::CreateRenderUISystemLuaBind( sol::state& lua )
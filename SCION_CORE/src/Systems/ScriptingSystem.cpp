@@ -15,11 +15,13 @@
 
 #include "Core/Resources/AssetManager.h"
 #include <Logger/Logger.h>
+#include <ScionUtilities/Profiler.h>
 #include <ScionUtilities/Timer.h>
 #include <ScionUtilities/RandomGenerator.h>
 #include "Core/CoreUtilities/CoreEngineData.h"
 #include "Core/CoreUtilities/CoreUtilities.h"
 #include "Core/CoreUtilities/FollowCamera.h"
+#include "Core/CoreUtilities/PrefabPool.h"
 #include "Core/CoreUtilities/ProjectInfo.h"
 
 #include "Core/States/State.h"
@@ -28,6 +30,7 @@
 
 #include "Core/Events/EngineEventTypes.h"
 #include "Core/Events/EventDispatcher.h"
+#include "Core/Events/PooledEventQueue.h"
 
 #include "Core/Systems/RenderSystem.h"
 #include "Core/Systems/RenderUISystem.h"
@@ -43,6 +46,7 @@
 #include "Rendering/Essentials/Shader.h"
 #include "Rendering/Essentials/Font.h"
 
+#include <SDL.h>
 #include <filesystem>
 
 namespace fs = std::filesystem;
@@ -182,6 +186,8 @@ bool ScriptingSystem::LoadMainScript( Scion::Core::ProjectInfo& projectInfo, Sci
 
 void ScriptingSystem::Update( Scion::Core::ECS::Registry& registry )
 {
+	SCION_PROFILE_SCOPE( "ScriptingSystem::Update" );
+
 	if ( !m_bMainLoaded )
 	{
 		SCION_ERROR( "Main lua script has not been loaded!" );
@@ -204,6 +210,8 @@ void ScriptingSystem::Update( Scion::Core::ECS::Registry& registry )
 
 void ScriptingSystem::Render( Scion::Core::ECS::Registry& registry )
 {
+	SCION_PROFILE_SCOPE( "ScriptingSystem::Render" );
+
 	if ( !m_bMainLoaded )
 	{
 		SCION_ERROR( "Main lua script has not been loaded!" );
@@ -254,6 +262,62 @@ auto create_timer = []( sol::state& lua ) {
 							 } );
 };
 
+auto create_profiler = []( sol::state& lua ) {
+	using namespace Scion::Utilities;
+
+	lua.new_usertype<ProfileZoneName>(
+		"ProfileZoneName", sol::no_constructor, "name", sol::readonly_property( []( const ProfileZoneName& zoneName ) {
+			return std::string{ zoneName.sName ? zoneName.sName : "" };
+		} ) );
+
+	// Zones marked by scripts are no-ops unless the profiler is enabled.
+	// Names passed as strings are interned on every call, zones opened every frame should use a zone_name handle.
+	lua.new_usertype<Profiler>(
+		"Profiler",
+		sol::no_constructor,
+		"zone_name",
+		[]( const std::string& sName ) {
+			return ProfileZoneName{ .sName = Profiler::GetInstance().InternName( sName ) };
+		},
+		"begin_zone",
+		sol::overload( []( const ProfileZoneName& zoneName ) { Profiler::GetInstance().BeginZone( zoneName ); },
+					   []( const std::string& sName ) { Profiler::GetInstance().BeginZone( sName ); } ),
+		"end_zone",
+		[] { Profiler::GetInstance().EndZone(); },
+		"zone",
+		sol::overload(
+			[]( const ProfileZoneName& zoneName, const sol::protected_function& func ) {
+				auto& profiler = Profiler::GetInstance();
+				profiler.BeginZone( zoneName );
+				auto result = func();
+				profiler.EndZone();
+
+				if ( !result.valid() )
+				{
+					sol::error error = result;
+					SCION_ERROR( "Failed to run profiler zone [{}]: {}", zoneName.sName, error.what() );
+				}
+			},
+			[]( const std::string& sName, const sol::protected_function& func ) {
+				auto& profiler = Profiler::GetInstance();
+				profiler.BeginZone( sName );
+				auto result = func();
+				profiler.EndZone();
+
+				if ( !result.valid() )
+				{
+					sol::error error = result;
+					SCION_ERROR( "Failed to run profiler zone [{}]: {}", sName, error.what() );
+				}
+			} ),
+		"is_enabled",
+		[] { return Profiler::GetInstance().IsEnabled(); },
+		"set_enabled",
+		[]( bool bEnabled ) { Profiler::GetInstance().SetEnabled( bEnabled ); },
+		"write_trace",
+		[]( const std::string& sFilepath ) { return Profiler::GetInstance().WriteChromeTrace( sFilepath ); } );
+};
+
 auto createTweenLuaBind = []( sol::state& lua ) {
 	using namespace Scion::Utilities;
 
@@ -415,8 +479,10 @@ void ScriptingSystem::RegisterLuaBindings( sol::state& lua, Scion::Core::ECS::Re
 
 	Scion::Core::FollowCamera::CreateLuaFollowCamera( lua, registry );
 	Scion::Core::Character::CreateCharacterLuaBind( lua, registry );
+	Scion::Core::PrefabPool::CreateLuaBind( lua, registry );
 
 	create_timer( lua );
+	create_profiler( lua );
 	create_lua_logger( lua );
 	createTweenLuaBind( lua );
 
@@ -434,6 +500,7 @@ void ScriptingSystem::RegisterLuaBindings( sol::state& lua, Scion::Core::ECS::Re
 	TextComponent::CreateLuaTextBindings( lua );
 	RigidBodyComponent::CreateRigidBodyBind( lua );
 	UIComponent::CreateLuaBind( lua );
+	ParticleEmitterComponent::CreateLuaBind( lua );
 
 	if ( CORE_GLOBALS().IsPhysicsEnabled() )
 	{
@@ -572,6 +639,7 @@ void ScriptingSystem::RegisterLuaEvents( sol::state& lua, Scion::Core::ECS::Regi
 	EventDispatcher::RegisterMetaEventFuncs<LuaEvent>();
 	EventDispatcher::RegisterMetaEventFuncs<GamepadConnectEvent>();
 	EventDispatcher::CreateEventDispatcherLuaBind( lua, **pDispatcher );
+	PooledEventQueue::CreateLuaBind( lua );
 }
 
 void ScriptingSystem::RegisterLuaSystems( sol::state& lua, Scion::Core::ECS::Registry& registry )
@@ -0,0 +1,211 @@
+#include "Core/Systems/VisibilitySystem.h"
+#include "Core/ECS/Components/SpriteComponent.h"
+#include "Core/ECS/Components/TransformComponent.h"
+#include "Core/ECS/Components/TileComponent.h"
+#include "Core/ECS/Components/PhysicsComponent.h"
+#include "Core/CoreUtilities/CoreUtilities.h"
+#include "Core/ECS/Registry.h"
+#include "Rendering/Core/Camera2D.h"
+
+#include "Logger/Logger.h"
+#include "ScionUtilities/Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Scion::Core::ECS;
+using namespace Scion::Rendering;
+
+namespace Scion::Core::Systems
+{
+namespace
+{
+inline int ToCell( float worldPos )
+{
+	return static_cast<int>( std::floor( worldPos / VISIBILITY_CELL_SIZE ) );
+}
+
+inline std::int64_t CellKey( int cellX, int cellY )
+{
+	return ( static_cast<std::int64_t>( cellX ) << 32 ) | static_cast<std::uint32_t>( cellY );
+}
+
+/* The world space bounds of the sprite. Flipped sprites extend to the left/up of their position. */
+inline void GetSpriteBounds( const TransformComponent& transform, const SpriteComponent& sprite, glm::vec2& min,
+							 glm::vec2& max )
+{
+	const glm::vec2 extent{ sprite.width * transform.scale.x, sprite.height * transform.scale.y };
+	min = glm::min( transform.position, transform.position + extent );
+	max = glm::max( transform.position, transform.position + extent );
+}
+} // namespace
+
+void VisibilityData::OnTileChanged( entt::registry& registry, entt::entity entity )
+{
+	bGridDirty = true;
+}
+
+void VisibilityData::OnSpriteChanged( entt::registry& registry, entt::entity entity )
+{
+	// Only tiles are in the grid, other sprites are tested every frame.
+	if ( registry.all_of<TileComponent>( entity ) )
+		bGridDirty = true;
+}
+
+void VisibilitySystem::Update( Scion::Core::ECS::Registry& registry, const Scion::Rendering::Camera2D& camera )
+{
+	SCION_PROFILE_SCOPE( "VisibilitySystem::Update" );
+
+	auto& reg = registry.GetRegistry();
+	auto& data = GetVisibilityData( registry );
+
+	// Both clear the flags of the tiles, the grid only reports the tiles that are in view.
+	if ( !data.bGridDirty )
+		CheckTileBounds( registry, data );
+
+	if ( data.bGridDirty )
+		RebuildGrid( registry, data );
+
+	data.visibleEntities.clear();
+
+	auto addIfInView = [ & ]( entt::entity entity, const TransformComponent& transform, SpriteComponent& sprite ) {
+		sprite.bInView = Scion::Core::EntityInView( transform, sprite.width, sprite.height, camera );
+		if ( sprite.bInView )
+			data.visibleEntities.push_back( entity );
+	};
+
+	// Static tiles, only the cells that overlap the camera are checked.
+	const float invCameraScale = 1.f / camera.GetScale();
+	const glm::vec2 cameraPos = camera.GetPosition() - camera.GetScreenOffset();
+	const int minCellX = ToCell( cameraPos.x * invCameraScale );
+	const int minCellY = ToCell( cameraPos.y * invCameraScale );
+	const int maxCellX = ToCell( ( cameraPos.x + camera.GetWidth() ) * invCameraScale );
+	const int maxCellY = ToCell( ( cameraPos.y + camera.GetHeight() ) * invCameraScale );
+
+	for ( int cellY = minCellY; cellY <= maxCellY; ++cellY )
+	{
+		for ( int cellX = minCellX; cellX <= maxCellX; ++cellX )
+		{
+			auto cellItr = data.mapCells.find( CellKey( cellX, cellY ) );
+			if ( cellItr == data.mapCells.end() )
+				continue;
+
+			for ( const auto& entry : cellItr->second )
+			{
+				// Only report an entity from the first of its cells that is in the camera.
+				if ( cellX != std::max( entry.minCellX, minCellX ) || cellY != std::max( entry.minCellY, minCellY ) )
+					continue;
+
+				auto [ transform, sprite ] = reg.get<TransformComponent, SpriteComponent>( entry.entity );
+				addIfInView( entry.entity, transform, sprite );
+			}
+		}
+	}
+
+	// Everything that can move.
+	auto dynamicView = reg.view<SpriteComponent, TransformComponent>( entt::exclude<TileComponent> );
+	for ( auto entity : dynamicView )
+	{
+		auto [ sprite, transform ] = dynamicView.get( entity );
+		addIfInView( entity, transform, sprite );
+	}
+
+	auto physicsTileView = reg.view<SpriteComponent, TransformComponent, TileComponent, PhysicsComponent>();
+	for ( auto entity : physicsTileView )
+	{
+		auto& sprite = physicsTileView.get<SpriteComponent>( entity );
+		const auto& transform = physicsTileView.get<TransformComponent>( entity );
+		addIfInView( entity, transform, sprite );
+	}
+}
+
+const std::vector<entt::entity>& VisibilitySystem::GetVisibleEntities( Scion::Core::ECS::Registry& registry )
+{
+	return GetVisibilityData( registry ).visibleEntities;
+}
+
+void VisibilitySystem::Invalidate( Scion::Core::ECS::Registry& registry )
+{
+	GetVisibilityData( registry ).bGridDirty = true;
+}
+
+VisibilityData& VisibilitySystem::GetVisibilityData( Scion::Core::ECS::Registry& registry )
+{
+	if ( auto* pData = registry.TryGetContext<std::shared_ptr<VisibilityData>>() )
+		return **pData;
+
+	auto pData = registry.AddToContext<std::shared_ptr<VisibilityData>>( std::make_shared<VisibilityData>() );
+
+	// Any change to the tiles will rebuild the grid before the next cull.
+	auto& reg = registry.GetRegistry();
+	reg.on_construct<TileComponent>().connect<&VisibilityData::OnTileChanged>( *pData );
+	reg.on_destroy<TileComponent>().connect<&VisibilityData::OnTileChanged>( *pData );
+	reg.on_construct<PhysicsComponent>().connect<&VisibilityData::OnSpriteChanged>( *pData );
+	reg.on_destroy<PhysicsComponent>().connect<&VisibilityData::OnSpriteChanged>( *pData );
+	reg.on_construct<SpriteComponent>().connect<&VisibilityData::OnSpriteChanged>( *pData );
+	reg.on_update<SpriteComponent>().connect<&VisibilityData::OnSpriteChanged>( *pData );
+	reg.on_destroy<SpriteComponent>().connect<&VisibilityData::OnSpriteChanged>( *pData );
+	reg.on_construct<TransformComponent>().connect<&VisibilityData::OnSpriteChanged>( *pData );
+	reg.on_update<TransformComponent>().connect<&VisibilityData::OnSpriteChanged>( *pData );
+	reg.on_destroy<TransformComponent>().connect<&VisibilityData::OnSpriteChanged>( *pData );
+
+	return *pData;
+}
+
+void VisibilitySystem::RebuildGrid( Scion::Core::ECS::Registry& registry, VisibilityData& data )
+{
+	data.mapCells.clear();
+	data.tileBounds.clear();
+
+	auto tileView = registry.GetRegistry().view<TileComponent, SpriteComponent, TransformComponent>(
+		entt::exclude<PhysicsComponent> );
+
+	for ( auto entity : tileView )
+	{
+		auto& sprite = tileView.get<SpriteComponent>( entity );
+		const auto& transform = tileView.get<TransformComponent>( entity );
+		sprite.bInView = false;
+
+		glm::vec2 min, max;
+		GetSpriteBounds( transform, sprite, min, max );
+		data.tileBounds.emplace_back( VisibilityData::TileBounds{ .entity = entity, .min = min, .max = max } );
+
+		const int minCellX = ToCell( min.x );
+		const int minCellY = ToCell( min.y );
+		const int maxCellX = ToCell( max.x );
+		const int maxCellY = ToCell( max.y );
+
+		for ( int cellY = minCellY; cellY <= maxCellY; ++cellY )
+		{
+			for ( int cellX = minCellX; cellX <= maxCellX; ++cellX )
+			{
+				data.mapCells[ CellKey( cellX, cellY ) ].emplace_back( VisibilityData::GridEntry{
+					.entity = entity, .minCellX = minCellX, .minCellY = minCellY } );
+			}
+		}
+	}
+
+	data.bGridDirty = false;
+}
+
+void VisibilitySystem::CheckTileBounds( Scion::Core::ECS::Registry& registry, VisibilityData& data )
+{
+	auto& reg = registry.GetRegistry();
+	for ( const auto& tile : data.tileBounds )
+	{
+		// The grid is not dirty, so every tile still has the components it was added with.
+		auto [ transform, sprite ] = reg.get<TransformComponent, SpriteComponent>( tile.entity );
+		sprite.bInView = false;
+
+		glm::vec2 min, max;
+		GetSpriteBounds( transform, sprite, min, max );
+		if ( min != tile.min || max != tile.max )
+		{
+			// The rebuild clears the flags of the remaining tiles.
+			data.bGridDirty = true;
+			return;
+		}
+	}
+}
+
+} // namespace Scion::Core::Systems
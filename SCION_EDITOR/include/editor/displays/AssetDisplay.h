@@ -8,11 +8,14 @@ enum class AssetType;
 
 namespace Scion::Editor
 {
+class ThumbnailCache;
+struct Thumbnail;
+
 class AssetDisplay : public IDisplay
 {
   public:
 	AssetDisplay();
-	~AssetDisplay() = default;
+	~AssetDisplay();
 
 	virtual void Draw() override;
 	virtual void Update() override;
@@ -23,7 +26,11 @@ class AssetDisplay : public IDisplay
   private:
 	void SetAssetType();
 	void DrawSelectedAssets();
-	unsigned int GetTextureID( const std::string& sAssetName ) const;
+	/*
+	 * @brief Gets the texture and region the asset is previewed with. Images are previewed with their thumbnail
+	 * once it is ready, and with the full texture until then.
+	 */
+	Thumbnail GetPreview( const std::string& sAssetName ) const;
 	bool DoRenameAsset( const std::string& sOldName, const std::string& sNewName ) const;
 	void CheckRename( const std::string& sCheckName ) const;
 	void OpenAssetContext( const std::string& sAssetName );
@@ -43,5 +50,8 @@ class AssetDisplay : public IDisplay
 	Scion::Utilities::AssetType m_eSelectedType;
 	float m_AssetSize;
 	int m_SelectedID;
+	/* The icon of the selected type, if the type is previewed with an icon. */
+	unsigned int m_IconID;
+	std::unique_ptr<ThumbnailCache> m_pThumbnailCache;
 };
 } // namespace Scion::Editor
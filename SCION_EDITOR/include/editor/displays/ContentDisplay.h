@@ -1,5 +1,7 @@
 #pragma once
 #include "IDisplay.h"
+#include <atomic>
+#include <vector>
 
 namespace Scion::Editor::Events
 {
@@ -15,6 +17,16 @@ namespace Scion::Core::Events
 class EventDispatcher;
 }
 
+namespace Scion::Rendering
+{
+class Texture;
+}
+
+namespace Scion::Filesystem
+{
+class DirectoryWatcher;
+}
+
 namespace Scion::Editor
 {
 class ContentDisplay : public IDisplay
@@ -27,8 +39,21 @@ class ContentDisplay : public IDisplay
 	virtual void Draw() override;
 
   private:
+	/* An entry of the current directory, cached so the directory is not walked every frame. */
+	struct ContentEntry
+	{
+		std::filesystem::path path{};
+		std::string sFilename{};
+		Scion::Rendering::Texture* pIcon{ nullptr };
+		bool bDirectory{ false };
+	};
+
 	virtual void DrawToolbar() override;
 
+	void ChangeDirectory( const std::filesystem::path& path );
+	/* @brief Walks the current directory again, sorting the folders first and then the files by name. */
+	void RefreshEntries();
+
 	void CopyDroppedFile( const std::string& sFileToCopy, const std::filesystem::path& droppedPath );
 	void MoveFolderOrFile( const std::filesystem::path& movedPath, const std::filesystem::path& path );
 	void HandleFileEvent( const Scion::Editor::Events::FileEvent& fileEvent );
@@ -46,6 +71,14 @@ class ContentDisplay : public IDisplay
   private:
 	std::unique_ptr<Scion::Core::Events::EventDispatcher> m_pFileDispatcher;
 	std::filesystem::path m_CurrentDir;
+
+	std::vector<ContentEntry> m_Entries;
+	/* Set by the actions that change the current directory, the entries are refreshed before the next draw. */
+	bool m_bEntriesDirty;
+	std::atomic_bool m_bFilesChanged;
+	/* Watches the content folder for changes made outside of the editor. Destroyed first, it sets the flag above. */
+	std::unique_ptr<Scion::Filesystem::DirectoryWatcher> m_pDirWatcher;
+
 	std::string m_sFilepathToAction;
 	int m_Selected;
 
@@ -54,6 +87,5 @@ class ContentDisplay : public IDisplay
 
 	bool m_bItemCut;
 	bool m_bWindowHovered;
-
 };
 } // namespace Scion::Editor
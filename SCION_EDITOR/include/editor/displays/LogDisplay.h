@@ -1,5 +1,6 @@
 #pragma once
 #include "IDisplay.h"
+#include "Logger/Logger.h"
 #include <imgui.h>
 
 namespace Scion::Editor
@@ -24,6 +25,9 @@ class LogDisplay : public IDisplay
 	bool m_bShowInfo;
 	bool m_bShowWarn;
 	bool m_bShowError;
-	int m_LogIndex;
+	/* The index of the next log to read from the logger. */
+	std::uint64_t m_LogIndex;
+	/* Reused every frame to copy the new logs out of the logger. */
+	std::vector<Scion::Logger::LogEntry> m_NewLogs;
 };
 } // namespace Scion::Editor
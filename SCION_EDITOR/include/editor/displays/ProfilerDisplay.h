@@ -0,0 +1,93 @@
+#pragma once
+#include "IDisplay.h"
+#include "Rendering/Utils/RenderStats.h"
+#include "Sounds/SoundPlayer/VoicePool.h"
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace Scion::Editor
+{
+/* The number of frames kept for the frame time graph and the percentiles. */
+constexpr std::size_t PROFILER_HISTORY_SIZE = 300;
+
+/*
+ * ProfilerDisplay
+ * Shows the frame times, the time spent in the engine systems, the render, GPU and audio stats and the lua heap.
+ * A number of frames can be captured to a json file, to compare builds offline.
+ */
+class ProfilerDisplay : public IDisplay
+{
+  public:
+	ProfilerDisplay();
+	~ProfilerDisplay() = default;
+
+	virtual void Update() override;
+	virtual void Draw() override;
+
+  private:
+	struct ProfiledSystem
+	{
+		const char* sLabel;
+		/* The name of the profiler zone the system is timed with. */
+		const char* sZone;
+	};
+
+	// clang-format off
+	static constexpr std::array<ProfiledSystem, 10> PROFILED_SYSTEMS{ {
+		{ "Scripting Update", "ScriptingSystem::Update" },
+		{ "Scripting Render", "ScriptingSystem::Render" },
+		{ "Physics / Transform Sync", "PhysicsSystem::Update" },
+		{ "Animation", "AnimationSystem::Update" },
+		{ "Visibility", "VisibilitySystem::Update" },
+		{ "Sprite Batching", "RenderSystem::Update" },
+		{ "Shapes", "RenderShapeSystem::Update" },
+		{ "UI / Text", "RenderUISystem::Update" },
+		{ "Particles", "ParticleSystem::Render" },
+		{ "Picking", "RenderPickingSystem::Update" } } };
+	// clang-format on
+
+	struct FrameSample
+	{
+		double frameMs{ 0.0 };
+		std::array<double, PROFILED_SYSTEMS.size()> systemMs{};
+		Scion::Rendering::RenderFrameStats renderStats{};
+		std::size_t luaHeapBytes{ 0 };
+		Scion::Sounds::VoicePoolStats voiceStats{};
+	};
+
+	void DrawFrameTimes();
+	void DrawSystems();
+	void DrawRenderStats();
+	void DrawGPUZones();
+	void DrawAudioStats();
+	void DrawFrameTree();
+	void DrawCapture();
+
+	void WriteCapture();
+
+	/* @brief Gets the total time spent in the zones with the given name during the last profiled frame. */
+	double GetZoneMs( const char* sZone ) const;
+	/* @brief Gets the memory used by the lua state of the scene that is playing, 0 if no scene is playing. */
+	std::size_t GetLuaHeapBytes() const;
+
+  private:
+	std::chrono::steady_clock::time_point m_LastFrameTime;
+	bool m_bFirstFrame;
+
+	/* A ring of the last frame times, m_FrameIndex is the next slot to write. */
+	std::vector<float> m_FrameTimes;
+	std::size_t m_FrameIndex;
+	std::size_t m_NumFrames;
+	/* Reused every draw to find the percentiles. */
+	std::vector<float> m_SortedTimes;
+
+	FrameSample m_LastSample;
+
+	std::vector<FrameSample> m_CapturedFrames;
+	int m_NumFramesToCapture;
+	std::string m_sCaptureFile;
+	bool m_bCapturing;
+};
+} // namespace Scion::Editor
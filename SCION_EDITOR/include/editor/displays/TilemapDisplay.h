@@ -15,7 +15,8 @@ struct PrefabbedEntity;
 namespace ECS
 {
 class Entity;
-}
+class Registry;
+} // namespace ECS
 namespace Events
 {
 struct KeyEvent;
@@ -46,6 +47,9 @@ class TilemapDisplay : public IDisplay
 
   private:
 	std::unique_ptr<Scion::Rendering::Camera2D> m_pTilemapCam;
+	/* The mouse position and registry of the last picking read, used to ignore repeated clicks and stale reads. */
+	glm::vec2 m_PickingMousePos;
+	Scion::Core::ECS::Registry* m_pPickingRegistry;
 	bool m_bWindowActive;
 };
 } // namespace Scion::Editor
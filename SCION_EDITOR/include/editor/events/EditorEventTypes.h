@@ -75,6 +75,7 @@ enum class EComponentType
 	Animation,
 	Tile,
 	UI,
+	ParticleEmitter,
 	NoType
 };
 
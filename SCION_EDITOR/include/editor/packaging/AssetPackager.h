@@ -43,6 +43,15 @@ class AssetPackager
 	void ConvertAssetToLuaTable( Scion::Filesystem::LuaSerializer& luaSerializer,
 								 const AssetConversionData& conversionData );
 
+	/*
+	 * @brief Appends the asset to the pack file and writes where it is to the lua table, instead of the data.
+	 * Used for music, so the runtime can stream it from the pack instead of keeping it in memory.
+	 * @param Takes the serializer, the asset, the pack file and the offset the asset is written at, which is
+	 * advanced past the asset.
+	 */
+	void AddAssetToPack( Scion::Filesystem::LuaSerializer& luaSerializer, const AssetConversionData& conversionData,
+						 std::ofstream& pack, std::uint64_t& packOffset );
+
 	void CreateLuaAssetFiles( const std::string& sProjectPath, const rapidjson::Value& assets );
 	bool CompileLuaAssetFiles();
 	bool CreateAssetsZip();
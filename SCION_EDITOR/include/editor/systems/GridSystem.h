@@ -1,4 +1,6 @@
 #pragma once
+#include <glm/glm.hpp>
+#include <memory>
 
 namespace Scion::Rendering
 {
@@ -24,6 +26,14 @@ class GridSystem
   private:
 	void UpdateIso( Scion::Core::Scene& currentScene, Scion::Rendering::Camera2D& camera );
 
+	/*
+	 * @brief Draws the checkerboard as a single quad, the grid shader picks the cell color per pixel.
+	 * @param Takes in the camera, the rect covering the grid, the cell size, the number of columns and rows
+	 * and whether the cells are isometric diamonds.
+	 */
+	void DrawGrid( Scion::Rendering::Camera2D& camera, const glm::vec4& gridRect, const glm::vec2& cellSize,
+				   const glm::vec2& gridSize, bool bIsometric );
+
   private:
 	std::unique_ptr<Scion::Rendering::RectBatchRenderer> m_pBatchRenderer;
 };
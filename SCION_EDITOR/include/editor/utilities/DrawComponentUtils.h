@@ -35,6 +35,7 @@ class DrawComponentsUtil
 	static void DrawImGuiComponent( Scion::Core::ECS::RigidBodyComponent& rigidbody );
 	static void DrawImGuiComponent( Scion::Core::ECS::TextComponent& textComponent );
 	static void DrawImGuiComponent( Scion::Core::ECS::Identification& identification );
+	static void DrawImGuiComponent( Scion::Core::ECS::ParticleEmitterComponent& emitter );
 
 	// Test to deal with Relationships.
 	static void DrawImGuiComponent( Scion::Core::ECS::Entity& entity, Scion::Core::ECS::TransformComponent& transform );
@@ -48,6 +49,8 @@ class DrawComponentsUtil
 	static void DrawImGuiComponent( Scion::Core::ECS::Entity& entity, Scion::Core::ECS::RigidBodyComponent& rigidbody );
 	static void DrawImGuiComponent( Scion::Core::ECS::Entity& entity, Scion::Core::ECS::TextComponent& textComponent );
 	static void DrawImGuiComponent( Scion::Core::ECS::Entity& entity, Scion::Core::ECS::Identification& identification );
+	static void DrawImGuiComponent( Scion::Core::ECS::Entity& entity,
+									Scion::Core::ECS::ParticleEmitterComponent& emitter );
 };
 
 } // namespace Scion::Editor
@@ -0,0 +1,112 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Scion::Utilities
+{
+class ThreadPool;
+}
+
+namespace Scion::Editor
+{
+/* The largest side of a thumbnail in pixels. */
+constexpr int THUMBNAIL_SIZE = 128;
+/* The size of each atlas page the thumbnails are packed into, 256 thumbnails per page. */
+constexpr int THUMBNAIL_ATLAS_SIZE = 2048;
+
+struct Thumbnail
+{
+	unsigned int textureID{ 0 };
+	/* The region of the texture the image covers. */
+	float u0{ 0.f };
+	float v0{ 0.f };
+	float u1{ 1.f };
+	float v1{ 1.f };
+};
+
+/*
+ * ThumbnailCache
+ * Small previews of the images used by the asset browser, so it does not have to sample the full textures.
+ * The previews are made on a worker thread and saved in the cache directory, keyed by the path and the write time
+ * of the image, so they are only made again when the image changes. The main thread packs them into mipmapped
+ * atlas pages, so any number of previews are drawn from a handful of textures.
+ * The write times are checked again while the thumbnails are used, so hot reloaded images get a new preview.
+ */
+class ThumbnailCache
+{
+  public:
+	explicit ThumbnailCache( const std::filesystem::path& cacheDir );
+	~ThumbnailCache();
+
+	ThumbnailCache( const ThumbnailCache& ) = delete;
+	ThumbnailCache& operator=( const ThumbnailCache& ) = delete;
+
+	/*
+	 * @brief Gets the thumbnail of the image. The first call queues it to be made.
+	 * @brief If the image has changed on disk, it is made again. The old thumbnail is kept until the new one is ready.
+	 * @return Returns nullptr until the thumbnail is in the atlas, or if the image could not be loaded.
+	 */
+	const Thumbnail* GetThumbnail( const std::string& sFilepath );
+
+	/* @brief Packs the thumbnails the worker has finished into the atlas. Must be called on the main thread. */
+	void Update();
+
+  private:
+	struct ThumbnailEntry
+	{
+		/* Pending and failed thumbnails have no texture. */
+		Thumbnail thumbnail{};
+		/* The write time of the image the thumbnail was made from. */
+		std::int64_t writeTime{ 0 };
+		std::chrono::steady_clock::time_point lastChecked{};
+		/* Set while the thumbnail is being made, so it is not queued again. */
+		bool bQueued{ false };
+	};
+
+	struct ThumbnailImage
+	{
+		std::string sFilepath{};
+		std::int64_t writeTime{ 0 };
+		int width{ 0 };
+		int height{ 0 };
+		/* RGBA pixels, empty if the image could not be loaded. */
+		std::vector<unsigned char> pixels{};
+	};
+
+	void QueueThumbnail( const std::string& sFilepath, ThumbnailEntry& entry );
+	/* @brief Loads the thumbnail from the cache directory, or makes and saves it. Runs on the worker thread. */
+	ThumbnailImage CreateThumbnail( const std::string& sFilepath ) const;
+	std::filesystem::path GetCachePath( const std::string& sFilepath, std::int64_t writeTime ) const;
+	bool LoadCachedThumbnail( const std::filesystem::path& cachePath, ThumbnailImage& image ) const;
+	void SaveCachedThumbnail( const std::filesystem::path& cachePath, const ThumbnailImage& image ) const;
+
+	/*
+	 * @brief Copies the image into the next free cell of the atlas, adding a page when the last one is full.
+	 * @param Takes in the image and the cell of its previous thumbnail, which is reused if not nullptr.
+	 */
+	Thumbnail AddToAtlas( const ThumbnailImage& image, const Thumbnail* pCell );
+
+  private:
+	std::filesystem::path m_CacheDir;
+
+	/* Every thumbnail that was asked for. */
+	std::unordered_map<std::string, ThumbnailEntry> m_mapThumbnails;
+	std::vector<unsigned int> m_AtlasPages;
+	int m_NextCell;
+
+	std::mutex m_FinishedMutex;
+	std::vector<ThumbnailImage> m_FinishedImages;
+	/* Set when the cache is destroyed, so the queued thumbnails are skipped instead of made. */
+	std::atomic_bool m_bStopping;
+
+	/* Declared last, so the worker is joined before the members it uses are destroyed. */
+	std::unique_ptr<Scion::Utilities::ThreadPool> m_pThreadPool;
+};
+} // namespace Scion::Editor
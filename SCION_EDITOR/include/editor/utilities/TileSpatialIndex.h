@@ -0,0 +1,73 @@
+#pragma once
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Scion::Core::ECS
+{
+class Registry;
+}
+
+namespace Scion::Editor
+{
+/* The size of a tile index cell in world units. */
+constexpr float TILE_INDEX_CELL_SIZE = 32.f;
+
+/*
+ * TileSpatialIndex
+ * Uniform grid over the tiles of a registry, used to find the tile under a position
+ * without scanning every tile. The index listens to the TileComponent storage, so tiles
+ * added or removed by the tools, commands or loaders are picked up automatically.
+ * Cells hold the tiles of every layer, the layer is checked when the cell is searched.
+ */
+class TileSpatialIndex
+{
+  public:
+	explicit TileSpatialIndex( Scion::Core::ECS::Registry& registry );
+	~TileSpatialIndex() = default;
+
+	TileSpatialIndex( const TileSpatialIndex& ) = delete;
+	TileSpatialIndex& operator=( const TileSpatialIndex& ) = delete;
+
+	/*
+	 * @brief Finds the tile on the layer at the position.
+	 * @param Takes in the world position, the layer and whether the map is isometric.
+	 * Isometric tiles are matched by their center, grid tiles by their bounds.
+	 * @return Returns the tile entity or entt::null if there is no tile there.
+	 */
+	entt::entity FindTile( const glm::vec2& position, int layer, bool bIsometric = false );
+
+	/*
+	 * @brief Gets the index of the registry, creating it the first time it is needed.
+	 */
+	static TileSpatialIndex& Get( Scion::Core::ECS::Registry& registry );
+
+  private:
+	struct CellRange
+	{
+		int minX{ 0 };
+		int minY{ 0 };
+		int maxX{ 0 };
+		int maxY{ 0 };
+	};
+
+	void OnTileAdded( entt::registry& registry, entt::entity entity );
+	void OnTileRemoved( entt::registry& registry, entt::entity entity );
+
+	void Insert( entt::entity entity );
+	void Remove( entt::entity entity );
+	void Rebuild();
+
+	bool TileMatches( entt::entity entity, const glm::vec2& position, int layer, bool bIsometric ) const;
+
+  private:
+	entt::registry& m_Registry;
+	std::unordered_map<std::int64_t, std::vector<entt::entity>> m_mapCells;
+	/* The cells each tile was inserted into, tiles are removed after their transform may be gone. */
+	std::unordered_map<entt::entity, CellRange> m_mapTileCells;
+	/* Set when a tile was added before its transform or sprite, the whole index is rebuilt on the next search. */
+	bool m_bDirty;
+};
+} // namespace Scion::Editor
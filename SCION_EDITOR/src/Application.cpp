@@ -4,12 +4,16 @@
 #include <Rendering/Utils/OpenGLDebugger.h>
 #include <Rendering/Core/Renderer.h>
 #include <Rendering/Essentials/PickingTexture.h>
+#include <Rendering/Utils/GPUProfiler.h>
+#include <Rendering/Utils/RenderStats.h>
 
 #include <Logger/Logger.h>
+#include <ScionUtilities/Profiler.h>
 #include <Logger/CrashLogger.h>
 #include <Core/ECS/MainRegistry.h>
 
 #include <Core/Resources/AssetManager.h>
+#include <Sounds/SoundPlayer/SoundFxPlayer.h>
 #include <Core/CoreUtilities/CoreEngineData.h>
 
 #include <Core/Scripting/InputManager.h>
@@ -29,6 +33,7 @@
 #include "editor/displays/TilesetDisplay.h"
 #include "editor/displays/TilemapDisplay.h"
 #include "editor/displays/LogDisplay.h"
+#include "editor/displays/ProfilerDisplay.h"
 #include "editor/displays/EditorStyleToolDisplay.h"
 #include "editor/displays/ContentDisplay.h"
 #include "editor/displays/PackageDisplay.h"
@@ -158,6 +163,8 @@ bool Application::Initialize()
 
 	SDL_GL_SetSwapInterval( 1 );
 
+	Scion::Rendering::GPUProfiler::GetInstance().Initialize();
+
 #ifdef SCION_OPENGL_DEBUG_CALLBACK
 	// OpenGL debug callback initialization. A valid current OpenGL context is necessary.
 	std::vector<unsigned int> ignore{ /* 1281, 131169, 131185, 131204, 31218*/ };
@@ -307,6 +314,20 @@ bool Application::LoadShaders()
 		return false;
 	}
 
+	if ( !assetManager.AddShaderFromMemory(
+			 "sdf_font", Scion::Core::Shaders::sdfFontShaderVert, Scion::Core::Shaders::sdfFontShaderFrag ) )
+	{
+		SCION_ERROR( "Failed to add the sdf font shader to the asset manager" );
+		return false;
+	}
+
+	if ( !assetManager.AddShaderFromMemory(
+			 "particle", Scion::Core::Shaders::particleShaderVert, Scion::Core::Shaders::particleShaderFrag ) )
+	{
+		SCION_ERROR( "Failed to add the particle shader to the asset manager" );
+		return false;
+	}
+
 	if ( !assetManager.AddShaderFromMemory(
 			 "picking", Scion::Core::Shaders::pickingShaderVert, Scion::Core::Shaders::pickingShaderFrag ) )
 	{
@@ -314,6 +335,13 @@ bool Application::LoadShaders()
 		return false;
 	}
 
+	if ( !assetManager.AddShaderFromMemory(
+			 "grid", Scion::Core::Shaders::gridShaderVert, Scion::Core::Shaders::gridShaderFrag ) )
+	{
+		SCION_ERROR( "Failed to add the grid shader to the asset manager" );
+		return false;
+	}
+
 	return true;
 }
 
@@ -566,6 +594,8 @@ void Application::ProcessEvents()
 
 void Application::Update()
 {
+	SCION_PROFILE_SCOPE( "Application::Update" );
+
 	auto& mainRegistry = MAIN_REGISTRY();
 	auto& displayHolder = mainRegistry.GetContext<std::shared_ptr<DisplayHolder>>();
 
@@ -575,6 +605,7 @@ void Application::Update()
 	}
 
 	mainRegistry.GetAssetManager().Update();
+	mainRegistry.GetSoundPlayer().Update();
 }
 
 void Application::UpdateInputs()
@@ -591,6 +622,8 @@ void Application::UpdateInputs()
 
 void Application::Render()
 {
+	SCION_PROFILE_SCOPE( "Application::Render" );
+
 	Gui::Begin();
 	RenderDisplays();
 	Gui::End( m_pWindow.get() );
@@ -605,6 +638,7 @@ void Application::CleanUp()
 	auto& pEditorState = MAIN_REGISTRY().GetContext<EditorStatePtr>();
 	pEditorState->Save( *pProjectInfo );
 
+	Scion::Rendering::GPUProfiler::GetInstance().Shutdown();
 	SDL_GL_DeleteContext( m_pWindow->GetGLContext() );
 	SDL_DestroyWindow( m_pWindow->GetWindow().get() );
 
@@ -651,6 +685,13 @@ bool Application::CreateDisplays()
 		return false;
 	}
 
+	auto pProfilerDisplay = std::make_unique<ProfilerDisplay>();
+	if ( !pProfilerDisplay )
+	{
+		SCION_ERROR( "Failed to Create Profiler Display!" );
+		return false;
+	}
+
 	auto pTilesetDisplay = std::make_unique<TilesetDisplay>();
 	if ( !pTilesetDisplay )
 	{
@@ -704,6 +745,7 @@ bool Application::CreateDisplays()
 	pDisplayHolder->displays.push_back( std::move( pSceneDisplay ) );
 	pDisplayHolder->displays.push_back( std::move( pSceneHierarchyDisplay ) );
 	pDisplayHolder->displays.push_back( std::move( pLogDisplay ) );
+	pDisplayHolder->displays.push_back( std::move( pProfilerDisplay ) );
 	pDisplayHolder->displays.push_back( std::move( pTileDetailsDisplay ) );
 	pDisplayHolder->displays.push_back( std::move( pTilesetDisplay ) );
 	pDisplayHolder->displays.push_back( std::move( pTilemapDisplay ) );
@@ -750,6 +792,7 @@ void Application::InitDisplays()
 		ImGui::DockBuilderDockWindow( ICON_FA_MAP " Tilemap Editor", centerNodeId );
 		ImGui::DockBuilderDockWindow( ICON_FA_FILE_ALT " Assets", LogNodeId );
 		ImGui::DockBuilderDockWindow( ICON_FA_TERMINAL " Logs", LogNodeId );
+		ImGui::DockBuilderDockWindow( ICON_FA_CHART_LINE " Profiler", LogNodeId );
 		ImGui::DockBuilderDockWindow( ICON_FA_FOLDER " Content Browser", LogNodeId );
 
 		ImGui::DockBuilderFinish( dockSpaceId );
@@ -782,6 +825,7 @@ void Application::RegisterEditorMetaFunctions()
 	DrawComponentsUtil::RegisterUIComponent<Scion::Core::ECS::RigidBodyComponent>();
 	DrawComponentsUtil::RegisterUIComponent<Scion::Core::ECS::BoxColliderComponent>();
 	DrawComponentsUtil::RegisterUIComponent<Scion::Core::ECS::CircleColliderComponent>();
+	DrawComponentsUtil::RegisterUIComponent<Scion::Core::ECS::ParticleEmitterComponent>();
 }
 
 void Application::OnCloseEditor( Scion::Editor::Events::CloseEditorEvent& close )
@@ -821,11 +865,17 @@ void Application::Run()
 
 	while ( m_bIsRunning )
 	{
+		SCION_PROFILE_BEGIN_FRAME();
+
 		ProcessEvents();
 		Update();
 		Render();
 		UpdateInputs();
 		SCENE_MANAGER().UpdateScenes();
+		Scion::Rendering::GPUProfiler::GetInstance().EndFrame();
+		Scion::Rendering::RenderStats::EndFrame();
+
+		SCION_PROFILE_END_FRAME();
 	}
 
 	CleanUp();
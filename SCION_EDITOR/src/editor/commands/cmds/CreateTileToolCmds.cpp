@@ -5,6 +5,7 @@
 #include "Core/ECS/Components/AllComponents.h"
 
 #include "editor/utilities/EditorUtilities.h"
+#include "editor/utilities/TileSpatialIndex.h"
 #include "Logger/Logger.h"
 
 using namespace Scion::Core::ECS;
@@ -29,25 +30,8 @@ void CreateTileToolAddCmd::undo()
 		return;
 	}
 
-	auto tiles = pRegistry->GetRegistry().view<TileComponent, TransformComponent>();
-	const auto& tilePos = pTile->transform.position;
-	entt::entity entityToRemove{ entt::null };
-
-	for ( auto entity : tiles )
-	{
-		Entity tile{ pRegistry, entity };
-		const auto& transform = tile.GetComponent<TransformComponent>();
-		const auto& sprite = tile.GetComponent<SpriteComponent>();
-
-		if ( tilePos.x >= transform.position.x && tilePos.x < transform.position.x + sprite.width * transform.scale.x &&
-			 tilePos.y >= transform.position.y &&
-			 tilePos.y < transform.position.y + sprite.height * transform.scale.y &&
-			 pTile->sprite.layer == sprite.layer )
-		{
-			entityToRemove = entity;
-			break;
-		}
-	}
+	const entt::entity entityToRemove =
+		TileSpatialIndex::Get( *pRegistry ).FindTile( pTile->transform.position, pTile->sprite.layer );
 
 	SCION_ASSERT( entityToRemove != entt::null && "Entity should not be null." );
 	if ( entityToRemove != entt::null )
@@ -163,25 +147,8 @@ void CreateTileToolRemoveCmd::redo()
 		return;
 	}
 
-	auto tiles = pRegistry->GetRegistry().view<TileComponent, TransformComponent>();
-	const auto& tilePos = pTile->transform.position;
-	entt::entity entityToRemove{ entt::null };
-
-	for ( auto entity : tiles )
-	{
-		Entity tile{ pRegistry, entity };
-		const auto& transform = tile.GetComponent<TransformComponent>();
-		const auto& sprite = tile.GetComponent<SpriteComponent>();
-
-		if ( tilePos.x >= transform.position.x && tilePos.x < transform.position.x + sprite.width * transform.scale.x &&
-			 tilePos.y >= transform.position.y &&
-			 tilePos.y < transform.position.y + sprite.height * transform.scale.y &&
-			 pTile->sprite.layer == sprite.layer )
-		{
-			entityToRemove = entity;
-			break;
-		}
-	}
+	const entt::entity entityToRemove =
+		TileSpatialIndex::Get( *pRegistry ).FindTile( pTile->transform.position, pTile->sprite.layer );
 
 	SCION_ASSERT( entityToRemove != entt::null && "Entity should not be null." );
 	if ( entityToRemove != entt::null )
@@ -5,6 +5,7 @@
 
 #include "Logger/Logger.h"
 #include "editor/utilities/EditorUtilities.h"
+#include "editor/utilities/TileSpatialIndex.h"
 
 using namespace Scion::Core::ECS;
 
@@ -20,30 +21,13 @@ void RectToolAddTilesCmd::undo()
 		return;
 	}
 
-	auto tileView = pRegistry->GetRegistry().view<TileComponent, TransformComponent>();
+	auto& tileIndex = TileSpatialIndex::Get( *pRegistry );
 	for ( const auto& tile : tiles )
 	{
-		const auto& tilePos = tile.transform.position;
-		const auto layer = tile.sprite.layer;
-
-		for ( auto entity : tileView )
+		auto entity = tileIndex.FindTile( tile.transform.position, tile.sprite.layer );
+		if ( entity != entt::null )
 		{
-			Entity checkedTile{ pRegistry, entity };
-			const auto& transform = checkedTile.GetComponent<TransformComponent>();
-			const auto& sprite = checkedTile.GetComponent<SpriteComponent>();
-
-			if ( tilePos.x >= transform.position.x &&
-				 tilePos.x < transform.position.x + sprite.width * transform.scale.x &&
-				 tilePos.y >= transform.position.y &&
-				 tilePos.y < transform.position.y + sprite.height * transform.scale.y && layer == sprite.layer )
-			{
-				if ( entity != entt::null )
-				{
-					pRegistry->GetRegistry().destroy( entity );
-				}
-
-				break;
-			}
+			pRegistry->GetRegistry().destroy( entity );
 		}
 	}
 }
@@ -138,30 +122,13 @@ void RectToolRemoveTilesCmd::redo()
 		return;
 	}
 
-	auto tileView = pRegistry->GetRegistry().view<TileComponent, TransformComponent>();
+	auto& tileIndex = TileSpatialIndex::Get( *pRegistry );
 	for ( const auto& tile : tiles )
 	{
-		const auto& tilePos = tile.transform.position;
-		const auto layer = tile.sprite.layer;
-
-		for ( auto entity : tileView )
+		auto entity = tileIndex.FindTile( tile.transform.position, tile.sprite.layer );
+		if ( entity != entt::null )
 		{
-			Entity checkedTile{ pRegistry, entity };
-			const auto& transform = checkedTile.GetComponent<TransformComponent>();
-			const auto& sprite = checkedTile.GetComponent<SpriteComponent>();
-
-			if ( tilePos.x >= transform.position.x &&
-				 tilePos.x < transform.position.x + sprite.width * transform.scale.x &&
-				 tilePos.y >= transform.position.y &&
-				 tilePos.y < transform.position.y + sprite.height * transform.scale.y && layer == sprite.layer )
-			{
-				if ( entity != entt::null )
-				{
-					pRegistry->GetRegistry().destroy( entity );
-				}
-
-				break;
-			}
+			pRegistry->GetRegistry().destroy( entity );
 		}
 	}
 }
@@ -8,6 +8,7 @@
 
 #include "editor/utilities/EditorUtilities.h"
 #include "editor/utilities/EditorState.h"
+#include "editor/utilities/ThumbnailCache.h"
 #include "editor/utilities/imgui/ImGuiUtils.h"
 #include "editor/utilities/fonts/IconsFontAwesome5.h"
 #include "editor/scene/SceneManager.h"
@@ -74,60 +75,73 @@ void AssetDisplay::SetAssetType()
 		m_sDragSource = "NO_ASSET_TYPE";
 	}
 
+	// Look the icon up once, instead of for every asset every frame.
+	std::string sIconName{};
+	if ( m_eSelectedType == Scion::Utilities::AssetType::SOUNDFX ||
+		 m_eSelectedType == Scion::Utilities::AssetType::MUSIC )
+	{
+		sIconName = "music_icon";
+	}
+	else if ( m_eSelectedType == Scion::Utilities::AssetType::SCENE )
+	{
+		sIconName = "scene_icon";
+	}
+
+	auto pIcon = !sIconName.empty() ? MAIN_REGISTRY().GetAssetManager().GetTexture( sIconName ) : nullptr;
+	m_IconID = pIcon ? pIcon->GetID() : 0;
+
 	m_bAssetTypeChanged = false;
 }
 
-unsigned int AssetDisplay::GetTextureID( const std::string& sAssetName ) const
+Thumbnail AssetDisplay::GetPreview( const std::string& sAssetName ) const
 {
 	auto& assetManager = MAIN_REGISTRY().GetAssetManager();
 	switch ( m_eSelectedType )
 	{
 	case Scion::Utilities::AssetType::TEXTURE: {
 		auto pTexture = assetManager.GetTexture( sAssetName );
-		if ( pTexture )
-			return pTexture->GetID();
+		if ( !pTexture )
+			break;
 
-		break;
+		if ( m_pThumbnailCache )
+		{
+			if ( const auto* pThumbnail = m_pThumbnailCache->GetThumbnail( pTexture->GetPath() ) )
+				return *pThumbnail;
+		}
+
+		return Thumbnail{ .textureID = pTexture->GetID() };
 	}
 	case Scion::Utilities::AssetType::FONT: {
 		auto pFont = assetManager.GetFont( sAssetName );
 		if ( pFont )
-			return pFont->GetFontAtlasID();
+			return Thumbnail{ .textureID = pFont->GetFontAtlasID() };
 
 		break;
 	}
 	case Scion::Utilities::AssetType::SOUNDFX:
-	case Scion::Utilities::AssetType::MUSIC: {
-		auto pTexture = assetManager.GetTexture( "music_icon" );
-		if ( pTexture )
-			return pTexture->GetID();
-
-		break;
-	}
-	case Scion::Utilities::AssetType::SCENE: {
-		auto pTexture = assetManager.GetTexture( "scene_icon" );
-		if ( pTexture )
-			return pTexture->GetID();
-
-		break;
-	}
+	case Scion::Utilities::AssetType::MUSIC:
+	case Scion::Utilities::AssetType::SCENE: return Thumbnail{ .textureID = m_IconID };
 	case Scion::Utilities::AssetType::PREFAB: {
-		if ( auto pPrefab = assetManager.GetPrefab( sAssetName ) )
-		{
-			if ( auto& sprite = pPrefab->GetPrefabbedEntity().sprite )
-			{
-				if ( auto pTexture = assetManager.GetTexture( sprite->sTextureName ) )
-				{
-					return pTexture->GetID();
-				}
-			}
-		}
-
-		break;
+		auto pPrefab = assetManager.GetPrefab( sAssetName );
+		if ( !pPrefab || !pPrefab->GetPrefabbedEntity().sprite )
+			break;
+
+		const auto& sprite = pPrefab->GetPrefabbedEntity().sprite;
+		auto pTexture = assetManager.GetTexture( sprite->sTextureName );
+		if ( !pTexture )
+			break;
+
+		// A sprite is usually a small part of a sheet, it would only be a few pixels of the thumbnail.
+		// The full texture is used instead, with the sprite uvs.
+		return Thumbnail{ .textureID = pTexture->GetID(),
+						  .u0 = sprite->uvs.u,
+						  .v0 = sprite->uvs.v,
+						  .u1 = sprite->uvs.u + sprite->uvs.uv_width,
+						  .v1 = sprite->uvs.v + sprite->uvs.uv_height };
 	}
 	}
 
-	return 0;
+	return Thumbnail{};
 }
 
 bool AssetDisplay::DoRenameAsset( const std::string& sOldName, const std::string& sNewName ) const
@@ -378,7 +392,10 @@ void AssetDisplay::DrawSelectedAssets()
 			if ( bSelectedAsset )
 				ImGui::TableSetBgColor( ImGuiTableBgTarget_CellBg,
 										ImGui::GetColorU32( ImVec4{ 0.f, 0.9f, 0.f, 0.3f } ) );
-			GLuint textureID = GetTextureID( *assetItr );
+			const Thumbnail preview = GetPreview( *assetItr );
+			const GLuint textureID = preview.textureID;
+			const ImVec2 uv0{ preview.u0, preview.v0 };
+			const ImVec2 uv1{ preview.u1, preview.v1 };
 			std::string sCheckName{ m_sRenameBuf.data() };
 			std::string assetBtn = "##asset" + std::to_string( id );
 
@@ -389,12 +406,11 @@ void AssetDisplay::DrawSelectedAssets()
 					auto& sprite = pPrefab->GetPrefabbedEntity().sprite;
 					if ( textureID && sprite )
 					{
-						ImGui::ImageButton(
-							assetBtn.c_str(),
-							(ImTextureID)(intptr_t)textureID,
-							ImVec2{ m_AssetSize, m_AssetSize },
-							ImVec2{ sprite->uvs.u, sprite->uvs.v },
-							ImVec2{ sprite->uvs.u + sprite->uvs.uv_width, sprite->uvs.v + sprite->uvs.uv_height } );
+						ImGui::ImageButton( assetBtn.c_str(),
+											(ImTextureID)(intptr_t)textureID,
+											ImVec2{ m_AssetSize, m_AssetSize },
+											uv0,
+											uv1 );
 					}
 					else
 					{
@@ -411,7 +427,7 @@ void AssetDisplay::DrawSelectedAssets()
 				}
 
 				ImGui::ImageButton(
-					assetBtn.c_str(), (ImTextureID)(intptr_t)textureID, ImVec2{ m_AssetSize, m_AssetSize } );
+					assetBtn.c_str(), (ImTextureID)(intptr_t)textureID, ImVec2{ m_AssetSize, m_AssetSize }, uv0, uv1 );
 			}
 
 			if ( ImGui::IsItemHovered() && ImGui::IsMouseClicked( 0 ) && !m_bRename )
@@ -431,7 +447,7 @@ void AssetDisplay::DrawSelectedAssets()
 			{
 				ImGui::SetDragDropPayload(
 					m_sDragSource.c_str(), sAssetName, ( strlen( sAssetName ) + 1 ) * sizeof( char ), ImGuiCond_Once );
-				ImGui::Image( (ImTextureID)(intptr_t)textureID, DRAG_ASSET_SIZE );
+				ImGui::Image( (ImTextureID)(intptr_t)textureID, DRAG_ASSET_SIZE, uv0, uv1 );
 				ImGui::EndDragDropSource();
 			}
 
@@ -497,10 +513,23 @@ AssetDisplay::AssetDisplay()
 	, m_eSelectedType{ Scion::Utilities::AssetType::TEXTURE }
 	, m_AssetSize{ DEFAULT_ASSET_SIZE }
 	, m_SelectedID{ -1 }
+	, m_IconID{ 0 }
+	, m_pThumbnailCache{ nullptr }
 {
+	// Thumbnails are kept with the project, so they are not made again every time it is opened.
+	if ( auto& pProjectInfo = MAIN_REGISTRY().GetContext<Scion::Core::ProjectInfoPtr>() )
+	{
+		if ( auto optEditorConfig = pProjectInfo->TryGetFolderPath( Scion::Core::EProjectFolderType::EditorConfig ) )
+		{
+			m_pThumbnailCache = std::make_unique<ThumbnailCache>( *optEditorConfig / "thumbnails" );
+		}
+	}
+
 	SetAssetType();
 }
 
+AssetDisplay::~AssetDisplay() = default;
+
 void AssetDisplay::Draw()
 {
 	if ( auto& pEditorState = MAIN_REGISTRY().GetContext<EditorStatePtr>() )
@@ -550,6 +579,8 @@ void AssetDisplay::Draw()
 
 void AssetDisplay::Update()
 {
+	if ( m_pThumbnailCache )
+		m_pThumbnailCache->Update();
 }
 
 void AssetDisplay::DrawToolbar()
@@ -3,6 +3,7 @@
 #include "Core/Resources/AssetManager.h"
 #include "ScionUtilities/ScionUtilities.h"
 #include "ScionUtilities/HelperUtilities.h"
+#include "ScionUtilities/Profiler.h"
 #include "ScionFilesystem/Dialogs/FileDialog.h"
 #include "editor/utilities/EditorUtilities.h"
 #include "editor/utilities/EditorState.h"
@@ -16,6 +17,7 @@
 
 #include "ScionFilesystem/Process/FileProcessor.h"
 #include "ScionFilesystem/Serializers/LuaSerializer.h"
+#include "ScionFilesystem/Utilities/DirectoryWatcher.h"
 
 #include <Rendering/Essentials/Texture.h>
 #include <imgui.h>
@@ -32,6 +34,10 @@ ContentDisplay::ContentDisplay()
 	: m_pFileDispatcher{ std::make_unique<Scion::Core::Events::EventDispatcher>() }
 	, m_CurrentDir{ *MAIN_REGISTRY().GetContext<Scion::Core::ProjectInfoPtr>()->TryGetFolderPath(
 		  Scion::Core::EProjectFolderType::Content ) }
+	, m_Entries{}
+	, m_bEntriesDirty{ true }
+	, m_bFilesChanged{ false }
+	, m_pDirWatcher{ nullptr }
 	, m_sFilepathToAction{}
 	, m_Selected{ -1 }
 	, m_eFileAction{ Events::EFileAction::NoAction }
@@ -41,6 +47,9 @@ ContentDisplay::ContentDisplay()
 {
 	ADD_EVENT_HANDLER( FileEvent, &ContentDisplay::HandleFileEvent, *this );
 	m_pFileDispatcher->AddHandler<FileEvent, &ContentDisplay::HandleFileEvent>( *this );
+
+	m_pDirWatcher = std::make_unique<Scion::Filesystem::DirectoryWatcher>(
+		m_CurrentDir, [ this ]( const fs::path&, bool ) { m_bFilesChanged.store( true, std::memory_order_relaxed ); } );
 }
 
 ContentDisplay::~ContentDisplay() = default;
@@ -48,6 +57,11 @@ ContentDisplay::~ContentDisplay() = default;
 void ContentDisplay::Update()
 {
 	m_pFileDispatcher->UpdateAll();
+
+	if ( m_bFilesChanged.exchange( false, std::memory_order_acquire ) )
+	{
+		m_bEntriesDirty = true;
+	}
 }
 
 void ContentDisplay::Draw()
@@ -78,141 +92,144 @@ void ContentDisplay::Draw()
 
 	DrawToolbar();
 
-	auto size = static_cast<int>( std::distance( fs::directory_iterator( m_CurrentDir ), fs::directory_iterator{} ) );
-	int numRows = size / numCols < 1 ? 1 : ( size / numCols ) + 1;
-	auto itr = fs::directory_iterator( m_CurrentDir );
+	if ( m_bEntriesDirty )
+		RefreshEntries();
+
+	const int numEntries = static_cast<int>( m_Entries.size() );
+	const int numRows = std::max( 1, ( numEntries + numCols - 1 ) / numCols );
 
 	if ( ImGui::BeginTable( "Content", numCols, IMGUI_NORMAL_TABLE_FLAGS ) )
 	{
 		m_bWindowHovered = ImGui::IsWindowHovered();
 		static ImGuiID popID = 0;
 
-		for ( int i = 0; i < numRows; i++ )
+		// Only the rows that are scrolled into view are drawn.
+		ImGuiListClipper clipper;
+		clipper.Begin( numRows );
+		while ( clipper.Step() )
 		{
-			ImGui::TableNextRow();
-			for ( int j = 0; j < numCols; j++ )
+			for ( int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++ )
 			{
-				if ( itr == fs::directory_iterator{} )
-					break;
-
-				const auto& path = itr->path();
-
-				auto relativePath = fs::relative( path, m_CurrentDir );
-				auto filenameStr = relativePath.filename().string();
-
-				ImGui::TableSetColumnIndex( j );
-				ImGui::PushID( j + j + i );
-				int id = j + j + i;
-
-				if ( m_Selected == id )
+				ImGui::TableNextRow();
+				for ( int j = 0; j < numCols; j++ )
 				{
-					ImGui::TableSetBgColor( ImGuiTableBgTarget_CellBg,
-											ImGui::GetColorU32( ImVec4{ 0.f, 0.9f, 0.f, 0.3f } ) );
-				}
+					const int id = i * numCols + j;
+					if ( id >= numEntries )
+						break;
 
-				const auto* icon = GetIconTexture( path.string() );
-				static bool bItemPop{ false };
+					const auto& entry = m_Entries[ id ];
+					const auto& path = entry.path;
 
-				std::string contentBtn = "##content_" + std::to_string( id );
-				if ( itr->is_directory() )
-				{
-					// Change to the next Directory
-					ImGui::ImageButton(
-						contentBtn.c_str(), (ImTextureID)(intptr_t)icon->GetID(), ImVec2{ 80.f, 80.f } );
-					if ( ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked( 0 ) )
-					{
-						m_CurrentDir /= path.filename();
-						m_Selected = -1;
-					}
-					else if ( ImGui::IsItemHovered() && ImGui::IsMouseClicked( 0 ) )
-					{
-						m_Selected = id;
-					}
-					else if ( !ImGui::IsItemHovered() && ImGui::IsWindowHovered() && ImGui::IsMouseClicked( 0 ) )
+					ImGui::TableSetColumnIndex( j );
+					ImGui::PushID( id );
+
+					if ( m_Selected == id )
 					{
-						m_Selected = -1;
+						ImGui::TableSetBgColor( ImGuiTableBgTarget_CellBg,
+												ImGui::GetColorU32( ImVec4{ 0.f, 0.9f, 0.f, 0.3f } ) );
 					}
-				}
-				else
-				{
-					ImGui::PushStyleVar( ImGuiStyleVar_FramePadding, { 0.0f, 0.0f } );
-					ImGui::ImageButton(
-						contentBtn.c_str(), (ImTextureID)(intptr_t)icon->GetID(), ImVec2{ 80.f, 80.f } );
-					ImGui::PopStyleVar( 1 );
 
-					if ( ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked( 0 ) )
+					const auto iconID = (ImTextureID)(intptr_t)( entry.pIcon ? entry.pIcon->GetID() : 0 );
+					static bool bItemPop{ false };
+
+					std::string contentBtn = "##content_" + std::to_string( id );
+					if ( entry.bDirectory )
 					{
-						Scion::Filesystem::FileProcessor fp{};
-						if ( !fp.OpenApplicationFromFile( path.string(), {} ) )
+						// Change to the next Directory
+						ImGui::ImageButton( contentBtn.c_str(), iconID, ImVec2{ 80.f, 80.f } );
+						if ( ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked( 0 ) )
+						{
+							ChangeDirectory( path );
+						}
+						else if ( ImGui::IsItemHovered() && ImGui::IsMouseClicked( 0 ) )
+						{
+							m_Selected = id;
+						}
+						else if ( !ImGui::IsItemHovered() && ImGui::IsWindowHovered() && ImGui::IsMouseClicked( 0 ) )
 						{
-							SCION_ERROR( "Failed to open file {}", path.string() );
+							m_Selected = -1;
 						}
 					}
-					else if ( ImGui::IsItemHovered() && ImGui::IsMouseClicked( 0 ) )
+					else
 					{
-						m_Selected = id;
-					}
-				}
+						ImGui::PushStyleVar( ImGuiStyleVar_FramePadding, { 0.0f, 0.0f } );
+						ImGui::ImageButton( contentBtn.c_str(), iconID, ImVec2{ 80.f, 80.f } );
+						ImGui::PopStyleVar( 1 );
 
-				if ( ImGui::BeginPopupContextItem() )
-				{
-					popID = ImGui::GetItemID();
-					ImGui::SeparatorText( "Common" );
-					if ( m_bItemCut )
-					{
-						ImGui::BeginDisabled();
-						ImGui::Selectable( ICON_FA_CUT " Cut" );
-						ImGui::EndDisabled();
+						if ( ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked( 0 ) )
+						{
+							Scion::Filesystem::FileProcessor fp{};
+							if ( !fp.OpenApplicationFromFile( path.string(), {} ) )
+							{
+								SCION_ERROR( "Failed to open file {}", path.string() );
+							}
+						}
+						else if ( ImGui::IsItemHovered() && ImGui::IsMouseClicked( 0 ) )
+						{
+							m_Selected = id;
+						}
 					}
-					else
+
+					if ( ImGui::BeginPopupContextItem() )
 					{
-						if ( ImGui::Selectable( ICON_FA_CUT " Cut" ) )
+						popID = ImGui::GetItemID();
+						ImGui::SeparatorText( "Common" );
+						if ( m_bItemCut )
 						{
-							m_sFilepathToAction = path.string();
-							m_bItemCut = true;
+							ImGui::BeginDisabled();
+							ImGui::Selectable( ICON_FA_CUT " Cut" );
+							ImGui::EndDisabled();
 						}
-
-						if ( ImGui::Selectable( ICON_FA_TRASH " Delete" ) )
+						else
 						{
-							if ( m_Selected == id )
+							if ( ImGui::Selectable( ICON_FA_CUT " Cut" ) )
 							{
 								m_sFilepathToAction = path.string();
-								m_eFileAction = Events::EFileAction::Delete;
+								m_bItemCut = true;
+							}
+
+							if ( ImGui::Selectable( ICON_FA_TRASH " Delete" ) )
+							{
+								if ( m_Selected == id )
+								{
+									m_sFilepathToAction = path.string();
+									m_eFileAction = Events::EFileAction::Delete;
+								}
 							}
 						}
-					}
 
-					if ( ImGui::Selectable( ICON_FA_PEN " Rename" ) )
-					{
-						// TODO: Rename file
-					}
+						if ( ImGui::Selectable( ICON_FA_PEN " Rename" ) )
+						{
+							// TODO: Rename file
+						}
 
-					ImGui::SeparatorText( "File Exporer" );
+						ImGui::SeparatorText( "File Exporer" );
 
-					if ( ImGui::Selectable( ICON_FA_FILE_ALT " Open File Location" ) )
-					{
-						Scion::Filesystem::FileProcessor fp{};
-						if ( !fp.OpenFileLocation( path.string() ) )
+						if ( ImGui::Selectable( ICON_FA_FILE_ALT " Open File Location" ) )
 						{
-							SCION_ERROR( "Failed to open file location [{}]", path.string() );
+							Scion::Filesystem::FileProcessor fp{};
+							if ( !fp.OpenFileLocation( path.string() ) )
+							{
+								SCION_ERROR( "Failed to open file location [{}]", path.string() );
+							}
 						}
+
+						bItemPop = true;
+						ImGui::EndPopup();
 					}
 
-					bItemPop = true;
-					ImGui::EndPopup();
-				}
+					ImGui::SetNextItemWidth( 80.f );
+					ImGui::TextWrapped( entry.sFilename.c_str() );
 
-				ImGui::SetNextItemWidth( 80.f );
-				ImGui::TextWrapped( filenameStr.c_str() );
+					if ( !ImGui::IsPopupOpen( "", ImGuiPopupFlags_AnyPopupId | ImGuiPopupFlags_AnyPopupLevel ) &&
+						 bItemPop )
+					{
+						popID = 0;
+						bItemPop = false;
+					}
 
-				if ( !ImGui::IsPopupOpen( "", ImGuiPopupFlags_AnyPopupId | ImGuiPopupFlags_AnyPopupLevel ) && bItemPop )
-				{
-					popID = 0;
-					bItemPop = false;
+					ImGui::PopID();
 				}
-
-				ImGui::PopID();
-				++itr;
 			}
 		}
 
@@ -332,7 +349,7 @@ void ContentDisplay::DrawToolbar()
 				finalPath /= rebuildPath;
 			}
 
-			m_CurrentDir = finalPath;
+			ChangeDirectory( finalPath );
 		}
 
 		ImGui::SameLine();
@@ -351,6 +368,59 @@ void ContentDisplay::DrawToolbar()
 	ImGui::Separator();
 }
 
+void ContentDisplay::ChangeDirectory( const std::filesystem::path& path )
+{
+	m_CurrentDir = path;
+	m_Selected = -1;
+	m_bEntriesDirty = true;
+}
+
+void ContentDisplay::RefreshEntries()
+{
+	SCION_PROFILE_SCOPE( "ContentDisplay::RefreshEntries" );
+
+	// The selection is an index into the entries, keep the path so it can be found again after the refresh.
+	fs::path selectedPath{};
+	if ( m_Selected >= 0 && m_Selected < static_cast<int>( m_Entries.size() ) )
+		selectedPath = m_Entries[ m_Selected ].path;
+
+	m_Entries.clear();
+	m_bEntriesDirty = false;
+
+	std::error_code ec;
+	for ( const auto& dirEntry : fs::directory_iterator( m_CurrentDir, ec ) )
+	{
+		// A broken entry, such as a dangling link, is listed as a file rather than failing the whole directory.
+		std::error_code entryEc;
+		const auto& path = dirEntry.path();
+		m_Entries.push_back( ContentEntry{ .path = path,
+										   .sFilename = path.filename().string(),
+										   .pIcon = GetIconTexture( path.string() ),
+										   .bDirectory = dirEntry.is_directory( entryEc ) } );
+	}
+
+	if ( ec )
+	{
+		SCION_ERROR( "Failed to read directory [{}] -- {}", m_CurrentDir.string(), ec.message() );
+	}
+
+	std::ranges::sort( m_Entries, []( const ContentEntry& a, const ContentEntry& b ) {
+		if ( a.bDirectory != b.bDirectory )
+			return a.bDirectory;
+
+		return a.sFilename < b.sFilename;
+	} );
+
+	// The selected entry moves when files are added or removed, and is cleared if it no longer exists.
+	m_Selected = -1;
+	if ( !selectedPath.empty() )
+	{
+		auto itSelected = std::ranges::find( m_Entries, selectedPath, &ContentEntry::path );
+		if ( itSelected != m_Entries.end() )
+			m_Selected = static_cast<int>( std::distance( m_Entries.begin(), itSelected ) );
+	}
+}
+
 void ContentDisplay::CopyDroppedFile( const std::string& sFileToCopy, const std::filesystem::path& droppedPath )
 {
 	if ( droppedPath.empty() )
@@ -427,6 +497,8 @@ void ContentDisplay::HandleFileEvent( const Scion::Editor::Events::FileEvent& fi
 	if ( fileEvent.sFilepath.empty() || fileEvent.eAction == EFileAction::NoAction )
 		return;
 
+	m_bEntriesDirty = true;
+
 	auto& pProjectInfo = MAIN_REGISTRY().GetContext<Scion::Core::ProjectInfoPtr>();
 	if ( !pProjectInfo )
 		return;
@@ -611,6 +683,7 @@ void ContentDisplay::OpenCreateFolderPopup()
 				m_sFilepathToAction.clear();
 				newFolderStr.clear();
 				errorText.clear();
+				m_bEntriesDirty = true;
 				ImGui::CloseCurrentPopup();
 			}
 		}
@@ -701,6 +774,7 @@ void ContentDisplay::OpenCreateLuaClassPopup()
 				className.clear();
 				m_eCreateAction = EContentCreateAction::NoAction;
 				m_sFilepathToAction.clear();
+				m_bEntriesDirty = true;
 				ImGui::CloseCurrentPopup();
 			}
 		}
@@ -816,6 +890,7 @@ void ContentDisplay::OpenCreateLuaStateClassPopup()
 				bStateNameEntered = false;
 				m_eCreateAction = EContentCreateAction::NoAction;
 				m_sFilepathToAction.clear();
+				m_bEntriesDirty = true;
 				ImGui::CloseCurrentPopup();
 			}
 		}
@@ -893,6 +968,7 @@ void ContentDisplay::OpenCreateLuaTablePopup()
 				tableName.clear();
 				m_eCreateAction = EContentCreateAction::NoAction;
 				m_sFilepathToAction.clear();
+				m_bEntriesDirty = true;
 				ImGui::CloseCurrentPopup();
 			}
 		}
@@ -969,6 +1045,7 @@ void ContentDisplay::OpenCreateEmptyLuaFilePopup()
 				tableName.clear();
 				m_eCreateAction = EContentCreateAction::NoAction;
 				m_sFilepathToAction.clear();
+				m_bEntriesDirty = true;
 				ImGui::CloseCurrentPopup();
 			}
 		}
@@ -7,20 +7,16 @@ namespace Scion::Editor
 {
 void LogDisplay::GetLogs()
 {
-	const auto& logs{ SCION_GET_LOGS() };
-	if ( logs.size() == m_LogIndex )
-		return;
+	m_NewLogs.clear();
+	m_LogIndex = SCION_GET_LOGS( m_LogIndex, m_NewLogs );
 
-	for ( size_t i = m_LogIndex; i < logs.size(); ++i )
+	for ( const auto& log : m_NewLogs )
 	{
-		const auto& log = logs[ i ];
 		int oldTextSize = m_TextBuffer.size();
 		m_TextBuffer.append( log.log.c_str() );
 		m_TextBuffer.append( "\n" );
 		m_TextOffsets.push_back( oldTextSize );
 	}
-
-	m_LogIndex = static_cast<int>( logs.size() );
 }
 
 LogDisplay::LogDisplay()
@@ -30,6 +26,7 @@ LogDisplay::LogDisplay()
 	, m_bShowWarn{ true }
 	, m_bShowError{ true }
 	, m_LogIndex{ 0 }
+	, m_NewLogs{}
 {
 }
 
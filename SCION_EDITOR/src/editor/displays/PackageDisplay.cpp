@@ -16,6 +16,7 @@
 
 #include <imgui.h>
 #include <imgui_stdlib.h>
+#include <SDL.h>
 
 namespace fs = std::filesystem;
 using namespace Scion::Filesystem;
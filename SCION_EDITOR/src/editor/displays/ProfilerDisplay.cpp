@@ -0,0 +1,440 @@
+#include "editor/displays/ProfilerDisplay.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Sounds/SoundPlayer/SoundFxPlayer.h"
+#include "Sounds/Mixer/SoftwareMixer.h"
+#include "Sounds/Mixer/MixKernels.h"
+#include "editor/scene/SceneManager.h"
+#include "editor/scene/SceneObject.h"
+#include "editor/utilities/fonts/IconsFontAwesome5.h"
+
+#include "Rendering/Utils/GPUProfiler.h"
+#include "ScionUtilities/Profiler.h"
+#include "ScionFilesystem/Dialogs/FileDialog.h"
+#include "ScionFilesystem/Serializers/JSONSerializer.h"
+#include "Logger/Logger.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <fmt/format.h>
+#include <imgui.h>
+#include <imgui_stdlib.h>
+#include <sol/sol.hpp>
+
+using namespace Scion::Rendering;
+using namespace Scion::Utilities;
+
+namespace Scion::Editor
+{
+namespace
+{
+template <typename TValue>
+TValue Percentile( const std::vector<TValue>& sortedValues, std::size_t percent )
+{
+	return sortedValues[ std::min( sortedValues.size() - 1, sortedValues.size() * percent / 100 ) ];
+}
+} // namespace
+
+ProfilerDisplay::ProfilerDisplay()
+	: m_LastFrameTime{ std::chrono::steady_clock::now() }
+	, m_bFirstFrame{ true }
+	, m_FrameTimes( PROFILER_HISTORY_SIZE, 0.f )
+	, m_FrameIndex{ 0 }
+	, m_NumFrames{ 0 }
+	, m_SortedTimes{}
+	, m_LastSample{}
+	, m_CapturedFrames{}
+	, m_NumFramesToCapture{ 600 }
+	, m_sCaptureFile{ "profiler_capture.json" }
+	, m_bCapturing{ false }
+{
+	m_SortedTimes.reserve( PROFILER_HISTORY_SIZE );
+}
+
+void ProfilerDisplay::Update()
+{
+	// The profiler tree and the render stats are from the frame that just finished, so time that frame as well.
+	const auto now = std::chrono::steady_clock::now();
+	const double frameMs = std::chrono::duration<double, std::milli>( now - m_LastFrameTime ).count();
+	m_LastFrameTime = now;
+
+	if ( m_bFirstFrame )
+	{
+		m_bFirstFrame = false;
+		return;
+	}
+
+	m_FrameTimes[ m_FrameIndex ] = static_cast<float>( frameMs );
+	m_FrameIndex = ( m_FrameIndex + 1 ) % PROFILER_HISTORY_SIZE;
+	m_NumFrames = std::min( m_NumFrames + 1, PROFILER_HISTORY_SIZE );
+
+	m_LastSample.frameMs = frameMs;
+	for ( std::size_t i = 0; i < PROFILED_SYSTEMS.size(); ++i )
+		m_LastSample.systemMs[ i ] = GetZoneMs( PROFILED_SYSTEMS[ i ].sZone );
+
+	m_LastSample.renderStats = RenderStats::GetLastFrame();
+	m_LastSample.luaHeapBytes = GetLuaHeapBytes();
+	m_LastSample.voiceStats = MAIN_REGISTRY().GetSoundPlayer().GetStats();
+
+	if ( !m_bCapturing )
+		return;
+
+	m_CapturedFrames.push_back( m_LastSample );
+	if ( m_CapturedFrames.size() >= static_cast<std::size_t>( m_NumFramesToCapture ) )
+	{
+		WriteCapture();
+		m_bCapturing = false;
+	}
+}
+
+void ProfilerDisplay::Draw()
+{
+	if ( !ImGui::Begin( ICON_FA_CHART_LINE " Profiler" ) )
+	{
+		ImGui::End();
+		return;
+	}
+
+	DrawCapture();
+	ImGui::Separator();
+	DrawFrameTimes();
+
+	if ( ImGui::CollapsingHeader( "Systems", ImGuiTreeNodeFlags_DefaultOpen ) )
+		DrawSystems();
+
+	if ( ImGui::CollapsingHeader( "Rendering", ImGuiTreeNodeFlags_DefaultOpen ) )
+		DrawRenderStats();
+
+	if ( ImGui::CollapsingHeader( "GPU", ImGuiTreeNodeFlags_DefaultOpen ) )
+		DrawGPUZones();
+
+	if ( ImGui::CollapsingHeader( "Audio" ) )
+		DrawAudioStats();
+
+	if ( ImGui::CollapsingHeader( "Frame Zones" ) )
+		DrawFrameTree();
+
+	ImGui::End();
+}
+
+void ProfilerDisplay::DrawFrameTimes()
+{
+	if ( m_NumFrames == 0 )
+		return;
+
+	m_SortedTimes.assign( m_FrameTimes.begin(), m_FrameTimes.begin() + m_NumFrames );
+	std::sort( m_SortedTimes.begin(), m_SortedTimes.end() );
+
+	const float avgMs = std::accumulate( m_SortedTimes.begin(), m_SortedTimes.end(), 0.f ) / m_SortedTimes.size();
+	const float lastMs = static_cast<float>( m_LastSample.frameMs );
+	const std::string sOverlay = fmt::format( "{:.2f}ms ({:.0f} fps)", lastMs, lastMs > 0.f ? 1000.f / lastMs : 0.f );
+
+	// Once the ring is full, the oldest frame is the next one to be overwritten.
+	const int offset = m_NumFrames < PROFILER_HISTORY_SIZE ? 0 : static_cast<int>( m_FrameIndex );
+
+	ImGui::PlotLines( "##FrameTimes",
+					  m_FrameTimes.data(),
+					  static_cast<int>( m_NumFrames ),
+					  offset,
+					  sOverlay.c_str(),
+					  0.f,
+					  m_SortedTimes.back() * 1.1f,
+					  ImVec2{ ImGui::GetContentRegionAvail().x, 80.f } );
+
+	ImGui::Text( "Avg: %.2fms  P50: %.2fms  P95: %.2fms  P99: %.2fms  Max: %.2fms",
+				 avgMs,
+				 Percentile( m_SortedTimes, 50 ),
+				 Percentile( m_SortedTimes, 95 ),
+				 Percentile( m_SortedTimes, 99 ),
+				 m_SortedTimes.back() );
+}
+
+void ProfilerDisplay::DrawSystems()
+{
+	if ( !Profiler::GetInstance().IsEnabled() )
+	{
+		ImGui::TextDisabled( "The profiler zones are disabled." );
+		return;
+	}
+
+	if ( !ImGui::BeginTable( "##ProfiledSystems", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV ) )
+		return;
+
+	ImGui::TableSetupColumn( "System" );
+	ImGui::TableSetupColumn( "Time (ms)" );
+	ImGui::TableSetupColumn( "Frame %" );
+	ImGui::TableHeadersRow();
+
+	for ( std::size_t i = 0; i < PROFILED_SYSTEMS.size(); ++i )
+	{
+		const double systemMs = m_LastSample.systemMs[ i ];
+
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted( PROFILED_SYSTEMS[ i ].sLabel );
+		ImGui::TableNextColumn();
+		ImGui::Text( "%.3f", systemMs );
+		ImGui::TableNextColumn();
+		ImGui::Text( "%.1f", m_LastSample.frameMs > 0.0 ? systemMs / m_LastSample.frameMs * 100.0 : 0.0 );
+	}
+
+	ImGui::EndTable();
+}
+
+void ProfilerDisplay::DrawRenderStats()
+{
+	const auto& renderStats = m_LastSample.renderStats;
+
+	ImGui::Text( "Draw Calls / Batches: %u", renderStats.drawCalls );
+	ImGui::Text( "Vertices Drawn: %llu", static_cast<unsigned long long>( renderStats.verticesDrawn ) );
+	ImGui::Text( "Vertex Uploads: %u", renderStats.vertexUploads );
+	ImGui::Text( "Vertices Uploaded: %llu (%.1f KB)",
+				 static_cast<unsigned long long>( renderStats.verticesUploaded ),
+				 renderStats.bytesUploaded / 1024.0 );
+
+	if ( m_LastSample.luaHeapBytes > 0 )
+		ImGui::Text( "Lua Heap: %.1f KB", m_LastSample.luaHeapBytes / 1024.0 );
+	else
+		ImGui::TextDisabled( "Lua Heap: No scene is playing." );
+}
+
+void ProfilerDisplay::DrawGPUZones()
+{
+	const auto& gpuProfiler = GPUProfiler::GetInstance();
+	if ( !gpuProfiler.IsActive() )
+	{
+		ImGui::TextDisabled( "The GPU zones are disabled." );
+		return;
+	}
+
+	const auto& renderStats = m_LastSample.renderStats;
+	ImGui::Text( "GPU Frame: %.3fms  Dropped Frames: %llu",
+				 renderStats.gpuMs,
+				 static_cast<unsigned long long>( gpuProfiler.GetNumDroppedFrames() ) );
+
+	if ( !ImGui::BeginTable( "##GPUZones", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV ) )
+		return;
+
+	ImGui::TableSetupColumn( "Zone" );
+	ImGui::TableSetupColumn( "Time (ms)" );
+	ImGui::TableSetupColumn( "Calls" );
+	ImGui::TableHeadersRow();
+
+	for ( const auto& zone : renderStats.gpuZones )
+	{
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted( zone.sName );
+		ImGui::TableNextColumn();
+		ImGui::Text( "%.3f", zone.ms );
+		ImGui::TableNextColumn();
+		ImGui::Text( "%u", zone.numCalls );
+	}
+
+	ImGui::EndTable();
+}
+
+void ProfilerDisplay::DrawAudioStats()
+{
+	const auto& voiceStats = m_LastSample.voiceStats;
+
+	ImGui::Text( "Active Voices: %d / %d", voiceStats.activeVoices, voiceStats.numChannels );
+	ImGui::Text( "Played: %llu", static_cast<unsigned long long>( voiceStats.numPlayed ) );
+	ImGui::Text( "Stolen: %llu", static_cast<unsigned long long>( voiceStats.numStolen ) );
+	ImGui::Text( "Rejected: %llu", static_cast<unsigned long long>( voiceStats.numRejected ) );
+	ImGui::Text( "Deduplicated: %llu", static_cast<unsigned long long>( voiceStats.numDeduplicated ) );
+
+	auto& softwareMixer = MAIN_REGISTRY().GetSoftwareMixer();
+	const auto& mixerStats = softwareMixer.GetStats();
+
+	ImGui::SeparatorText( "Software Mixer" );
+	if ( !softwareMixer.IsAttached() )
+	{
+		ImGui::TextDisabled( "Not attached to the audio device." );
+		return;
+	}
+
+	ImGui::Text( "Kernels: %s", Scion::Sounds::MixKernels::GetInstructionSet() );
+	ImGui::Text( "Active Voices: %d / %zu", mixerStats.activeVoices, Scion::Sounds::MAX_MIXER_VOICES );
+	ImGui::Text( "Rejected: %llu", static_cast<unsigned long long>( mixerStats.numRejected ) );
+	ImGui::Text( "Dropped Commands: %llu", static_cast<unsigned long long>( mixerStats.numDroppedCommands ) );
+}
+
+void ProfilerDisplay::DrawFrameTree()
+{
+	const auto& frameTree = Profiler::GetInstance().GetFrameTree();
+	if ( frameTree.empty() )
+	{
+		ImGui::TextDisabled( "No frames have been profiled." );
+		return;
+	}
+
+	if ( !ImGui::BeginTable( "##FrameZones", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV ) )
+		return;
+
+	ImGui::TableSetupColumn( "Zone" );
+	ImGui::TableSetupColumn( "Total (ms)" );
+	ImGui::TableSetupColumn( "Self (ms)" );
+	ImGui::TableSetupColumn( "Calls" );
+	ImGui::TableHeadersRow();
+
+	for ( const auto& node : frameTree )
+	{
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::Text( "%*s%s", static_cast<int>( node.depth * 2 ), "", node.sName );
+		ImGui::TableNextColumn();
+		ImGui::Text( "%.3f", node.totalMs );
+		ImGui::TableNextColumn();
+		ImGui::Text( "%.3f", node.selfMs );
+		ImGui::TableNextColumn();
+		ImGui::Text( "%u", node.numCalls );
+	}
+
+	ImGui::EndTable();
+}
+
+void ProfilerDisplay::DrawCapture()
+{
+	auto& profiler = Profiler::GetInstance();
+	bool bProfilerEnabled = profiler.IsEnabled();
+	if ( ImGui::Checkbox( "Profile Zones", &bProfilerEnabled ) )
+		profiler.SetEnabled( bProfilerEnabled );
+
+	ImGui::SameLine( 0.f, 8.f );
+	auto& gpuProfiler = GPUProfiler::GetInstance();
+	bool bGPUProfilerEnabled = gpuProfiler.IsEnabled();
+	if ( ImGui::Checkbox( "Profile GPU", &bGPUProfilerEnabled ) )
+		gpuProfiler.SetEnabled( bGPUProfilerEnabled );
+
+	ImGui::SameLine( 0.f, 16.f );
+
+	ImGui::BeginDisabled( m_bCapturing );
+	ImGui::SetNextItemWidth( 100.f );
+	if ( ImGui::InputInt( "Frames", &m_NumFramesToCapture ) )
+		m_NumFramesToCapture = std::max( m_NumFramesToCapture, 1 );
+
+	ImGui::SameLine( 0.f, 8.f );
+	ImGui::SetNextItemWidth( 250.f );
+	ImGui::InputText( "##CaptureFile", &m_sCaptureFile );
+
+	ImGui::SameLine( 0.f, 8.f );
+	if ( ImGui::Button( ICON_FA_FOLDER "##BrowseCaptureFile" ) )
+	{
+		Scion::Filesystem::FileDialog fd{};
+		const auto sFilepath = fd.SaveFileDialog( "Save Capture", m_sCaptureFile, { "*.json" }, "Json (*.json)" );
+		if ( !sFilepath.empty() )
+			m_sCaptureFile = sFilepath;
+	}
+
+	ImGui::SameLine( 0.f, 8.f );
+	if ( ImGui::Button( "Capture" ) && !m_sCaptureFile.empty() )
+	{
+		m_CapturedFrames.clear();
+		m_CapturedFrames.reserve( m_NumFramesToCapture );
+		m_bCapturing = true;
+	}
+	ImGui::EndDisabled();
+
+	if ( m_bCapturing )
+	{
+		ImGui::SameLine( 0.f, 16.f );
+		ImGui::Text( "Capturing %zu / %d", m_CapturedFrames.size(), m_NumFramesToCapture );
+	}
+}
+
+void ProfilerDisplay::WriteCapture()
+{
+	if ( m_CapturedFrames.empty() )
+		return;
+
+	std::vector<double> sortedTimes;
+	sortedTimes.reserve( m_CapturedFrames.size() );
+	for ( const auto& frame : m_CapturedFrames )
+		sortedTimes.push_back( frame.frameMs );
+
+	std::sort( sortedTimes.begin(), sortedTimes.end() );
+
+	try
+	{
+		Scion::Filesystem::JSONSerializer serializer{ m_sCaptureFile, 4 };
+		serializer.StartDocument();
+		serializer.StartNewObject( "summary" )
+			.AddKeyValuePair( "frames", sortedTimes.size() )
+			.AddKeyValuePair( "avgMs",
+							  std::accumulate( sortedTimes.begin(), sortedTimes.end(), 0.0 ) / sortedTimes.size() )
+			.AddKeyValuePair( "p50Ms", Percentile( sortedTimes, 50 ) )
+			.AddKeyValuePair( "p95Ms", Percentile( sortedTimes, 95 ) )
+			.AddKeyValuePair( "p99Ms", Percentile( sortedTimes, 99 ) )
+			.AddKeyValuePair( "maxMs", sortedTimes.back() )
+			.EndObject();
+
+		serializer.StartNewArray( "frames" );
+		for ( const auto& frame : m_CapturedFrames )
+		{
+			serializer.StartNewObject()
+				.AddKeyValuePair( "frameMs", frame.frameMs )
+				.AddKeyValuePair( "drawCalls", frame.renderStats.drawCalls )
+				.AddKeyValuePair( "verticesDrawn", frame.renderStats.verticesDrawn )
+				.AddKeyValuePair( "vertexUploads", frame.renderStats.vertexUploads )
+				.AddKeyValuePair( "verticesUploaded", frame.renderStats.verticesUploaded )
+				.AddKeyValuePair( "bytesUploaded", frame.renderStats.bytesUploaded )
+				.AddKeyValuePair( "luaHeapBytes", frame.luaHeapBytes )
+				.AddKeyValuePair( "gpuMs", frame.renderStats.gpuMs )
+				.AddKeyValuePair( "activeVoices", frame.voiceStats.activeVoices )
+				.AddKeyValuePair( "voicesStolen", frame.voiceStats.numStolen )
+				.AddKeyValuePair( "voicesRejected", frame.voiceStats.numRejected );
+
+			serializer.StartNewObject( "systemsMs" );
+			for ( std::size_t i = 0; i < PROFILED_SYSTEMS.size(); ++i )
+				serializer.AddKeyValuePair( PROFILED_SYSTEMS[ i ].sZone, frame.systemMs[ i ] );
+
+			serializer.EndObject();
+
+			serializer.StartNewObject( "gpuZonesMs" );
+			for ( const auto& zone : frame.renderStats.gpuZones )
+				serializer.AddKeyValuePair( zone.sName, zone.ms );
+
+			serializer.EndObject();
+			serializer.EndObject();
+		}
+		serializer.EndArray();
+		serializer.EndDocument();
+
+		SCION_LOG( "Wrote [{}] profiled frames to [{}]", m_CapturedFrames.size(), m_sCaptureFile );
+	}
+	catch ( const std::exception& ex )
+	{
+		SCION_ERROR( "Failed to write the profiler capture to [{}] - {}", m_sCaptureFile, ex.what() );
+	}
+
+	m_CapturedFrames.clear();
+}
+
+double ProfilerDisplay::GetZoneMs( const char* sZone ) const
+{
+	double zoneMs{ 0.0 };
+	for ( const auto& node : Profiler::GetInstance().GetFrameTree() )
+	{
+		if ( std::strcmp( node.sName, sZone ) == 0 )
+			zoneMs += node.totalMs;
+	}
+
+	return zoneMs;
+}
+
+std::size_t ProfilerDisplay::GetLuaHeapBytes() const
+{
+	auto pCurrentScene = SCENE_MANAGER().GetCurrentSceneObject();
+	if ( !pCurrentScene )
+		return 0;
+
+	// The lua state only exists while the scene is playing.
+	auto* pLuaState = pCurrentScene->GetRuntimeRegistry().TryGetContext<std::shared_ptr<sol::state>>();
+	if ( !pLuaState || !*pLuaState )
+		return 0;
+
+	return ( *pLuaState )->memory_used();
+}
+
+} // namespace Scion::Editor
@@ -2,6 +2,7 @@
 #include "Rendering/Buffers/Framebuffer.h"
 #include "Rendering/Core/Camera2D.h"
 #include "Rendering/Core/Renderer.h"
+#include "Rendering/Utils/GPUProfiler.h"
 #include "Core/ECS/MainRegistry.h"
 #include "Core/ECS/Components/AllComponents.h"
 #include "Core/Systems/AnimationSystem.h"
@@ -9,7 +10,10 @@
 #include "Core/Systems/RenderUISystem.h"
 #include "Core/Systems/RenderShapeSystem.h"
 #include "Core/Systems/PhysicsSystem.h"
+#include "Core/Systems/ParticleSystem.h"
 #include "Core/Systems/ScriptingSystem.h"
+#include "Core/Systems/VisibilitySystem.h"
+#include "Core/Systems/AudioSystem.h"
 #include "Core/CoreUtilities/CoreEngineData.h"
 
 #include "Logger/Logger.h"
@@ -20,6 +24,7 @@
 
 #include "Sounds/MusicPlayer/MusicPlayer.h"
 #include "Sounds/SoundPlayer/SoundFxPlayer.h"
+#include "Sounds/Mixer/SoftwareMixer.h"
 #include "Physics/Box2DWrappers.h"
 #include "Physics/ContactListener.h"
 #include "Core/Resources/AssetManager.h"
@@ -212,6 +217,8 @@ void SceneDisplay::UnloadScene()
 	auto& mainRegistry = MAIN_REGISTRY();
 	mainRegistry.GetMusicPlayer().Stop();
 	mainRegistry.GetSoundPlayer().Stop( -1 );
+	mainRegistry.GetSoftwareMixer().StopAll();
+	mainRegistry.GetAudioSystem().SetListenerEntity( entt::null );
 }
 
 void SceneDisplay::RenderScene() const
@@ -220,12 +227,15 @@ void SceneDisplay::RenderScene() const
 	auto& editorFramebuffers = mainRegistry.GetContext<std::shared_ptr<EditorFramebuffers>>();
 	auto& renderer = mainRegistry.GetContext<std::shared_ptr<Scion::Rendering::Renderer>>();
 
+	auto& visibilitySystem = mainRegistry.GetVisibilitySystem();
 	auto& renderSystem = mainRegistry.GetRenderSystem();
 	auto& renderUISystem = mainRegistry.GetRenderUISystem();
 	auto& renderShapeSystem = mainRegistry.GetRenderShapeSystem();
+	auto& particleSystem = mainRegistry.GetParticleSystem();
 
 	const auto& fb = editorFramebuffers->mapFramebuffers[ FramebufferType::SCENE ];
 
+	SCION_GPU_ZONE( "Scene Framebuffer" );
 	fb->Bind();
 	renderer->SetViewport( 0, 0, fb->Width(), fb->Height() );
 	renderer->SetClearColor( 0.f, 0.f, 0.f, 1.f );
@@ -237,7 +247,9 @@ void SceneDisplay::RenderScene() const
 	{
 		auto& runtimeRegistry = pCurrentScene->GetRuntimeRegistry();
 		auto& camera = runtimeRegistry.GetContext<std::shared_ptr<Camera2D>>();
+		visibilitySystem.Update( runtimeRegistry, *camera );
 		renderSystem.Update( runtimeRegistry, *camera );
+		particleSystem.Render( runtimeRegistry, *camera );
 
 		if ( CORE_GLOBALS().RenderCollidersEnabled() )
 		{
@@ -473,7 +485,12 @@ void SceneDisplay::Update()
 	pPhysicsSystem.Update( runtimeRegistry );
 
 	auto& animationSystem = mainRegistry.GetAnimationSystem();
-	animationSystem.Update( runtimeRegistry, *camera );
+	animationSystem.Update( runtimeRegistry, coreGlobals.GetDeltaTime() );
+
+	auto& particleSystem = mainRegistry.GetParticleSystem();
+	particleSystem.Update( runtimeRegistry, coreGlobals.GetDeltaTime() );
+
+	mainRegistry.GetAudioSystem().Update( runtimeRegistry, *camera );
 
 	runtimeRegistry.ClearPendingEntities();
 }
@@ -8,6 +8,7 @@
 #include "Core/Systems/RenderShapeSystem.h"
 #include "Core/Systems/RenderPickingSystem.h"
 #include "Core/Systems/AnimationSystem.h"
+#include "Core/Systems/VisibilitySystem.h"
 
 #include "Core/CoreUtilities/CoreEngineData.h"
 #include "Core/CoreUtilities/Prefab.h"
@@ -19,6 +20,7 @@
 #include "Rendering/Core/Camera2D.h"
 #include "Rendering/Core/Renderer.h"
 #include "Rendering/Essentials/PickingTexture.h"
+#include "Rendering/Utils/GPUProfiler.h"
 
 #include "editor/systems/GridSystem.h"
 #include "editor/systems/EditorRenderSystem.h"
@@ -48,6 +50,7 @@ using namespace Scion::Windowing::Inputs;
 
 #include "Logger/Logger.h"
 #include <imgui.h>
+#include <SDL.h>
 
 #ifdef __linux
 #include <signal.h>
@@ -70,56 +73,74 @@ void TilemapDisplay::RenderTilemap()
 	auto& renderUISystem = mainRegistry.GetRenderUISystem();
 	auto& renderShapeSystem = mainRegistry.GetRenderShapeSystem();
 
+	// Cull once for the picking and the tilemap render.
+	if ( pCurrentScene )
+		mainRegistry.GetVisibilitySystem().Update( pCurrentScene->GetRegistry(), *m_pTilemapCam );
+
 	auto pActiveGizmo = TOOL_MANAGER().GetActiveGizmo();
 	auto& mouse = INPUT_MANAGER().GetMouse();
+	auto& pPickingTexture = mainRegistry.GetContext<std::shared_ptr<PickingTexture>>();
+
+	// Select the entity of a picking read that has finished. The read is only used if the
+	// scene it was started in is still the current scene.
+	uint32_t pickedID{ 0 };
+	if ( pPickingTexture && pPickingTexture->TryGetPixel( pickedID ) && pCurrentScene &&
+		 pCurrentScene->GetRegistryPtr() == m_pPickingRegistry )
+	{
+		auto id = static_cast<entt::entity>( pickedID );
+
+		if ( !pCurrentScene->GetRegistry().IsValid( static_cast<entt::entity>( id ) ) )
+		{
+			id = entt::null;
+		}
+		else
+		{
+			Scion::Core::ECS::Entity checkedEntity{ pCurrentScene->GetRegistryPtr(), static_cast<entt::entity>( id ) };
+			if ( checkedEntity.HasComponent<Scion::Core::ECS::TileComponent>() )
+			{
+				id = entt::null;
+			}
+		}
+
+		SCENE_MANAGER().GetToolManager().SetSelectedEntity( id );
+	}
 
 	if ( pActiveGizmo && pActiveGizmo->IsOverTilemapWindow() && !pActiveGizmo->OverGizmo() &&
 		 !ImGui::GetDragDropPayload() && mouse.IsBtnJustPressed( SCION_MOUSE_LEFT ) )
 	{
 		auto& renderPickingSystem = mainRegistry.GetContext<std::shared_ptr<RenderPickingSystem>>();
-		// Handle the picking texture/system
-		if ( renderPickingSystem && pCurrentScene )
-		{
-			auto& pPickingTexture = mainRegistry.GetContext<std::shared_ptr<PickingTexture>>();
-			if ( pPickingTexture )
-			{
-				renderer->SetCapability( Renderer::GLCapability::BLEND, false );
-				pPickingTexture->Bind();
-				renderer->SetViewport( 0, 0, pPickingTexture->GetWidth(), pPickingTexture->GetHeight() );
-				renderer->SetClearColor( 0.f, 0.f, 0.f, 0.f );
-				renderer->ClearBuffers( true, true );
+		const auto& pos = pActiveGizmo->GetMouseScreenCoords();
 
-				renderPickingSystem->Update( pCurrentScene->GetRegistry(), *m_pTilemapCam );
+		// A click at the same position is still being read back, drawing the picking pass again would not change it.
+		const bool bPickPending = pPickingTexture && pPickingTexture->HasPendingRead() && pos == m_PickingMousePos;
 
-				const auto& pos = pActiveGizmo->GetMouseScreenCoords();
-				auto id = static_cast<entt::entity>(
-					pPickingTexture->ReadPixel( static_cast<int>( pos.x ), static_cast<int>( pos.y ) ) );
+		// Handle the picking texture/system
+		if ( renderPickingSystem && pCurrentScene && pPickingTexture && !bPickPending )
+		{
+			SCION_GPU_ZONE( "Picking Framebuffer" );
+			renderer->SetCapability( Renderer::GLCapability::BLEND, false );
+			// Resizing drops the pending reads, it must happen before the pixel of this pass is requested.
+			pPickingTexture->CheckResize();
+			pPickingTexture->Bind();
+			renderer->SetViewport( 0, 0, pPickingTexture->GetWidth(), pPickingTexture->GetHeight() );
+			renderer->SetClearColor( 0.f, 0.f, 0.f, 0.f );
+			renderer->ClearBuffers( true, true );
 
-				if ( !pCurrentScene->GetRegistry().IsValid( static_cast<entt::entity>( id ) ) )
-				{
-					id = entt::null;
-				}
-				else
-				{
-					Scion::Core::ECS::Entity checkedEntity{ pCurrentScene->GetRegistryPtr(),
-														   static_cast<entt::entity>( id ) };
-					if ( checkedEntity.HasComponent<Scion::Core::ECS::TileComponent>() )
-					{
-						id = entt::null;
-					}
-				}
+			renderPickingSystem->Update( pCurrentScene->GetRegistry(), *m_pTilemapCam );
 
-				SCENE_MANAGER().GetToolManager().SetSelectedEntity( id );
-			}
+			// The id is read back asynchronously and selected once the GPU has finished the pass.
+			pPickingTexture->RequestPixel( static_cast<int>( pos.x ), static_cast<int>( pos.y ) );
+			m_PickingMousePos = pos;
+			m_pPickingRegistry = pCurrentScene->GetRegistryPtr();
 
 			pPickingTexture->Unbind();
-			pPickingTexture->CheckResize();
 			renderer->SetCapability( Renderer::GLCapability::BLEND, true );
 		}
 	}
 
 	const auto& fb = editorFramebuffers->mapFramebuffers[ FramebufferType::TILEMAP ];
 
+	SCION_GPU_ZONE( "Tilemap Framebuffer" );
 	fb->Bind();
 	renderer->SetViewport( 0, 0, fb->Width(), fb->Height() );
 	renderer->SetClearColor( 0.f, 0.f, 0.f, 1.f );
@@ -330,6 +351,11 @@ void TilemapDisplay::AddPrefabbedEntityToScene( const Scion::Core::PrefabbedEnti
 		newEnt.AddComponent<TextComponent>( prefabbed.textComp.value() );
 	}
 
+	if ( prefabbed.particleEmitter )
+	{
+		newEnt.AddComponent<ParticleEmitterComponent>( prefabbed.particleEmitter.value() );
+	}
+
 	if ( prefabbed.physics )
 	{
 		newEnt.AddComponent<PhysicsComponent>( prefabbed.physics.value() );
@@ -502,6 +528,8 @@ void TilemapDisplay::DrawToolbar()
 
 TilemapDisplay::TilemapDisplay()
 	: m_pTilemapCam{ std::make_unique<Scion::Rendering::Camera2D>() }
+	, m_PickingMousePos{ 0.f }
+	, m_pPickingRegistry{ nullptr }
 	, m_bWindowActive{ false }
 {
 	ADD_EVENT_HANDLER( Scion::Core::Events::KeyEvent, &TilemapDisplay::HandleKeyPressedEvent, *this );
@@ -634,7 +662,7 @@ void TilemapDisplay::Update()
 	{
 		auto& mainRegistry = MAIN_REGISTRY();
 		auto& animationSystem = mainRegistry.GetAnimationSystem();
-		animationSystem.Update( pCurrentScene->GetRegistry(), *m_pTilemapCam );
+		animationSystem.Update( pCurrentScene->GetRegistry(), ImGui::GetIO().DeltaTime );
 	}
 
 	m_pTilemapCam->Update();
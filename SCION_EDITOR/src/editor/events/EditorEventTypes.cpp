@@ -15,7 +15,8 @@ static std::map<EComponentType, std::string> g_mapComponentToStr
 	{ EComponentType::RigidBody, "RigidBodyComponent" },
 	{ EComponentType::BoxCollider, "BoxColliderComponent" },
 	{ EComponentType::CircleCollider, "CircleColliderComponent" },
-	{ EComponentType::Tile, "TileComponent" }
+	{ EComponentType::Tile, "TileComponent" },
+	{ EComponentType::ParticleEmitter, "ParticleEmitterComponent" }
 };
 // clang-format on
 
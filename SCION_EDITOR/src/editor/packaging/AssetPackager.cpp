@@ -108,6 +108,50 @@ void AssetPackager::ConvertAssetToLuaTable( Scion::Filesystem::LuaSerializer& lu
 	}
 }
 
+void AssetPackager::AddAssetToPack( Scion::Filesystem::LuaSerializer& luaSerializer,
+									const AssetConversionData& conversionData, std::ofstream& pack,
+									std::uint64_t& packOffset )
+{
+	std::ifstream in{ conversionData.sInAssetFile, std::ios::in | std::ios::binary };
+	if ( !in.is_open() )
+		throw std::runtime_error( fmt::format( "Failed to open file [{}].", conversionData.sInAssetFile ) );
+
+	fs::path assetPath{ conversionData.sInAssetFile };
+
+	pack << in.rdbuf();
+	const auto packEnd = static_cast<std::uint64_t>( pack.tellp() );
+	if ( !pack || packEnd < packOffset )
+	{
+		throw std::runtime_error( fmt::format( "Failed to write [{}] at path [{}] to the asset pack.",
+											   conversionData.sAssetName,
+											   conversionData.sInAssetFile ) );
+	}
+
+	const std::uint64_t assetSize = packEnd - packOffset;
+
+	try
+	{
+		luaSerializer.StartNewTable()
+			.AddKeyValuePair( "assetName", conversionData.sAssetName, true, false, false, true )
+			.AddKeyValuePair( "assetExt", assetPath.extension().string(), true, false, false, true )
+			.AddKeyValuePair(
+				"assetType", Scion::Utilities::AssetTypeToStr( conversionData.eType ), true, false, false, true )
+			.AddKeyValuePair( "packOffset", packOffset )
+			.AddKeyValuePair( "dataEnd", assetSize - 1ull )
+			.AddKeyValuePair( "dataSize", assetSize )
+			.EndTable(); // sAssetNum
+	}
+	catch ( const std::exception& ex )
+	{
+		throw std::runtime_error( fmt::format( "Failed to write [{}] at path [{}] to asset file. Error: {}",
+											   conversionData.sAssetName,
+											   conversionData.sInAssetFile,
+											   ex.what() ) );
+	}
+
+	packOffset = packEnd;
+}
+
 void AssetPackager::CreateLuaAssetFiles( const std::string& sProjectPath, const rapidjson::Value& assets )
 {
 	if ( !fs::exists( fs::path{ m_Params.sTempFilepath } ) )
@@ -218,6 +262,18 @@ bool AssetPackager::CreateAssetsZip()
 		}
 	}
 
+	const fs::path musicPack{ fs::path{ m_Params.sAssetsPath } / Scion::Utilities::MUSIC_PACK_FILENAME };
+	if ( fs::exists( musicPack ) )
+	{
+		std::error_code ec;
+		if ( !fs::copy_file(
+				 musicPack, assetsDestination / musicPack.filename(), fs::copy_options::overwrite_existing, ec ) )
+		{
+			SCION_ERROR( "Failed to copy the music pack to [{}] - {}", assetsDestination.string(), ec.message() );
+			return false;
+		}
+	}
+
 	assetsDestination /= "ScionAssets.zip";
 	libzippp::ZipArchive zip{ assetsDestination.string() };
 
@@ -321,6 +377,21 @@ AssetPackager::AssetPackageStatus AssetPackager::SerializeAssetsByType( const ra
 
 		pLuaSerializer->StartNewTable( "S2D_Assets" );
 
+		// Music is kept out of the lua tables, in a pack the runtime streams it from.
+		std::ofstream pack{};
+		std::uint64_t packOffset{ 0 };
+		if ( eAssetType == Scion::Utilities::AssetType::MUSIC )
+		{
+			pack.open( tempAssetsPath / Scion::Utilities::MUSIC_PACK_FILENAME,
+					   std::ios::out | std::ios::binary | std::ios::trunc );
+
+			if ( !pack.is_open() )
+			{
+				return { .sError = fmt::format( "Failed to create the music pack in [{}].", tempAssetsPath.string() ),
+						 .bSuccess = false };
+			}
+		}
+
 		try
 		{
 			for ( const auto& jsonValue : assetArray.GetArray() )
@@ -339,7 +410,10 @@ AssetPackager::AssetPackageStatus AssetPackager::SerializeAssetsByType( const ra
 					conversionData.optPixelArt = jsonValue[ "bPixelArt" ].GetBool();
 				}
 
-				ConvertAssetToLuaTable( *pLuaSerializer, conversionData);
+				if ( pack.is_open() )
+					AddAssetToPack( *pLuaSerializer, conversionData, pack, packOffset );
+				else
+					ConvertAssetToLuaTable( *pLuaSerializer, conversionData);
 			}
 		}
 		catch ( const std::exception& ex )
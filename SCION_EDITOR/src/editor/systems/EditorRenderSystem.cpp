@@ -2,6 +2,7 @@
 #include "Core/Resources/AssetManager.h"
 #include "Core/ECS/Components/AllComponents.h"
 #include "Core/ECS/MainRegistry.h"
+#include "Core/Systems/VisibilitySystem.h"
 #include "Core/CoreUtilities/CoreUtilities.h"
 #include <Rendering/Core/Camera2D.h>
 #include <Rendering/Essentials/Shader.h>
@@ -49,7 +50,7 @@ void EditorRenderSystem::Update( Scion::Core::ECS::Registry& registry, Scion::Re
 
 	m_pBatchRenderer->Begin();
 
-	auto spriteView = registry.GetRegistry().view<SpriteComponent, TransformComponent>( entt::exclude<UIComponent> );
+	auto& reg = registry.GetRegistry();
 	std::function<bool( entt::entity )> filterFunc;
 
 	// Check to see if the layers are visible, if not, filter them out.
@@ -61,10 +62,10 @@ void EditorRenderSystem::Update( Scion::Core::ECS::Registry& registry, Scion::Re
 	{
 		filterFunc = [ & ]( entt::entity entity ) {
 			// We only want to filter tiles
-			if ( !registry.GetRegistry().all_of<TileComponent>( entity ) )
+			if ( !reg.all_of<TileComponent>( entity ) )
 				return true;
 
-			const auto& sprite = spriteView.get<SpriteComponent>( entity );
+			const auto& sprite = reg.get<SpriteComponent>( entity );
 			if ( sprite.layer >= 0 )
 			{
 				auto layerItr = std::ranges::find_if( layerFilters, [ &sprite ]( const auto& layerParams ) {
@@ -78,14 +79,16 @@ void EditorRenderSystem::Update( Scion::Core::ECS::Registry& registry, Scion::Re
 		};
 	}
 
-	for ( const auto& entity : std::views::filter( spriteView, filterFunc ) )
+	// The sprites have already been culled by the visibility system.
+	const auto& visibleEntities = Scion::Core::Systems::VisibilitySystem::GetVisibleEntities( registry );
+	for ( const auto& entity : std::views::filter( visibleEntities, filterFunc ) )
 	{
-		const auto& transform = spriteView.get<TransformComponent>( entity );
-		const auto& sprite = spriteView.get<SpriteComponent>( entity );
-
-		if ( !Scion::Core::EntityInView( transform, sprite.width, sprite.height, camera ) )
+		if ( reg.all_of<UIComponent>( entity ) )
 			continue;
 
+		const auto& transform = reg.get<TransformComponent>( entity );
+		const auto& sprite = reg.get<SpriteComponent>( entity );
+
 		if ( sprite.sTextureName.empty() || sprite.bHidden )
 			continue;
 
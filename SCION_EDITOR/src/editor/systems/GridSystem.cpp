@@ -5,6 +5,7 @@
 #include "Rendering/Core/Camera2D.h"
 #include "Rendering/Essentials/Primitives.h"
 #include "Rendering/Essentials/Vertex.h"
+#include "Rendering/Utils/GPUProfiler.h"
 #include <Rendering/Essentials/Shader.h>
 #include <Rendering/Essentials/Texture.h>
 
@@ -21,22 +22,15 @@ GridSystem::GridSystem()
 
 void GridSystem::Update( Scion::Core::Scene& currentScene, Scion::Rendering::Camera2D& camera )
 {
+	SCION_GPU_ZONE( "GridSystem::Update" );
+
 	if ( currentScene.GetMapType() == EMapType::IsoGrid )
 	{
 		UpdateIso( currentScene, camera );
 		return;
 	}
 
-	auto& assetManager = MAIN_REGISTRY().GetAssetManager();
 	const auto& canvas = currentScene.GetCanvas();
-	auto camMat = camera.GetCameraMatrix();
-
-	auto pColorShader = assetManager.GetShader( "color" );
-
-	pColorShader->Enable();
-	pColorShader->SetUniformMat4( "uProjection", camMat );
-
-	m_pBatchRenderer->Begin();
 
 	int tileWidth{ canvas.tileWidth }, tileHeight{ canvas.tileHeight };
 	int canvasWidth{ canvas.width }, canvasHeight{ canvas.height };
@@ -44,46 +38,16 @@ void GridSystem::Update( Scion::Core::Scene& currentScene, Scion::Rendering::Cam
 	int cols = canvasWidth / tileWidth;
 	int rows = canvasHeight / tileHeight;
 
-	Scion::Rendering::Color color{};
-
-	for ( int row = 0; row < rows; row++ )
-	{
-		for ( int col = 0; col < cols; col++ )
-		{
-			// Create the checkboard colors
-			if ( ( col - row ) % 2 == 0 && ( row - col ) % 2 == 0 )
-				color = { 125, 125, 125, 70 };
-			else
-				color = { 200, 200, 200, 70 };
-
-			Scion::Rendering::Rect rect{
-				.position = glm::vec2{ static_cast<float>( col * tileWidth ), static_cast<float>( row * tileHeight ) },
-				.width = static_cast<float>( tileWidth ),
-				.height = static_cast<float>( tileHeight ),
-				.color = color };
-
-			m_pBatchRenderer->AddRect( rect );
-		}
-	}
-
-	m_pBatchRenderer->End();
-	m_pBatchRenderer->Render();
-
-	pColorShader->Disable();
+	DrawGrid( camera,
+			  glm::vec4{ 0.f, 0.f, static_cast<float>( cols * tileWidth ), static_cast<float>( rows * tileHeight ) },
+			  glm::vec2{ static_cast<float>( tileWidth ), static_cast<float>( tileHeight ) },
+			  glm::vec2{ static_cast<float>( cols ), static_cast<float>( rows ) },
+			  false );
 }
 
 void GridSystem::UpdateIso( Scion::Core::Scene& currentScene, Scion::Rendering::Camera2D& camera )
 {
-	auto& assetManager = MAIN_REGISTRY().GetAssetManager();
 	const auto& canvas = currentScene.GetCanvas();
-	auto camMat = camera.GetCameraMatrix();
-
-	auto pColorShader = assetManager.GetShader( "color" );
-
-	pColorShader->Enable();
-	pColorShader->SetUniformMat4( "uProjection", camMat );
-
-	m_pBatchRenderer->Begin();
 
 	// Hard-coded, forcing tilewidth to be 2x canvas tile width.
 	// TODO: This needs to be adjusted to automatically change the width/height when
@@ -99,36 +63,54 @@ void GridSystem::UpdateIso( Scion::Core::Scene& currentScene, Scion::Rendering::
 	int cols = canvasWidth / tileWidth;
 	int rows = canvasHeight / tileHeight;
 
-	Scion::Rendering::Color color{};
+	// Cell (row, col) is a diamond centered at ( ( 1 + row - col ) * half width, ( 1 + row + col ) * half height ).
+	// Currently we are not going to use the canvas offset. We have control of the camera, so going into the negatives
+	// should not really matter.
+	const float left = static_cast<float>( -( cols - 1 ) * tileHalfWidth );
+	const float right = static_cast<float>( ( rows + 1 ) * tileHalfWidth );
+	const float bottom = static_cast<float>( ( rows + cols ) * tileHalfHeight );
+
+	DrawGrid( camera,
+			  glm::vec4{ left, 0.f, right - left, bottom },
+			  glm::vec2{ static_cast<float>( tileHalfWidth ), static_cast<float>( tileHalfHeight ) },
+			  glm::vec2{ static_cast<float>( cols ), static_cast<float>( rows ) },
+			  true );
+}
 
-	for ( int row = 0; row < rows; row++ )
-	{
-		for ( int col = 0; col < cols; col++ )
-		{
-			// Create the checkboard colors
-			if ( ( col - row ) % 2 == 0 && ( row - col ) % 2 == 0 )
-				color = { 125, 125, 125, 70 };
-			else
-				color = { 200, 200, 200, 70 };
-
-			// Currently we are not going to use the canvas offset. We have control of the camera, so going into the negatives
-			// should not really matter.
-			Scion::Rendering::Rect rect{ .position =
-											glm::vec2{ static_cast<float>( ( /*canvas.offset.x +*/ tileHalfWidth ) +
-																		   ( row - col ) * tileHalfWidth ),
-													   static_cast<float>( ( row + col ) * tileHalfHeight ) },
-										.width = static_cast<float>( tileWidth ),
-										.height = static_cast<float>( tileHeight ),
-										.color = color };
-
-			m_pBatchRenderer->AddIsoRect( rect );
-		}
-	}
+void GridSystem::DrawGrid( Scion::Rendering::Camera2D& camera, const glm::vec4& gridRect, const glm::vec2& cellSize,
+						   const glm::vec2& gridSize, bool bIsometric )
+{
+	if ( gridSize.x <= 0.f || gridSize.y <= 0.f )
+		return;
 
+	auto pGridShader = MAIN_REGISTRY().GetAssetManager().GetShader( "grid" );
+	if ( !pGridShader )
+		return;
+
+	// Create the checkboard colors
+	const Scion::Rendering::Color evenColor{ 125, 125, 125, 70 };
+	const Scion::Rendering::Color oddColor{ 200, 200, 200, 70 };
+
+	pGridShader->Enable();
+	pGridShader->SetUniformMat4( "uProjection", camera.GetCameraMatrix() );
+	pGridShader->SetUniformVec2( "uCellSize", cellSize );
+	pGridShader->SetUniformVec2( "uGridSize", gridSize );
+	pGridShader->SetUniformInt( "uIsometric", bIsometric ? 1 : 0 );
+	pGridShader->SetUniformVec4(
+		"uEvenColor", evenColor.r / 255.f, evenColor.g / 255.f, evenColor.b / 255.f, evenColor.a / 255.f );
+	pGridShader->SetUniformVec4(
+		"uOddColor", oddColor.r / 255.f, oddColor.g / 255.f, oddColor.b / 255.f, oddColor.a / 255.f );
+
+	// The cells are worked out in the shader, so the whole canvas is one quad.
+	m_pBatchRenderer->Begin();
+	m_pBatchRenderer->AddRect( Scion::Rendering::Rect{ .position = glm::vec2{ gridRect.x, gridRect.y },
+													   .width = gridRect.z,
+													   .height = gridRect.w,
+													   .color = evenColor } );
 	m_pBatchRenderer->End();
 	m_pBatchRenderer->Render();
 
-	pColorShader->Disable();
+	pGridShader->Disable();
 }
 
 } // namespace Scion::Editor
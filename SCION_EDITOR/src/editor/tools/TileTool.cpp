@@ -1,6 +1,7 @@
 #include "editor/tools/TileTool.h"
 #include "Logger/Logger.h"
 #include "editor/utilities/EditorUtilities.h"
+#include "editor/utilities/TileSpatialIndex.h"
 #include "Core/ECS/MainRegistry.h"
 #include "Core/Resources/AssetManager.h"
 #include "Core/CoreUtilities/CoreUtilities.h"
@@ -24,44 +25,11 @@ uint32_t TileTool::CheckForTile( const glm::vec2& position )
 	if ( !m_pRegistry )
 		return entt::null;
 
-	auto tileView = m_pRegistry->GetRegistry().view<TileComponent, TransformComponent>();
+	// Iso Grids, we check at the center of the tile if there is an entity.
+	const bool bIsometric = !m_pCurrentScene || m_pCurrentScene->GetMapType() != Scion::Core::EMapType::Grid;
 
-	for ( auto entity : tileView )
-	{
-		Entity tile{ m_pRegistry, entity };
-		const auto& transform = tile.GetComponent<TransformComponent>();
-		const auto& sprite = tile.GetComponent<SpriteComponent>();
-
-		if ( m_pCurrentScene && m_pCurrentScene->GetMapType() == Scion::Core::EMapType::Grid )
-		{
-			if ( position.x >= transform.position.x &&
-				 position.x < transform.position.x + sprite.width * transform.scale.x &&
-				 position.y >= transform.position.y &&
-				 position.y < transform.position.y + sprite.height * transform.scale.y &&
-				 m_pMouseTile->sprite.layer == sprite.layer )
-			{
-				return static_cast<uint32_t>( entity );
-			}
-		}
-		else // Iso Grids, we check at the center of the tile if there is an entity.
-		{
-			// Get the center pos of the sprite
-			int spriteCenterX = transform.position.x + ( ( sprite.width * transform.scale.x ) / 2.f );
-			int spriteCenterY = transform.position.y + ( ( sprite.height * transform.scale.y ) / 2.f );
-
-			// Get the offset of the position + sprite center
-			int positionOffsetX = position.x + ( ( sprite.width * transform.scale.x ) / 2.f );
-			int positionOffsetY = position.y + ( ( sprite.height * transform.scale.y ) / 2.f );
-
-			if ( positionOffsetX == spriteCenterX && positionOffsetY == spriteCenterY &&
-				 m_pMouseTile->sprite.layer == sprite.layer )
-			{
-				return static_cast<uint32_t>( entity );
-			}
-		}
-	}
-
-	return entt::null;
+	return static_cast<uint32_t>(
+		TileSpatialIndex::Get( *m_pRegistry ).FindTile( position, m_pMouseTile->sprite.layer, bIsometric ) );
 }
 
 Scion::Core::ECS::Entity TileTool::CreateEntity()
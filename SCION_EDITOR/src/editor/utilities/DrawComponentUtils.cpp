@@ -613,6 +613,113 @@ void DrawComponentsUtil::DrawImGuiComponent( Scion::Core::ECS::TextComponent& te
 	ImGui::PopID();
 }
 
+void DrawComponentsUtil::DrawImGuiComponent( Scion::Core::ECS::ParticleEmitterComponent& emitter )
+{
+	ImGui::SeparatorText( "Particle Emitter Component" );
+	ImGui::PushID( entt::type_hash<ParticleEmitterComponent>::value() );
+	if ( ImGui::TreeNodeEx( "", ImGuiTreeNodeFlags_DefaultOpen ) )
+	{
+		const auto DrawRange = []( const char* sLabel, const char* sToolTip, float& min, float& max ) {
+			ImGui::InlineLabel( sLabel );
+			ImGui::ItemToolTip( sToolTip );
+			ImGui::PushID( sLabel );
+			ImGui::ColoredLabel( "min", ImVec2{ 32.f, 20.f }, LABEL_BLUE );
+			ImGui::SameLine();
+			ImGui::InputFloat( "##min", &min, 0.1f, 1.f, "%.2f" );
+			ImGui::SameLine();
+			ImGui::ColoredLabel( "max", ImVec2{ 32.f, 20.f }, LABEL_BLUE );
+			ImGui::SameLine();
+			ImGui::InputFloat( "##max", &max, 0.1f, 1.f, "%.2f" );
+			ImGui::PopID();
+		};
+
+		const auto DrawVec2 = []( const char* sLabel, const char* sToolTip, glm::vec2& value ) {
+			ImGui::InlineLabel( sLabel );
+			ImGui::ItemToolTip( sToolTip );
+			ImGui::PushID( sLabel );
+			ImGui::ColoredLabel( "x", LABEL_SINGLE_SIZE, LABEL_RED );
+			ImGui::SameLine();
+			ImGui::InputFloat( "##x", &value.x, 1.f, 10.f, "%.1f" );
+			ImGui::SameLine();
+			ImGui::ColoredLabel( "y", LABEL_SINGLE_SIZE, LABEL_GREEN );
+			ImGui::SameLine();
+			ImGui::InputFloat( "##y", &value.y, 1.f, 10.f, "%.1f" );
+			ImGui::PopID();
+		};
+
+		const auto DrawColor = []( const char* sLabel, Scion::Rendering::Color& color ) {
+			ImVec4 col = { color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f };
+			ImGui::InlineLabel( sLabel );
+			ImGui::PushID( sLabel );
+			if ( ImGui::ColorEdit4( "##color", &col.x, IMGUI_COLOR_PICKER_FLAGS ) )
+			{
+				color.r = static_cast<GLubyte>( col.x * 255.f );
+				color.g = static_cast<GLubyte>( col.y * 255.f );
+				color.b = static_cast<GLubyte>( col.z * 255.f );
+				color.a = static_cast<GLubyte>( col.w * 255.f );
+			}
+			ImGui::PopID();
+		};
+
+		auto& assetManager = MAIN_REGISTRY().GetAssetManager();
+
+		std::string sSelectedTexture{ emitter.sTextureName };
+		ImGui::InlineLabel( "texture" );
+		ImGui::ItemToolTip( "The texture drawn for each particle. Leave empty to draw solid squares." );
+		if ( ImGui::BeginCombo( "##texture", sSelectedTexture.c_str() ) )
+		{
+			if ( ImGui::Selectable( "None", sSelectedTexture.empty() ) )
+				emitter.sTextureName.clear();
+
+			for ( const auto& sTextureName : assetManager.GetAssetKeyNames( Scion::Utilities::AssetType::TEXTURE ) )
+			{
+				if ( ImGui::Selectable( sTextureName.c_str(), sTextureName == sSelectedTexture ) )
+					emitter.sTextureName = sTextureName;
+			}
+			ImGui::EndCombo();
+		}
+
+		ImGui::PushItemWidth( 120.f );
+		ImGui::InlineLabel( "emitting" );
+		ImGui::Checkbox( "##emitting", &emitter.bEmitting );
+
+		ImGui::InlineLabel( "emit rate" );
+		ImGui::ItemToolTip( "Particles emitted each second." );
+		if ( ImGui::InputFloat( "##emitRate", &emitter.emitRate, 1.f, 10.f, "%.1f" ) )
+			emitter.emitRate = std::max( emitter.emitRate, 0.f );
+
+		ImGui::InlineLabel( "max particles" );
+		ImGui::ItemToolTip( "The most particles the emitter can have alive at once." );
+		if ( ImGui::InputInt( "##maxParticles", &emitter.maxParticles, 100, 1000 ) )
+			emitter.maxParticles = std::clamp( emitter.maxParticles, 0, 1000000 );
+
+		DrawRange( "lifetime", "Lifetime of each particle in seconds.", emitter.minLifetime, emitter.maxLifetime );
+		emitter.minLifetime = std::max( emitter.minLifetime, 0.f );
+		emitter.maxLifetime = std::max( emitter.maxLifetime, emitter.minLifetime );
+
+		DrawVec2( "min velocity", "Smallest starting velocity, in pixels per second.", emitter.minVelocity );
+		DrawVec2( "max velocity", "Largest starting velocity, in pixels per second.", emitter.maxVelocity );
+		DrawVec2( "acceleration", "Applied to every particle, in pixels per second squared.", emitter.acceleration );
+		DrawVec2( "spawn offset", "Offset of the spawn area from the position of the entity.", emitter.spawnOffset );
+		DrawVec2( "spawn area", "Particles spawn at a random position inside this area.", emitter.spawnArea );
+
+		ImGui::InlineLabel( "start size" );
+		ImGui::InputFloat( "##startSize", &emitter.startSize, 1.f, 4.f, "%.1f" );
+		ImGui::InlineLabel( "end size" );
+		ImGui::InputFloat( "##endSize", &emitter.endSize, 1.f, 4.f, "%.1f" );
+
+		DrawColor( "start color", emitter.startColor );
+		DrawColor( "end color", emitter.endColor );
+
+		ImGui::InlineLabel( "hidden" );
+		ImGui::Checkbox( "##hidden", &emitter.bHidden );
+
+		ImGui::PopItemWidth();
+		ImGui::TreePop();
+	}
+	ImGui::PopID();
+}
+
 void DrawComponentsUtil::DrawImGuiComponent( Scion::Core::ECS::Identification& identification )
 {
 	ImGui::SeparatorText( "Identificaton" );
@@ -751,6 +858,12 @@ void DrawComponentsUtil::DrawImGuiComponent( Scion::Core::ECS::Entity& entity,
 	DrawImGuiComponent( textComponent );
 }
 
+void DrawComponentsUtil::DrawImGuiComponent( Scion::Core::ECS::Entity& entity,
+											 Scion::Core::ECS::ParticleEmitterComponent& emitter )
+{
+	DrawImGuiComponent( emitter );
+}
+
 void DrawComponentsUtil::DrawImGuiComponent( Scion::Core::ECS::Entity& entity,
 											 Scion::Core::ECS::Identification& identification )
 {
@@ -0,0 +1,352 @@
+#include "editor/utilities/ThumbnailCache.h"
+#include "ScionUtilities/ThreadPool.h"
+#include "ScionUtilities/Profiler.h"
+#include "Logger/Logger.h"
+
+#include <glad/glad.h>
+#include <SOIL2/SOIL2.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace Scion::Editor
+{
+/* The mip levels of the atlas stop at 8 pixel cells, smaller levels would blend neighbouring thumbnails. */
+constexpr int THUMBNAIL_ATLAS_MAX_LEVEL = 4;
+constexpr int THUMBNAIL_ATLAS_CELLS = THUMBNAIL_ATLAS_SIZE / THUMBNAIL_SIZE;
+/* How often the write time of a used image is checked, so the asset browser does not touch the disk every frame. */
+constexpr std::chrono::milliseconds THUMBNAIL_RECHECK_INTERVAL{ 1000 };
+
+/* Bumped when the layout of the cached files changes, so old files are made again. */
+constexpr std::uint32_t THUMBNAIL_FILE_VERSION = 1;
+
+struct ThumbnailFileHeader
+{
+	char magic[ 4 ]{ 'S', '2', 'D', 'T' };
+	std::uint32_t version{ THUMBNAIL_FILE_VERSION };
+	std::int32_t width{ 0 };
+	std::int32_t height{ 0 };
+};
+
+/* The cache file names must be the same every run, so std::hash is not used. */
+static std::uint64_t HashPath( const std::string& sPath )
+{
+	std::uint64_t hash{ 14695981039346656037ull };
+	for ( unsigned char c : sPath )
+	{
+		hash ^= c;
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+ThumbnailCache::ThumbnailCache( const std::filesystem::path& cacheDir )
+	: m_CacheDir{ cacheDir }
+	, m_mapThumbnails{}
+	, m_AtlasPages{}
+	, m_NextCell{ 0 }
+	, m_FinishedMutex{}
+	, m_FinishedImages{}
+	, m_bStopping{ false }
+	, m_pThreadPool{ std::make_unique<Scion::Utilities::ThreadPool>( 1 ) }
+{
+	std::error_code ec;
+	fs::create_directories( m_CacheDir, ec );
+	if ( ec )
+	{
+		SCION_ERROR( "Failed to create thumbnail cache directory [{}] -- {}", m_CacheDir.string(), ec.message() );
+	}
+}
+
+ThumbnailCache::~ThumbnailCache()
+{
+	m_bStopping = true;
+	m_pThreadPool.reset();
+
+	if ( !m_AtlasPages.empty() )
+		glDeleteTextures( static_cast<GLsizei>( m_AtlasPages.size() ), m_AtlasPages.data() );
+}
+
+const Thumbnail* ThumbnailCache::GetThumbnail( const std::string& sFilepath )
+{
+	if ( sFilepath.empty() )
+		return nullptr;
+
+	auto [ entryItr, bAdded ] = m_mapThumbnails.try_emplace( sFilepath );
+	auto& entry = entryItr->second;
+	const auto now = std::chrono::steady_clock::now();
+
+	if ( bAdded )
+	{
+		entry.lastChecked = now;
+		QueueThumbnail( sFilepath, entry );
+	}
+	else if ( !entry.bQueued && now - entry.lastChecked >= THUMBNAIL_RECHECK_INTERVAL )
+	{
+		// Hot reloaded images keep their path, only the write time tells that the thumbnail is out of date.
+		entry.lastChecked = now;
+
+		std::error_code ec;
+		const auto writeTime = fs::last_write_time( sFilepath, ec );
+		if ( !ec && writeTime.time_since_epoch().count() != entry.writeTime )
+			QueueThumbnail( sFilepath, entry );
+	}
+
+	return entry.thumbnail.textureID != 0 ? &entry.thumbnail : nullptr;
+}
+
+void ThumbnailCache::QueueThumbnail( const std::string& sFilepath, ThumbnailEntry& entry )
+{
+	entry.bQueued = true;
+
+	m_pThreadPool->Enqueue( [ this, sFilepath ] {
+		if ( m_bStopping )
+			return;
+
+		auto image = CreateThumbnail( sFilepath );
+
+		std::lock_guard lock{ m_FinishedMutex };
+		m_FinishedImages.push_back( std::move( image ) );
+	} );
+}
+
+void ThumbnailCache::Update()
+{
+	std::vector<ThumbnailImage> finishedImages;
+	{
+		std::lock_guard lock{ m_FinishedMutex };
+		if ( m_FinishedImages.empty() )
+			return;
+
+		finishedImages.swap( m_FinishedImages );
+	}
+
+	SCION_PROFILE_SCOPE( "ThumbnailCache::Update" );
+
+	std::vector<unsigned int> dirtyPages;
+	for ( const auto& image : finishedImages )
+	{
+		auto& entry = m_mapThumbnails[ image.sFilepath ];
+		entry.bQueued = false;
+		entry.writeTime = image.writeTime;
+
+		if ( image.pixels.empty() )
+			continue;
+
+		// A changed image is written over its old cell, so reloading images does not fill up the atlas.
+		entry.thumbnail = AddToAtlas( image, entry.thumbnail.textureID != 0 ? &entry.thumbnail : nullptr );
+
+		if ( std::ranges::find( dirtyPages, entry.thumbnail.textureID ) == dirtyPages.end() )
+			dirtyPages.push_back( entry.thumbnail.textureID );
+	}
+
+	// Regenerate the mips once per page, not once per thumbnail.
+	for ( unsigned int page : dirtyPages )
+	{
+		glBindTexture( GL_TEXTURE_2D, page );
+		glGenerateMipmap( GL_TEXTURE_2D );
+	}
+
+	glBindTexture( GL_TEXTURE_2D, 0 );
+}
+
+ThumbnailCache::ThumbnailImage ThumbnailCache::CreateThumbnail( const std::string& sFilepath ) const
+{
+	ThumbnailImage image{ .sFilepath = sFilepath };
+
+	std::error_code ec;
+	const auto writeTime = fs::last_write_time( sFilepath, ec );
+	if ( ec )
+	{
+		SCION_ERROR( "Failed to create thumbnail for [{}] -- {}", sFilepath, ec.message() );
+		return image;
+	}
+
+	image.writeTime = writeTime.time_since_epoch().count();
+	const fs::path cachePath = GetCachePath( sFilepath, image.writeTime );
+	if ( LoadCachedThumbnail( cachePath, image ) )
+		return image;
+
+	int width{ 0 }, height{ 0 }, channels{ 0 };
+	unsigned char* pSource = SOIL_load_image( sFilepath.c_str(), &width, &height, &channels, SOIL_LOAD_RGBA );
+	if ( !pSource )
+	{
+		SCION_ERROR( "Failed to create thumbnail for [{}] -- {}", sFilepath, SOIL_last_result() );
+		return image;
+	}
+
+	// Keep the aspect of the image, only images larger than a thumbnail are scaled.
+	const float scale = std::min( 1.f, static_cast<float>( THUMBNAIL_SIZE ) / std::max( width, height ) );
+	image.width = std::clamp( static_cast<int>( width * scale + 0.5f ), 1, THUMBNAIL_SIZE );
+	image.height = std::clamp( static_cast<int>( height * scale + 0.5f ), 1, THUMBNAIL_SIZE );
+	image.pixels.resize( static_cast<std::size_t>( image.width ) * image.height * 4 );
+
+	// Box filter, each thumbnail pixel is the average of the source pixels it covers.
+	for ( int y = 0; y < image.height; ++y )
+	{
+		const int sourceY0 = static_cast<int>( static_cast<std::int64_t>( y ) * height / image.height );
+		const int sourceY1 =
+			std::max( sourceY0 + 1, static_cast<int>( static_cast<std::int64_t>( y + 1 ) * height / image.height ) );
+
+		for ( int x = 0; x < image.width; ++x )
+		{
+			const int sourceX0 = static_cast<int>( static_cast<std::int64_t>( x ) * width / image.width );
+			const int sourceX1 =
+				std::max( sourceX0 + 1, static_cast<int>( static_cast<std::int64_t>( x + 1 ) * width / image.width ) );
+
+			std::uint64_t sum[ 4 ]{ 0 };
+			for ( int sourceY = sourceY0; sourceY < sourceY1; ++sourceY )
+			{
+				const unsigned char* pRow = pSource + ( static_cast<std::size_t>( sourceY ) * width + sourceX0 ) * 4;
+				for ( int sourceX = sourceX0; sourceX < sourceX1; ++sourceX, pRow += 4 )
+				{
+					for ( int c = 0; c < 4; ++c )
+						sum[ c ] += pRow[ c ];
+				}
+			}
+
+			const auto count = static_cast<std::uint64_t>( sourceY1 - sourceY0 ) * ( sourceX1 - sourceX0 );
+			unsigned char* pPixel = image.pixels.data() + ( static_cast<std::size_t>( y ) * image.width + x ) * 4;
+			for ( int c = 0; c < 4; ++c )
+				pPixel[ c ] = static_cast<unsigned char>( sum[ c ] / count );
+		}
+	}
+
+	SOIL_free_image_data( pSource );
+
+	SaveCachedThumbnail( cachePath, image );
+	return image;
+}
+
+fs::path ThumbnailCache::GetCachePath( const std::string& sFilepath, std::int64_t writeTime ) const
+{
+	const auto pathHash = HashPath( fs::path{ sFilepath }.lexically_normal().generic_string() );
+	return m_CacheDir / fmt::format( "{:016x}_{:x}.thumb", pathHash, static_cast<std::uint64_t>( writeTime ) );
+}
+
+bool ThumbnailCache::LoadCachedThumbnail( const fs::path& cachePath, ThumbnailImage& image ) const
+{
+	std::ifstream file{ cachePath, std::ios::in | std::ios::binary };
+	if ( !file.is_open() )
+		return false;
+
+	ThumbnailFileHeader header{};
+	ThumbnailFileHeader expected{};
+	if ( !file.read( reinterpret_cast<char*>( &header ), sizeof( header ) ) ||
+		 std::memcmp( header.magic, expected.magic, sizeof( header.magic ) ) != 0 ||
+		 header.version != THUMBNAIL_FILE_VERSION || header.width <= 0 || header.width > THUMBNAIL_SIZE ||
+		 header.height <= 0 || header.height > THUMBNAIL_SIZE )
+	{
+		return false;
+	}
+
+	std::vector<unsigned char> pixels( static_cast<std::size_t>( header.width ) * header.height * 4 );
+	if ( !file.read( reinterpret_cast<char*>( pixels.data() ), static_cast<std::streamsize>( pixels.size() ) ) )
+		return false;
+
+	image.width = header.width;
+	image.height = header.height;
+	image.pixels = std::move( pixels );
+	return true;
+}
+
+void ThumbnailCache::SaveCachedThumbnail( const fs::path& cachePath, const ThumbnailImage& image ) const
+{
+	// Remove the thumbnails of older versions of the image, they are keyed by the same path hash.
+	const std::string sHashPrefix{ cachePath.filename().string().substr( 0, 17 ) };
+
+	std::error_code ec;
+	for ( const auto& entry : fs::directory_iterator( m_CacheDir, ec ) )
+	{
+		if ( entry.path().filename().string().starts_with( sHashPrefix ) )
+			fs::remove( entry.path(), ec );
+	}
+
+	std::ofstream file{ cachePath, std::ios::out | std::ios::binary | std::ios::trunc };
+	if ( !file.is_open() )
+	{
+		SCION_ERROR( "Failed to save thumbnail [{}].", cachePath.string() );
+		return;
+	}
+
+	ThumbnailFileHeader header{ .width = image.width, .height = image.height };
+	file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+	file.write( reinterpret_cast<const char*>( image.pixels.data() ),
+				static_cast<std::streamsize>( image.pixels.size() ) );
+}
+
+Thumbnail ThumbnailCache::AddToAtlas( const ThumbnailImage& image, const Thumbnail* pCell )
+{
+	constexpr float atlasSize = static_cast<float>( THUMBNAIL_ATLAS_SIZE );
+
+	if ( pCell )
+	{
+		const int x = static_cast<int>( pCell->u0 * atlasSize + 0.5f );
+		const int y = static_cast<int>( pCell->v0 * atlasSize + 0.5f );
+
+		// Clear the whole cell, the new image can be smaller than the old one.
+		std::vector<unsigned char> clear( static_cast<std::size_t>( THUMBNAIL_SIZE ) * THUMBNAIL_SIZE * 4 );
+		glBindTexture( GL_TEXTURE_2D, pCell->textureID );
+		glTexSubImage2D(
+			GL_TEXTURE_2D, 0, x, y, THUMBNAIL_SIZE, THUMBNAIL_SIZE, GL_RGBA, GL_UNSIGNED_BYTE, clear.data() );
+		glTexSubImage2D(
+			GL_TEXTURE_2D, 0, x, y, image.width, image.height, GL_RGBA, GL_UNSIGNED_BYTE, image.pixels.data() );
+
+		return Thumbnail{ .textureID = pCell->textureID,
+						  .u0 = pCell->u0,
+						  .v0 = pCell->v0,
+						  .u1 = ( x + image.width ) / atlasSize,
+						  .v1 = ( y + image.height ) / atlasSize };
+	}
+
+	const int cellsPerPage = THUMBNAIL_ATLAS_CELLS * THUMBNAIL_ATLAS_CELLS;
+
+	if ( m_AtlasPages.empty() || m_NextCell == cellsPerPage )
+	{
+		GLuint page{ 0 };
+		glGenTextures( 1, &page );
+		glBindTexture( GL_TEXTURE_2D, page );
+
+		// Clear the page, the edges of the thumbnails are blended with the empty space around them.
+		std::vector<unsigned char> clear( static_cast<std::size_t>( THUMBNAIL_ATLAS_SIZE ) * THUMBNAIL_ATLAS_SIZE * 4 );
+		glTexImage2D( GL_TEXTURE_2D,
+					  0,
+					  GL_RGBA8,
+					  THUMBNAIL_ATLAS_SIZE,
+					  THUMBNAIL_ATLAS_SIZE,
+					  0,
+					  GL_RGBA,
+					  GL_UNSIGNED_BYTE,
+					  clear.data() );
+
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, THUMBNAIL_ATLAS_MAX_LEVEL );
+
+		m_AtlasPages.push_back( page );
+		m_NextCell = 0;
+	}
+
+	const GLuint page = m_AtlasPages.back();
+	const int x = ( m_NextCell % THUMBNAIL_ATLAS_CELLS ) * THUMBNAIL_SIZE;
+	const int y = ( m_NextCell / THUMBNAIL_ATLAS_CELLS ) * THUMBNAIL_SIZE;
+	++m_NextCell;
+
+	glBindTexture( GL_TEXTURE_2D, page );
+	glTexSubImage2D(
+		GL_TEXTURE_2D, 0, x, y, image.width, image.height, GL_RGBA, GL_UNSIGNED_BYTE, image.pixels.data() );
+
+	return Thumbnail{ .textureID = page,
+					  .u0 = x / atlasSize,
+					  .v0 = y / atlasSize,
+					  .u1 = ( x + image.width ) / atlasSize,
+					  .v1 = ( y + image.height ) / atlasSize };
+}
+
+} // namespace Scion::Editor
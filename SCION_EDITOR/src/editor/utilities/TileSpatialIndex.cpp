@@ -0,0 +1,199 @@
+#include "editor/utilities/TileSpatialIndex.h"
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/Components/TileComponent.h"
+#include "Core/ECS/Components/TransformComponent.h"
+#include "Core/ECS/Components/SpriteComponent.h"
+
+#include <cmath>
+
+using namespace Scion::Core::ECS;
+
+namespace Scion::Editor
+{
+namespace
+{
+inline int ToCell( float worldPos )
+{
+	return static_cast<int>( std::floor( worldPos / TILE_INDEX_CELL_SIZE ) );
+}
+
+inline std::int64_t CellKey( int cellX, int cellY )
+{
+	return ( static_cast<std::int64_t>( cellX ) << 32 ) | static_cast<std::uint32_t>( cellY );
+}
+} // namespace
+
+TileSpatialIndex::TileSpatialIndex( Scion::Core::ECS::Registry& registry )
+	: m_Registry{ registry.GetRegistry() }
+	, m_mapCells{}
+	, m_mapTileCells{}
+	, m_bDirty{ true }
+{
+	m_Registry.on_construct<TileComponent>().connect<&TileSpatialIndex::OnTileAdded>( *this );
+	m_Registry.on_destroy<TileComponent>().connect<&TileSpatialIndex::OnTileRemoved>( *this );
+}
+
+entt::entity TileSpatialIndex::FindTile( const glm::vec2& position, int layer, bool bIsometric )
+{
+	if ( m_bDirty )
+		Rebuild();
+
+	if ( !bIsometric )
+	{
+		auto cellItr = m_mapCells.find( CellKey( ToCell( position.x ), ToCell( position.y ) ) );
+		if ( cellItr == m_mapCells.end() )
+			return entt::null;
+
+		for ( auto entity : cellItr->second )
+		{
+			if ( TileMatches( entity, position, layer, false ) )
+				return entity;
+		}
+
+		return entt::null;
+	}
+
+	// Isometric tiles are compared by their truncated centers, so the tile can be
+	// up to a unit away from the position. Check each cell that is that close.
+	const int minCellX = ToCell( position.x - 1.f );
+	const int minCellY = ToCell( position.y - 1.f );
+	const int maxCellX = ToCell( position.x + 1.f );
+	const int maxCellY = ToCell( position.y + 1.f );
+
+	for ( int cellY = minCellY; cellY <= maxCellY; ++cellY )
+	{
+		for ( int cellX = minCellX; cellX <= maxCellX; ++cellX )
+		{
+			auto cellItr = m_mapCells.find( CellKey( cellX, cellY ) );
+			if ( cellItr == m_mapCells.end() )
+				continue;
+
+			for ( auto entity : cellItr->second )
+			{
+				if ( TileMatches( entity, position, layer, true ) )
+					return entity;
+			}
+		}
+	}
+
+	return entt::null;
+}
+
+TileSpatialIndex& TileSpatialIndex::Get( Scion::Core::ECS::Registry& registry )
+{
+	if ( auto* pIndex = registry.TryGetContext<std::shared_ptr<TileSpatialIndex>>() )
+		return **pIndex;
+
+	return *registry.AddToContext<std::shared_ptr<TileSpatialIndex>>( std::make_shared<TileSpatialIndex>( registry ) );
+}
+
+void TileSpatialIndex::OnTileAdded( entt::registry& registry, entt::entity entity )
+{
+	if ( m_bDirty )
+		return;
+
+	if ( !registry.all_of<TransformComponent, SpriteComponent>( entity ) )
+	{
+		m_bDirty = true;
+		return;
+	}
+
+	Insert( entity );
+}
+
+void TileSpatialIndex::OnTileRemoved( entt::registry& registry, entt::entity entity )
+{
+	if ( m_bDirty )
+		return;
+
+	Remove( entity );
+}
+
+void TileSpatialIndex::Insert( entt::entity entity )
+{
+	const auto& transform = m_Registry.get<TransformComponent>( entity );
+	const auto& sprite = m_Registry.get<SpriteComponent>( entity );
+
+	const glm::vec2 extent{ sprite.width * transform.scale.x, sprite.height * transform.scale.y };
+	const glm::vec2 min = glm::min( transform.position, transform.position + extent );
+	const glm::vec2 max = glm::max( transform.position, transform.position + extent );
+
+	const CellRange range{
+		.minX = ToCell( min.x ), .minY = ToCell( min.y ), .maxX = ToCell( max.x ), .maxY = ToCell( max.y ) };
+
+	for ( int cellY = range.minY; cellY <= range.maxY; ++cellY )
+	{
+		for ( int cellX = range.minX; cellX <= range.maxX; ++cellX )
+		{
+			m_mapCells[ CellKey( cellX, cellY ) ].push_back( entity );
+		}
+	}
+
+	m_mapTileCells[ entity ] = range;
+}
+
+void TileSpatialIndex::Remove( entt::entity entity )
+{
+	auto tileItr = m_mapTileCells.find( entity );
+	if ( tileItr == m_mapTileCells.end() )
+		return;
+
+	const auto& range = tileItr->second;
+	for ( int cellY = range.minY; cellY <= range.maxY; ++cellY )
+	{
+		for ( int cellX = range.minX; cellX <= range.maxX; ++cellX )
+		{
+			auto cellItr = m_mapCells.find( CellKey( cellX, cellY ) );
+			if ( cellItr == m_mapCells.end() )
+				continue;
+
+			std::erase( cellItr->second, entity );
+			if ( cellItr->second.empty() )
+				m_mapCells.erase( cellItr );
+		}
+	}
+
+	m_mapTileCells.erase( tileItr );
+}
+
+void TileSpatialIndex::Rebuild()
+{
+	m_mapCells.clear();
+	m_mapTileCells.clear();
+
+	auto tileView = m_Registry.view<TileComponent, TransformComponent, SpriteComponent>();
+	for ( auto entity : tileView )
+	{
+		Insert( entity );
+	}
+
+	m_bDirty = false;
+}
+
+bool TileSpatialIndex::TileMatches( entt::entity entity, const glm::vec2& position, int layer, bool bIsometric ) const
+{
+	const auto& transform = m_Registry.get<TransformComponent>( entity );
+	const auto& sprite = m_Registry.get<SpriteComponent>( entity );
+
+	if ( sprite.layer != layer )
+		return false;
+
+	if ( !bIsometric )
+	{
+		return position.x >= transform.position.x &&
+			   position.x < transform.position.x + sprite.width * transform.scale.x &&
+			   position.y >= transform.position.y &&
+			   position.y < transform.position.y + sprite.height * transform.scale.y;
+	}
+
+	// Get the center pos of the sprite
+	int spriteCenterX = transform.position.x + ( ( sprite.width * transform.scale.x ) / 2.f );
+	int spriteCenterY = transform.position.y + ( ( sprite.height * transform.scale.y ) / 2.f );
+
+	// Get the offset of the position + sprite center
+	int positionOffsetX = position.x + ( ( sprite.width * transform.scale.x ) / 2.f );
+	int positionOffsetY = position.y + ( ( sprite.height * transform.scale.y ) / 2.f );
+
+	return positionOffsetX == spriteCenterX && positionOffsetY == spriteCenterY;
+}
+} // namespace Scion::Editor
@@ -9,25 +9,35 @@
 #include "Core/Events/EventDispatcher.h"
 #include "Core/Events/EngineEventTypes.h"
 #include "Core/Scripting/InputManager.h"
+#include "Core/Scripting/InputRecorder.h"
 #include "Core/Scripting/CrashLoggerTestBindings.h"
 #include "Core/Scripting/ScriptingUtilities.h"
 
 #include "Core/Scene/SceneManager.h"
+#include "Core/Scene/SceneStreamer.h"
 
 #include "Core/Systems/AnimationSystem.h"
 #include "Core/Systems/PhysicsSystem.h"
+#include "Core/Systems/ParticleSystem.h"
 #include "Core/Systems/ScriptingSystem.h"
 #include "Core/Systems/RenderSystem.h"
 #include "Core/Systems/RenderUISystem.h"
 #include "Core/Systems/RenderShapeSystem.h"
+#include "Core/Systems/VisibilitySystem.h"
+#include "Core/Systems/AudioSystem.h"
 
 #include "Physics/Box2DWrappers.h"
 #include "Physics/ContactListener.h"
 
+#include "Sounds/SoundPlayer/SoundFxPlayer.h"
+#include "Sounds/Mixer/SoftwareMixer.h"
+
 #include "Logger/Logger.h"
+#include "ScionUtilities/Profiler.h"
 #include "Logger/CrashLogger.h"
 #include "ScionUtilities/HelperUtilities.h"
 #include "ScionUtilities/ScionUtilities.h"
+#include "ScionUtilities/ThreadPool.h"
 
 #include "Windowing/Window/Window.h"
 #include "Windowing/Inputs/Mouse.h"
@@ -35,6 +45,11 @@
 #include "Windowing/Inputs/Gamepad.h"
 #include "Rendering/Core/Camera2D.h"
 #include "Rendering/Core/Renderer.h"
+#include "Rendering/Utils/NullGLContext.h"
+#include "Rendering/Utils/GPUProfiler.h"
+#include "Rendering/Utils/RenderStats.h"
+
+#include "ScionFilesystem/Serializers/JSONSerializer.h"
 
 #include "Core/Loaders/TilemapLoader.h"
 #include "Core/CoreUtilities/ProjectInfo.h"
@@ -52,11 +67,71 @@ using namespace Scion::Rendering;
 
 namespace Scion::Engine
 {
-RuntimeApp::RuntimeApp()
+RuntimeOptions RuntimeOptions::Parse( int argc, char** argv )
+{
+	RuntimeOptions options{};
+	for ( int i = 1; i < argc; ++i )
+	{
+		std::string_view sArg{ argv[ i ] };
+		if ( sArg == "--headless" )
+		{
+			options.bHeadless = true;
+		}
+		else if ( sArg.starts_with( "--frames=" ) )
+		{
+			auto sCount = sArg.substr( std::string_view{ "--frames=" }.size() );
+			std::uint32_t frameCount{ 0 };
+			if ( std::from_chars( sCount.data(), sCount.data() + sCount.size(), frameCount ).ec == std::errc{} )
+				options.frameCount = frameCount;
+		}
+		else if ( sArg.starts_with( "--stats=" ) )
+		{
+			options.sStatsFile = std::string{ sArg.substr( std::string_view{ "--stats=" }.size() ) };
+		}
+		else if ( sArg.starts_with( "--record=" ) )
+		{
+			options.sRecordFile = std::string{ sArg.substr( std::string_view{ "--record=" }.size() ) };
+		}
+		else if ( sArg.starts_with( "--replay=" ) )
+		{
+			options.sReplayFile = std::string{ sArg.substr( std::string_view{ "--replay=" }.size() ) };
+		}
+		else if ( sArg.starts_with( "--log=" ) )
+		{
+			options.sLogFile = std::string{ sArg.substr( std::string_view{ "--log=" }.size() ) };
+		}
+		else if ( sArg.starts_with( "--trace=" ) )
+		{
+			options.sTraceFile = std::string{ sArg.substr( std::string_view{ "--trace=" }.size() ) };
+		}
+		else if ( sArg.starts_with( "--log-benchmark=" ) )
+		{
+			auto sThreads = sArg.substr( std::string_view{ "--log-benchmark=" }.size() );
+			std::uint32_t numThreads{ 0 };
+			if ( std::from_chars( sThreads.data(), sThreads.data() + sThreads.size(), numThreads ).ec == std::errc{} )
+				options.logBenchmarkThreads = numThreads;
+		}
+		else if ( sArg.starts_with( "--profile-benchmark=" ) )
+		{
+			auto sZones = sArg.substr( std::string_view{ "--profile-benchmark=" }.size() );
+			std::uint32_t numZones{ 0 };
+			if ( std::from_chars( sZones.data(), sZones.data() + sZones.size(), numZones ).ec == std::errc{} )
+				options.profileBenchmarkZones = numZones;
+		}
+	}
+
+	return options;
+}
+
+RuntimeApp::RuntimeApp( const RuntimeOptions& options )
 	: m_pWindow{ nullptr }
+	, m_Options{ options }
+	, m_LogBenchmark{}
+	, m_ProfileBenchmark{}
 	, m_Event{}
 	, m_bRunning{ true }
 	, m_pGameConfig{ std::make_unique<Scion::Core::GameConfig>() }
+	, m_pInputRecorder{ std::make_unique<Scion::Core::InputRecorder>() }
 {
 }
 
@@ -68,13 +143,53 @@ void RuntimeApp::Run()
 {
 	Initialize();
 
+	if ( m_Options.logBenchmarkThreads > 0 )
+		BenchmarkLogger();
+
+	if ( m_Options.profileBenchmarkZones > 0 )
+		BenchmarkProfiler();
+
+	// Frame times are only kept when they are reported, a game that is played normally would grow them forever.
+	const bool bRecordFrameTimes = m_Options.bHeadless || !m_Options.sStatsFile.empty();
+	if ( bRecordFrameTimes && m_Options.frameCount > 0 )
+		m_FrameTimes.reserve( m_Options.frameCount );
+
+	std::uint32_t numFrames{ 0 };
+
 	while ( m_bRunning )
 	{
+		auto frameStart = std::chrono::steady_clock::now();
+		SCION_PROFILE_BEGIN_FRAME();
+
 		ProcessEvents();
 		Update();
 		Render();
+		GPUProfiler::GetInstance().EndFrame();
+		RenderStats::EndFrame();
+
+		SCION_PROFILE_END_FRAME();
+
+		// When running headless, the frames are not capped, so this is the actual cost of the frame.
+		if ( bRecordFrameTimes )
+		{
+			m_FrameTimes.push_back(
+				std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - frameStart ).count() );
+		}
+
+		m_pInputRecorder->NextFrame();
+		++numFrames;
+
+		if ( m_Options.frameCount > 0 && numFrames >= m_Options.frameCount )
+			m_bRunning = false;
+
+		if ( m_pInputRecorder->IsReplayFinished() )
+			m_bRunning = false;
 	}
 
+	if ( !m_Options.sTraceFile.empty() )
+		Scion::Utilities::Profiler::GetInstance().WriteChromeTrace( m_Options.sTraceFile );
+
+	ReportFrameStats();
 	CleanUp();
 }
 
@@ -83,15 +198,27 @@ void RuntimeApp::Initialize()
 	SCION_INIT_LOGS( true, false );
 	SCION_INIT_CRASH_LOGS();
 
+	if ( !m_Options.sLogFile.empty() )
+		Scion::Logger::Logger::GetInstance().SetLogFile( m_Options.sLogFile );
+
+	// Headless runs do not have a video or audio device, use SDL's dummy audio driver so the mixer still opens.
+	if ( m_Options.bHeadless )
+	{
+		SDL_setenv( "SDL_AUDIODRIVER", "dummy", 1 );
+	}
+
 	// Init SDL
-	if ( SDL_Init( SDL_INIT_EVERYTHING ) != 0 )
+	const Uint32 initFlags =
+		m_Options.bHeadless ? SDL_INIT_TIMER | SDL_INIT_AUDIO | SDL_INIT_EVENTS : SDL_INIT_EVERYTHING;
+
+	if ( SDL_Init( initFlags ) != 0 )
 	{
 		std::string error = SDL_GetError();
 		throw std::runtime_error( fmt::format( "Failed to initialize SDL: {}", error ) );
 	}
 
 	// Set up OpenGL
-	if ( SDL_GL_LoadLibrary( NULL ) != 0 )
+	if ( !m_Options.bHeadless && SDL_GL_LoadLibrary( NULL ) != 0 )
 	{
 		std::string error = SDL_GetError();
 		throw std::runtime_error( fmt::format( "Failed to Open GL Library: {}", error ) );
@@ -135,39 +262,18 @@ void RuntimeApp::Initialize()
 
 	auto& coreGlobals = CORE_GLOBALS();
 
-	// Create the Window
-	m_pWindow = std::make_unique<Scion::Windowing::Window>( m_pGameConfig->sGameName.c_str(),
-														   m_pGameConfig->windowWidth,
-														   m_pGameConfig->windowHeight,
-														   SDL_WINDOWPOS_CENTERED,
-														   SDL_WINDOWPOS_CENTERED,
-														   true,
-														   m_pGameConfig->windowFlags | SDL_WINDOW_OPENGL |
-															   SDL_WINDOW_ALLOW_HIGHDPI );
-
-	// Create the openGL context
-	m_pWindow->SetGLContext( SDL_GL_CreateContext( m_pWindow->GetWindow().get() ) );
-
-	// Initialize Glad
-	if ( gladLoadGLLoader( SDL_GL_GetProcAddress ) == 0 )
-	{
-		throw std::runtime_error( "Failed to GLAD" );
-	}
-
-	if ( !m_pWindow->GetGLContext() )
+	if ( m_Options.bHeadless )
 	{
-		std::string error = SDL_GetError();
-		throw std::runtime_error( fmt::format( "Failed to create OpenGL context: {}", error ) );
+		if ( !NullGLContext::Load() )
+		{
+			throw std::runtime_error( "Failed to load the null OpenGL context." );
+		}
 	}
-
-	if ( ( SDL_GL_MakeCurrent( m_pWindow->GetWindow().get(), m_pWindow->GetGLContext() ) ) != 0 )
+	else
 	{
-		std::string error = SDL_GetError();
-		throw std::runtime_error( fmt::format( "Failed to make OpenGL context current: {}", error ) );
+		CreateWindowAndContext();
 	}
 
-	SDL_GL_SetSwapInterval( 1 );
-
 	auto& mainRegistry = MAIN_REGISTRY();
 	if ( !mainRegistry.Initialize() )
 	{
@@ -228,6 +334,67 @@ void RuntimeApp::Initialize()
 	{
 		LoadPhysics();
 	}
+
+	// Recording and replaying both run at a fixed delta time so that the frames line up.
+	if ( !m_Options.sReplayFile.empty() )
+	{
+		if ( !m_pInputRecorder->StartReplay( m_Options.sReplayFile ) )
+		{
+			throw std::runtime_error( "Failed to load the input replay." );
+		}
+
+		coreGlobals.SetFixedDeltaTime( m_pInputRecorder->GetFixedDeltaTime() );
+		INPUT_MANAGER().GetMouse().OverrideScreenPosition( 0, 0 );
+	}
+	else if ( !m_Options.sRecordFile.empty() &&
+			  m_pInputRecorder->StartRecording( m_Options.sRecordFile, Scion::Core::TARGET_FRAME_TIME ) )
+	{
+		coreGlobals.SetFixedDeltaTime( Scion::Core::TARGET_FRAME_TIME );
+
+		// Store where the mouse starts, since it is only recorded again when it moves.
+		auto [ mouseX, mouseY ] = INPUT_MANAGER().GetMouse().GetMouseScreenPosition();
+		m_pInputRecorder->Record( Scion::Core::EInputRecordType::MouseMotion,
+								  mouseX,
+								  static_cast<std::int16_t>( mouseY ) );
+	}
+}
+
+void RuntimeApp::CreateWindowAndContext()
+{
+	// Create the Window
+	m_pWindow = std::make_unique<Scion::Windowing::Window>( m_pGameConfig->sGameName.c_str(),
+														   m_pGameConfig->windowWidth,
+														   m_pGameConfig->windowHeight,
+														   SDL_WINDOWPOS_CENTERED,
+														   SDL_WINDOWPOS_CENTERED,
+														   true,
+														   m_pGameConfig->windowFlags | SDL_WINDOW_OPENGL |
+															   SDL_WINDOW_ALLOW_HIGHDPI );
+
+	// Create the openGL context
+	m_pWindow->SetGLContext( SDL_GL_CreateContext( m_pWindow->GetWindow().get() ) );
+
+	// Initialize Glad
+	if ( gladLoadGLLoader( SDL_GL_GetProcAddress ) == 0 )
+	{
+		throw std::runtime_error( "Failed to GLAD" );
+	}
+
+	if ( !m_pWindow->GetGLContext() )
+	{
+		std::string error = SDL_GetError();
+		throw std::runtime_error( fmt::format( "Failed to create OpenGL context: {}", error ) );
+	}
+
+	if ( ( SDL_GL_MakeCurrent( m_pWindow->GetWindow().get(), m_pWindow->GetGLContext() ) ) != 0 )
+	{
+		std::string error = SDL_GetError();
+		throw std::runtime_error( fmt::format( "Failed to make OpenGL context current: {}", error ) );
+	}
+
+	SDL_GL_SetSwapInterval( 1 );
+
+	GPUProfiler::GetInstance().Initialize();
 }
 
 bool RuntimeApp::LoadShaders()
@@ -263,6 +430,20 @@ bool RuntimeApp::LoadShaders()
 		return false;
 	}
 
+	if ( !assetManager.AddShaderFromMemory(
+			 "sdf_font", Scion::Core::Shaders::sdfFontShaderVert, Scion::Core::Shaders::sdfFontShaderFrag ) )
+	{
+		SCION_ERROR( "Failed to add the sdf font shader to the asset manager" );
+		return false;
+	}
+
+	if ( !assetManager.AddShaderFromMemory(
+			 "particle", Scion::Core::Shaders::particleShaderVert, Scion::Core::Shaders::particleShaderFrag ) )
+	{
+		SCION_ERROR( "Failed to add the particle shader to the asset manager" );
+		return false;
+	}
+
 	return true;
 }
 
@@ -372,6 +553,13 @@ bool RuntimeApp::LoadRegistryContext()
 
 	mainRegistry.AddToContext<std::shared_ptr<ScriptingSystem>>( std::make_shared<ScriptingSystem>() );
 
+	// Used for work that can be split off of the main thread, such as batched physics queries.
+	mainRegistry.AddToContext<SharedThreadPool>( std::make_shared<Scion::Utilities::ThreadPool>(
+		std::max( 2U, std::thread::hardware_concurrency() ) - 1 ) );
+
+	mainRegistry.AddToContext<std::shared_ptr<Scion::Core::SceneStreamer>>(
+		std::make_shared<Scion::Core::SceneStreamer>() );
+
 	return false;
 }
 
@@ -518,13 +706,22 @@ bool RuntimeApp::LoadZip()
 				{
 					pS2DAsset->optPixelArt = asset[ "bPixelArt" ].get_or( false );
 				}
+				else if ( pS2DAsset->eType == Scion::Utilities::AssetType::MUSIC )
+				{
+					sol::optional<std::uint64_t> optOffset = asset[ "packOffset" ];
+					if ( optOffset )
+						pS2DAsset->optPackOffset = *optOffset;
+				}
 
-				// Get the asset data
-				sol::table dataTable = asset[ "data" ];
-				for ( const auto& [ _, data ] : dataTable )
+				// Get the asset data. Music in the music pack has no data table, it is streamed from the pack.
+				sol::optional<sol::table> optDataTable = asset[ "data" ];
+				if ( optDataTable )
 				{
-					auto value = data.as<unsigned char>();
-					pS2DAsset->assetData.push_back( value );
+					for ( const auto& [ _, data ] : *optDataTable )
+					{
+						auto value = data.as<unsigned char>();
+						pS2DAsset->assetData.push_back( value );
+					}
 				}
 
 				m_mapS2DAssets[ pS2DAsset->eType ].push_back( std::move( pS2DAsset ) );
@@ -550,8 +747,22 @@ bool RuntimeApp::LoadZip()
 			break;
 		}
 		case AssetType::MUSIC: {
+			const std::string musicPackPath{ fmt::format( "{}{}{}", "assets", PATH_SEPARATOR, MUSIC_PACK_FILENAME ) };
+
 			for ( const auto& pMusicAsset : assets )
 			{
+				if ( pMusicAsset->optPackOffset )
+				{
+					if ( !assetManager.AddStreamedMusic(
+							 pMusicAsset->sName, musicPackPath, *pMusicAsset->optPackOffset, pMusicAsset->assetSize ) )
+					{
+						SCION_ERROR( "Failed to add music [{}] from the music pack.", pMusicAsset->sName );
+					}
+
+					continue;
+				}
+
+				// Packages made before the music pack keep the music in the zipped assets.
 				if ( !assetManager.AddMusicFromMemory(
 						 pMusicAsset->sName, pMusicAsset->assetData.data(), pMusicAsset->assetSize ) )
 				{
@@ -592,39 +803,80 @@ bool RuntimeApp::LoadZip()
 
 void RuntimeApp::ProcessEvents()
 {
+	using Scion::Core::EInputRecordType;
+
 	auto& inputManager = INPUT_MANAGER();
 	auto& keyboard = inputManager.GetKeyboard();
 	auto& mouse = inputManager.GetMouse();
+	auto& recorder = *m_pInputRecorder;
+	const bool bReplaying = recorder.IsReplaying();
 
 	// Process Events
 	while ( SDL_PollEvent( &m_Event ) )
 	{
+		// While replaying, the devices are ignored and only the recorded input is used.
+		if ( bReplaying && m_Event.type != SDL_QUIT && m_Event.type != SDL_WINDOWEVENT )
+			continue;
+
 		switch ( m_Event.type )
 		{
 		case SDL_QUIT: m_bRunning = false; break;
 		case SDL_KEYDOWN:
+			recorder.Record( EInputRecordType::KeyPressed, m_Event.key.keysym.sym );
 			keyboard.OnKeyPressed( m_Event.key.keysym.sym );
 			EVENT_DISPATCHER().EmitEvent( Scion::Core::Events::KeyEvent{
 				.key = m_Event.key.keysym.sym, .eType = Scion::Core::Events::EKeyEventType::Pressed } );
 			break;
 		case SDL_KEYUP:
+			recorder.Record( EInputRecordType::KeyReleased, m_Event.key.keysym.sym );
 			keyboard.OnKeyReleased( m_Event.key.keysym.sym );
 			EVENT_DISPATCHER().EmitEvent( Scion::Core::Events::KeyEvent{
 				.key = m_Event.key.keysym.sym, .eType = Scion::Core::Events::EKeyEventType::Released } );
 			break;
-		case SDL_MOUSEBUTTONDOWN: mouse.OnBtnPressed( m_Event.button.button ); break;
-		case SDL_MOUSEBUTTONUP: mouse.OnBtnReleased( m_Event.button.button ); break;
+		case SDL_MOUSEBUTTONDOWN:
+			recorder.Record( EInputRecordType::MouseBtnPressed, m_Event.button.button );
+			mouse.OnBtnPressed( m_Event.button.button );
+			break;
+		case SDL_MOUSEBUTTONUP:
+			recorder.Record( EInputRecordType::MouseBtnReleased, m_Event.button.button );
+			mouse.OnBtnReleased( m_Event.button.button );
+			break;
 		case SDL_MOUSEWHEEL:
+			recorder.Record(
+				EInputRecordType::MouseWheel, m_Event.wheel.x, static_cast<std::int16_t>( m_Event.wheel.y ) );
 			mouse.SetMouseWheelX( m_Event.wheel.x );
 			mouse.SetMouseWheelY( m_Event.wheel.y );
 			break;
-		case SDL_MOUSEMOTION: mouse.SetMouseMoving( true ); break;
-		case SDL_CONTROLLERBUTTONDOWN: inputManager.GamepadBtnPressed( m_Event ); break;
-		case SDL_CONTROLLERBUTTONUP: inputManager.GamepadBtnReleased( m_Event ); break;
+		case SDL_MOUSEMOTION:
+			recorder.Record(
+				EInputRecordType::MouseMotion, m_Event.motion.x, static_cast<std::int16_t>( m_Event.motion.y ) );
+			mouse.SetMouseMoving( true );
+			break;
+		case SDL_CONTROLLERBUTTONDOWN:
+			if ( recorder.IsRecording() )
+			{
+				recorder.Record( EInputRecordType::GamepadBtnPressed,
+								 m_Event.cbutton.button,
+								 0,
+								 static_cast<std::uint8_t>( inputManager.GetGamepadIndex( m_Event.cbutton.which ) ) );
+			}
+			inputManager.GamepadBtnPressed( m_Event );
+			break;
+		case SDL_CONTROLLERBUTTONUP:
+			if ( recorder.IsRecording() )
+			{
+				recorder.Record( EInputRecordType::GamepadBtnReleased,
+								 m_Event.cbutton.button,
+								 0,
+								 static_cast<std::uint8_t>( inputManager.GetGamepadIndex( m_Event.cbutton.which ) ) );
+			}
+			inputManager.GamepadBtnReleased( m_Event );
+			break;
 		case SDL_CONTROLLERDEVICEADDED: {
 			int index = inputManager.AddGamepad( m_Event.jdevice.which );
 			if ( index > 0 )
 			{
+				recorder.Record( EInputRecordType::GamepadConnected, 0, 0, static_cast<std::uint8_t>( index ) );
 				EVENT_DISPATCHER().EmitEvent( Scion::Core::Events::GamepadConnectEvent{
 					.eConnectType = Scion::Core::Events::EGamepadConnectType::Connected, .index = index } );
 			}
@@ -636,18 +888,40 @@ void RuntimeApp::ProcessEvents()
 
 			if ( index > 0 )
 			{
+				recorder.Record( EInputRecordType::GamepadDisconnected, 0, 0, static_cast<std::uint8_t>( index ) );
 				EVENT_DISPATCHER().EmitEvent( Scion::Core::Events::GamepadConnectEvent{
 					.eConnectType = Scion::Core::Events::EGamepadConnectType::Disconnected, .index = index } );
 			}
 
 			break;
 		}
-		case SDL_JOYAXISMOTION: inputManager.GamepadAxisValues( m_Event ); break;
-		case SDL_JOYHATMOTION: inputManager.GamepadHatValues( m_Event ); break;
+		case SDL_JOYAXISMOTION:
+			if ( recorder.IsRecording() )
+			{
+				recorder.Record( EInputRecordType::GamepadAxis,
+								 m_Event.jaxis.axis,
+								 m_Event.jaxis.value,
+								 static_cast<std::uint8_t>( inputManager.GetGamepadIndex( m_Event.jaxis.which ) ) );
+			}
+			inputManager.GamepadAxisValues( m_Event );
+			break;
+		case SDL_JOYHATMOTION:
+			if ( recorder.IsRecording() )
+			{
+				recorder.Record( EInputRecordType::GamepadHat,
+								 m_Event.jhat.value,
+								 0,
+								 static_cast<std::uint8_t>( inputManager.GetGamepadIndex( m_Event.jhat.which ) ) );
+			}
+			inputManager.GamepadHatValues( m_Event );
+			break;
 		case SDL_WINDOWEVENT: {
 			switch ( m_Event.window.event )
 			{
-			case SDL_WINDOWEVENT_SIZE_CHANGED: m_pWindow->SetSize( m_Event.window.data1, m_Event.window.data2 ); break;
+			case SDL_WINDOWEVENT_SIZE_CHANGED:
+				if ( m_pWindow )
+					m_pWindow->SetSize( m_Event.window.data1, m_Event.window.data2 );
+				break;
 			default: break;
 			}
 			break;
@@ -655,23 +929,110 @@ void RuntimeApp::ProcessEvents()
 		default: break;
 		}
 	}
+
+	if ( bReplaying )
+	{
+		for ( const auto& record : recorder.GetFrameRecords() )
+			ApplyInputRecord( record );
+	}
+}
+
+void RuntimeApp::ApplyInputRecord( const Scion::Core::InputRecord& record )
+{
+	using Scion::Core::EInputRecordType;
+	using namespace Scion::Core::Events;
+
+	auto& inputManager = INPUT_MANAGER();
+	auto& keyboard = inputManager.GetKeyboard();
+	auto& mouse = inputManager.GetMouse();
+
+	// The physical devices are not part of the replay. The recorded gamepads are replaced by virtual ones that are
+	// only driven by the records, they are also added if the records reference a gamepad that was never connected.
+	auto getGamepad = [ & ]( int index ) -> std::shared_ptr<Scion::Windowing::Inputs::Gamepad> {
+		if ( !inputManager.GamepadConnected( index ) && !inputManager.AddVirtualGamepad( index ) )
+			return nullptr;
+
+		return inputManager.GetController( index );
+	};
+
+	switch ( record.eType )
+	{
+	case EInputRecordType::KeyPressed:
+		keyboard.OnKeyPressed( record.value );
+		EVENT_DISPATCHER().EmitEvent( KeyEvent{ .key = record.value, .eType = EKeyEventType::Pressed } );
+		break;
+	case EInputRecordType::KeyReleased:
+		keyboard.OnKeyReleased( record.value );
+		EVENT_DISPATCHER().EmitEvent( KeyEvent{ .key = record.value, .eType = EKeyEventType::Released } );
+		break;
+	case EInputRecordType::MouseBtnPressed: mouse.OnBtnPressed( record.value ); break;
+	case EInputRecordType::MouseBtnReleased: mouse.OnBtnReleased( record.value ); break;
+	case EInputRecordType::MouseWheel:
+		mouse.SetMouseWheelX( record.value );
+		mouse.SetMouseWheelY( record.value2 );
+		break;
+	case EInputRecordType::MouseMotion:
+		mouse.OverrideScreenPosition( record.value, record.value2 );
+		mouse.SetMouseMoving( true );
+		break;
+	case EInputRecordType::GamepadBtnPressed:
+		if ( auto pGamepad = getGamepad( record.device ) )
+			pGamepad->OnBtnPressed( record.value );
+		break;
+	case EInputRecordType::GamepadBtnReleased:
+		if ( auto pGamepad = getGamepad( record.device ) )
+			pGamepad->OnBtnReleased( record.value );
+		break;
+	case EInputRecordType::GamepadAxis:
+		if ( auto pGamepad = getGamepad( record.device ) )
+			pGamepad->SetAxisPositionValue( static_cast<Uint8>( record.value ), record.value2 );
+		break;
+	case EInputRecordType::GamepadHat:
+		if ( auto pGamepad = getGamepad( record.device ) )
+			pGamepad->SetJoystickHatValue( static_cast<Uint8>( record.value ) );
+		break;
+	case EInputRecordType::GamepadConnected:
+		if ( inputManager.AddVirtualGamepad( record.device ) )
+		{
+			EVENT_DISPATCHER().EmitEvent(
+				GamepadConnectEvent{ .eConnectType = EGamepadConnectType::Connected, .index = record.device } );
+		}
+		break;
+	case EInputRecordType::GamepadDisconnected:
+		if ( inputManager.RemoveGamepadAt( record.device ) )
+		{
+			EVENT_DISPATCHER().EmitEvent(
+				GamepadConnectEvent{ .eConnectType = EGamepadConnectType::Disconnected, .index = record.device } );
+		}
+		break;
+	default: break;
+	}
 }
 
 void RuntimeApp::Update()
 {
+	SCION_PROFILE_SCOPE( "RuntimeApp::Update" );
+
 	auto& coreGlobals = CORE_GLOBALS();
 	auto& mainRegistry = MAIN_REGISTRY();
 	auto* registry = mainRegistry.GetRegistry();
 
-	double dt = coreGlobals.GetDeltaTime();
+	double dt = coreGlobals.GetFrameTime();
 	coreGlobals.UpdateDeltaTime();
 
-	// Clamp delta time to the target frame rate
-	if ( dt < Scion::Core::TARGET_FRAME_TIME )
+	// Clamp delta time to the target frame rate. Headless runs are not capped so they can be used for benchmarking.
+	if ( !m_Options.bHeadless && dt < Scion::Core::TARGET_FRAME_TIME )
 	{
 		std::this_thread::sleep_for( std::chrono::duration<double>( Scion::Core::TARGET_FRAME_TIME - dt ) );
 	}
 
+	// Swap in a streamed scene before the scripts run, so they never see a partially loaded scene.
+	auto& pSceneStreamer = mainRegistry.GetContext<std::shared_ptr<Scion::Core::SceneStreamer>>();
+	pSceneStreamer->Update( *registry );
+
+	// Sounds triggered several times this frame are only played once.
+	mainRegistry.GetSoundPlayer().Update();
+
 	auto& scriptSystem = mainRegistry.GetContext<std::shared_ptr<ScriptingSystem>>();
 	scriptSystem->Update( *registry );
 
@@ -716,7 +1077,8 @@ void RuntimeApp::Update()
 	}
 
 	auto& camera = mainRegistry.GetContext<std::shared_ptr<Camera2D>>();
-	mainRegistry.GetAnimationSystem().Update( *registry, *camera );
+	mainRegistry.GetAnimationSystem().Update( *registry, coreGlobals.GetDeltaTime() );
+	mainRegistry.GetParticleSystem().Update( *registry, coreGlobals.GetDeltaTime() );
 
 #ifdef _DEBUG
 	if ( INPUT_MANAGER().GetKeyboard().IsKeyJustPressed( SCION_KEY_F2 ) )
@@ -728,25 +1090,35 @@ void RuntimeApp::Update()
 	INPUT_MANAGER().UpdateInputs();
 	camera->Update();
 
+	mainRegistry.GetAudioSystem().Update( *registry, *camera );
+
 	registry->ClearPendingEntities();
 }
 
 void RuntimeApp::Render()
 {
+	SCION_PROFILE_SCOPE( "RuntimeApp::Render" );
+	SCION_GPU_ZONE( "RuntimeApp::Render" );
+
 	auto& coreGlobals = CORE_GLOBALS();
 	auto& mainRegistry = MAIN_REGISTRY();
 	auto& renderer = mainRegistry.GetRenderer();
 	auto* registry = mainRegistry.GetRegistry();
 
-	int w, h;
-	SDL_GetWindowSize( m_pWindow->GetWindow().get(), &w, &h );
+	int w{ coreGlobals.WindowWidth() }, h{ coreGlobals.WindowHeight() };
+	if ( m_pWindow )
+	{
+		SDL_GetWindowSize( m_pWindow->GetWindow().get(), &w, &h );
+	}
 
 	renderer.SetViewport( 0, 0, w, h );
 	renderer.SetClearColor( 0.0f, 0.0f, 0.0f, 1.f );
 	renderer.ClearBuffers( true, true, false );
 
 	auto& camera = mainRegistry.GetContext<std::shared_ptr<Camera2D>>();
+	mainRegistry.GetVisibilitySystem().Update( *mainRegistry.GetRegistry(), *camera );
 	mainRegistry.GetRenderSystem().Update( *mainRegistry.GetRegistry(), *camera );
+	mainRegistry.GetParticleSystem().Render( *mainRegistry.GetRegistry(), *camera );
 	mainRegistry.GetRenderUISystem().Update( *mainRegistry.GetRegistry() );
 
 	if ( coreGlobals.RenderCollidersEnabled() )
@@ -757,11 +1129,143 @@ void RuntimeApp::Render()
 	auto& scriptSystem = mainRegistry.GetContext<std::shared_ptr<ScriptingSystem>>();
 	scriptSystem->Render( *registry );
 
-	SDL_GL_SwapWindow( m_pWindow->GetWindow().get() );
+	if ( m_pWindow )
+	{
+		SDL_GL_SwapWindow( m_pWindow->GetWindow().get() );
+	}
+}
+
+void RuntimeApp::BenchmarkLogger()
+{
+	constexpr std::uint32_t LOGS_PER_THREAD = 10000;
+	m_LogBenchmark = Scion::Logger::RunLogBenchmark( m_Options.logBenchmarkThreads, LOGS_PER_THREAD );
+
+	SCION_LOG( "Log Benchmark - Threads: {}, Logs: {}, Push: {:.3f}ms ({:.0f} logs/s), Written: {:.3f}ms, Dropped: {}",
+			   m_LogBenchmark.numThreads,
+			   m_LogBenchmark.numLogs,
+			   m_LogBenchmark.pushMs,
+			   m_LogBenchmark.numLogs / ( m_LogBenchmark.pushMs / 1000.0 ),
+			   m_LogBenchmark.totalMs,
+			   m_LogBenchmark.numDropped );
+}
+
+void RuntimeApp::BenchmarkProfiler()
+{
+	m_ProfileBenchmark = Scion::Utilities::RunProfileBenchmark( m_Options.profileBenchmarkZones );
+
+	SCION_LOG( "Profile Benchmark - Zones: {}, Scope: {:.1f}ns, Named Zone: {:.1f}ns, String Zone: {:.1f}ns",
+			   m_ProfileBenchmark.numZones,
+			   m_ProfileBenchmark.scopeNs,
+			   m_ProfileBenchmark.namedZoneNs,
+			   m_ProfileBenchmark.stringZoneNs );
+}
+
+void RuntimeApp::ReportFrameStats()
+{
+	if ( m_FrameTimes.empty() || ( !m_Options.bHeadless && m_Options.sStatsFile.empty() ) )
+		return;
+
+	auto sortedTimes = m_FrameTimes;
+	std::sort( sortedTimes.begin(), sortedTimes.end() );
+
+	const double avgMs = std::accumulate( sortedTimes.begin(), sortedTimes.end(), 0.0 ) / sortedTimes.size();
+	const double p95Ms = sortedTimes[ std::min( sortedTimes.size() - 1, sortedTimes.size() * 95 / 100 ) ];
+
+	SCION_LOG( "Frames: {}, Min: {:.3f}ms, Avg: {:.3f}ms, Max: {:.3f}ms, P95: {:.3f}ms",
+			   sortedTimes.size(),
+			   sortedTimes.front(),
+			   avgMs,
+			   sortedTimes.back(),
+			   p95Ms );
+
+	const auto& glStats = NullGLContext::GetStats();
+	if ( NullGLContext::IsLoaded() )
+	{
+		SCION_LOG( "Draw Calls: {}, Vertices: {}, Buffer Uploads: {} ({} bytes), Texture Uploads: {} ({} bytes)",
+				   glStats.drawCalls,
+				   glStats.verticesDrawn,
+				   glStats.bufferUploads,
+				   glStats.bufferBytesUploaded,
+				   glStats.textureUploads,
+				   glStats.textureBytesUploaded );
+	}
+
+	if ( m_Options.sStatsFile.empty() )
+		return;
+
+	try
+	{
+		Scion::Filesystem::JSONSerializer serializer{ m_Options.sStatsFile, 4 };
+		serializer.StartDocument();
+		serializer.StartNewObject( "frames" )
+			.AddKeyValuePair( "count", sortedTimes.size() )
+			.AddKeyValuePair( "minMs", sortedTimes.front() )
+			.AddKeyValuePair( "avgMs", avgMs )
+			.AddKeyValuePair( "maxMs", sortedTimes.back() )
+			.AddKeyValuePair( "p95Ms", p95Ms )
+			.EndObject();
+
+		if ( NullGLContext::IsLoaded() )
+		{
+			serializer.StartNewObject( "gl" )
+				.AddKeyValuePair( "drawCalls", glStats.drawCalls )
+				.AddKeyValuePair( "verticesDrawn", glStats.verticesDrawn )
+				.AddKeyValuePair( "bufferUploads", glStats.bufferUploads )
+				.AddKeyValuePair( "bufferBytesUploaded", glStats.bufferBytesUploaded )
+				.AddKeyValuePair( "largestBufferSize", glStats.largestBufferSize )
+				.AddKeyValuePair( "textureUploads", glStats.textureUploads )
+				.AddKeyValuePair( "textureBytesUploaded", glStats.textureBytesUploaded )
+				.EndObject();
+		}
+
+		const auto& voiceStats = MAIN_REGISTRY().GetSoundPlayer().GetStats();
+		auto& softwareMixer = MAIN_REGISTRY().GetSoftwareMixer();
+		const auto& mixerStats = softwareMixer.GetStats();
+		serializer.StartNewObject( "audio" )
+			.AddKeyValuePair( "channels", voiceStats.numChannels )
+			.AddKeyValuePair( "played", voiceStats.numPlayed )
+			.AddKeyValuePair( "stolen", voiceStats.numStolen )
+			.AddKeyValuePair( "rejected", voiceStats.numRejected )
+			.AddKeyValuePair( "deduplicated", voiceStats.numDeduplicated )
+			.AddKeyValuePair( "mixerAttached", softwareMixer.IsAttached() )
+			.AddKeyValuePair( "mixerVoices", mixerStats.activeVoices )
+			.AddKeyValuePair( "mixerRejected", mixerStats.numRejected )
+			.AddKeyValuePair( "mixerDroppedCommands", mixerStats.numDroppedCommands )
+			.EndObject();
+
+		if ( m_LogBenchmark.numThreads > 0 )
+		{
+			serializer.StartNewObject( "logger" )
+				.AddKeyValuePair( "threads", m_LogBenchmark.numThreads )
+				.AddKeyValuePair( "logs", m_LogBenchmark.numLogs )
+				.AddKeyValuePair( "pushMs", m_LogBenchmark.pushMs )
+				.AddKeyValuePair( "totalMs", m_LogBenchmark.totalMs )
+				.AddKeyValuePair( "dropped", m_LogBenchmark.numDropped )
+				.EndObject();
+		}
+
+		if ( m_ProfileBenchmark.numZones > 0 )
+		{
+			serializer.StartNewObject( "profiler" )
+				.AddKeyValuePair( "zones", m_ProfileBenchmark.numZones )
+				.AddKeyValuePair( "scopeNs", m_ProfileBenchmark.scopeNs )
+				.AddKeyValuePair( "namedZoneNs", m_ProfileBenchmark.namedZoneNs )
+				.AddKeyValuePair( "stringZoneNs", m_ProfileBenchmark.stringZoneNs )
+				.EndObject();
+		}
+
+		serializer.EndDocument();
+	}
+	catch ( const std::exception& ex )
+	{
+		SCION_ERROR( "Failed to write frame stats to [{}] - {}", m_Options.sStatsFile, ex.what() );
+	}
 }
 
 void RuntimeApp::CleanUp()
 {
+	m_pInputRecorder->Stop();
+	GPUProfiler::GetInstance().Shutdown();
 	SDL_Quit();
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 #include <SDL2/SDL.h>
+#include <Logger/LogBenchmark.h>
+#include <ScionUtilities/ProfileBenchmark.h>
 
 namespace sol
 {
@@ -14,7 +16,9 @@ class Window;
 namespace Scion::Core
 {
 struct GameConfig;
-}
+class InputRecorder;
+struct InputRecord;
+} // namespace Scion::Core
 
 namespace Scion::Utilities
 {
@@ -24,16 +28,50 @@ struct S2DAsset;
 
 namespace Scion::Engine
 {
+/*
+ * RuntimeOptions
+ * Options that are passed in on the command line.
+ */
+struct RuntimeOptions
+{
+	/* Run without a window or GPU. All rendering goes through the null OpenGL context. */
+	bool bHeadless{ false };
+	/* Stop after this many frames. Zero runs until the game quits. */
+	std::uint32_t frameCount{ 0 };
+	/* If set, the frame time stats are written to this json file when the app closes. */
+	std::string sStatsFile{};
+	/* If set, the input of the session is recorded to this file. */
+	std::string sRecordFile{};
+	/* If set, the input recorded in this file is replayed instead of using the devices. */
+	std::string sReplayFile{};
+	/* If set, the logs are written to this file as well as the console. */
+	std::string sLogFile{};
+	/* If set, the profiler zones are written to this file as a chrome trace when the app closes. */
+	std::string sTraceFile{};
+	/* If not zero, the logger throughput is measured from this many threads before the game starts. */
+	std::uint32_t logBenchmarkThreads{ 0 };
+	/* If not zero, the cost of a profiler zone is measured over this many zones before the game starts. */
+	std::uint32_t profileBenchmarkZones{ 0 };
+
+	/*
+	 * @brief Parses the command line arguments. Supported arguments are
+	 * --headless, --frames=<count>, --stats=<path>, --record=<path>, --replay=<path>,
+	 * --log=<path>, --trace=<path>, --log-benchmark=<threads> and --profile-benchmark=<zones>.
+	 */
+	static RuntimeOptions Parse( int argc, char** argv );
+};
+
 class RuntimeApp
 {
   public:
-	RuntimeApp();
+	RuntimeApp( const RuntimeOptions& options = RuntimeOptions{} );
 	~RuntimeApp();
 
 	void Run();
 
   private:
 	void Initialize();
+	void CreateWindowAndContext();
 
 	bool LoadShaders();
 	bool LoadConfig( sol::state& lua );
@@ -44,15 +82,25 @@ class RuntimeApp
 	bool LoadZip();
 
 	void ProcessEvents();
+	void ApplyInputRecord( const Scion::Core::InputRecord& record );
 	void Update();
 	void Render();
 
 	void CleanUp();
 
+	void BenchmarkLogger();
+	void BenchmarkProfiler();
+	void ReportFrameStats();
+
   private:
 	std::unique_ptr<Scion::Windowing::Window> m_pWindow;
 	std::unique_ptr<Scion::Core::GameConfig> m_pGameConfig;
+	std::unique_ptr<Scion::Core::InputRecorder> m_pInputRecorder;
 	std::unordered_map<Scion::Utilities::AssetType, std::vector<std::unique_ptr<Scion::Utilities::S2DAsset>>> m_mapS2DAssets;
+	std::vector<double> m_FrameTimes;
+	RuntimeOptions m_Options;
+	Scion::Logger::LogBenchmarkResult m_LogBenchmark;
+	Scion::Utilities::ProfileBenchmarkResult m_ProfileBenchmark;
 	SDL_Event m_Event;
 	bool m_bRunning;
 	/*
@@ -6,7 +6,7 @@
 #include <Windows.h>
 #endif
 
-int main()
+int main( int argc, char** argv )
 {
 
 #ifdef _WIN32
@@ -16,7 +16,7 @@ int main()
 	ShowWindow( GetConsoleWindow(), SW_SHOW );
 #endif // NDEBUG
 #endif // _WIN32
-	Scion::Engine::RuntimeApp app{};
+	Scion::Engine::RuntimeApp app{ Scion::Engine::RuntimeOptions::Parse( argc, argv ) };
 	app.Run();
 
 	return 0;
@@ -5,7 +5,15 @@
 #ifdef _WIN32
 #include <Windows.h>
 #else
-// Add linux specific headers.
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
 #endif // _WIN32
 
 namespace fs = std::filesystem;
@@ -26,13 +34,22 @@ struct DirectoryWatcher::Impl
 	HANDLE shutdownHandle{ nullptr };
 	OVERLAPPED overlapped{};
 #else
-	// TODO: add necessary linux variables
+	int inotifyFd{ -1 };
+	int epollFd{ -1 };
+	/* Written to by the destructor to wake the watcher thread. */
+	int shutdownFd{ -1 };
+	/* The directory of each inotify watch, inotify only watches a single directory. */
+	std::unordered_map<int, fs::path> mapWatches;
 #endif
 
 	Impl( const std::filesystem::path& path, Callback cb )
 		: rootPath{ path }
 		, callback{ std::move( cb ) }
 	{
+#ifndef _WIN32
+		// Created before the thread starts, so the destructor can always signal it.
+		shutdownFd = eventfd( 0, EFD_CLOEXEC | EFD_NONBLOCK );
+#endif
 		watcherThread = std::thread( [ this ] { Run(); } );
 	}
 
@@ -44,6 +61,18 @@ struct DirectoryWatcher::Impl
 	void RunWindows();
 #else
 	void RunLinux();
+	/* @brief Watches the directory and every directory below it. */
+	void AddWatches( const fs::path& path );
+	/*
+	 * @brief Stops watching the directory and every directory below it. Used when a directory is moved, since
+	 * its watches follow it and would otherwise report changes under the old path.
+	 */
+	void RemoveWatches( const fs::path& path );
+	/*
+	 * @brief Reads every queued inotify event and merges them into the changes, so a file that is written
+	 * several times in a row is only reported once.
+	 */
+	void ReadEvents( std::vector<std::pair<fs::path, bool>>& changes );
 #endif
 };
 
@@ -62,6 +91,12 @@ DirectoryWatcher::Impl::~Impl()
 #ifdef _WIN32
 		SetEvent( shutdownHandle );
 		CancelIoEx( directoryHandle, &overlapped );
+#else
+		const std::uint64_t value{ 1 };
+		if ( shutdownFd != -1 && write( shutdownFd, &value, sizeof( value ) ) != sizeof( value ) )
+		{
+			SCION_ERROR( "Failed to signal the directory watcher to stop: {}", std::strerror( errno ) );
+		}
 #endif
 		watcherThread.join();
 	}
@@ -79,7 +114,14 @@ DirectoryWatcher::Impl::~Impl()
 		shutdownHandle = nullptr;
 	}
 #else
-	// TODO: handle any Linux shutdown stuff
+	for ( int* pFd : { &inotifyFd, &epollFd, &shutdownFd } )
+	{
+		if ( *pFd != -1 )
+		{
+			close( *pFd );
+			*pFd = -1;
+		}
+	}
 #endif
 }
 
@@ -227,10 +269,223 @@ void DirectoryWatcher::Impl::RunWindows()
 	directoryHandle = nullptr;
 }
 #else
+/* How long the changes are collected after the first one, before they are reported. */
+constexpr int DIRECTORY_WATCHER_COALESCE_MS = 50;
+
 void DirectoryWatcher::Impl::RunLinux()
 {
+	if ( shutdownFd == -1 )
+	{
+		SCION_ERROR( "Failed to create the directory watcher shutdown event: {}", std::strerror( errno ) );
+		return;
+	}
+
+	inotifyFd = inotify_init1( IN_NONBLOCK | IN_CLOEXEC );
+	if ( inotifyFd == -1 )
+	{
+		SCION_ERROR( "Failed to initialize inotify: {}", std::strerror( errno ) );
+		return;
+	}
+
+	AddWatches( rootPath );
+	if ( mapWatches.empty() )
+		return;
+
+	epollFd = epoll_create1( EPOLL_CLOEXEC );
+	if ( epollFd == -1 )
+	{
+		SCION_ERROR( "Failed to create epoll instance: {}", std::strerror( errno ) );
+		return;
+	}
+
+	for ( int fd : { inotifyFd, shutdownFd } )
+	{
+		epoll_event event{ .events = EPOLLIN, .data = { .fd = fd } };
+		if ( epoll_ctl( epollFd, EPOLL_CTL_ADD, fd, &event ) == -1 )
+		{
+			SCION_ERROR( "Failed to add to epoll: {}", std::strerror( errno ) );
+			return;
+		}
+	}
+
+	// The changes waiting to be reported and when the first of them came in.
+	std::vector<std::pair<fs::path, bool>> changes;
+	auto firstChangeTime = std::chrono::steady_clock::now();
+
+	while ( !bStopFlag )
+	{
+		int timeout{ -1 };
+		if ( !changes.empty() )
+		{
+			auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() -
+																				  firstChangeTime );
+			timeout = std::max( 0, DIRECTORY_WATCHER_COALESCE_MS - static_cast<int>( elapsed.count() ) );
+		}
+
+		epoll_event events[ 2 ];
+		int numEvents = epoll_wait( epollFd, events, 2, timeout );
+		if ( numEvents == -1 )
+		{
+			if ( errno == EINTR )
+				continue;
+
+			SCION_ERROR( "epoll_wait failed: {}", std::strerror( errno ) );
+			break;
+		}
+
+		bool bShutdown{ false };
+		for ( int i = 0; i < numEvents; ++i )
+		{
+			if ( events[ i ].data.fd == shutdownFd )
+			{
+				bShutdown = true;
+			}
+			else if ( events[ i ].data.fd == inotifyFd )
+			{
+				if ( changes.empty() )
+					firstChangeTime = std::chrono::steady_clock::now();
+
+				ReadEvents( changes );
+			}
+		}
+
+		if ( bShutdown )
+			break;
+
+		// Report what was collected once the coalesce time is up, even if changes are still coming in.
+		if ( !changes.empty() && std::chrono::steady_clock::now() - firstChangeTime >=
+									 std::chrono::milliseconds( DIRECTORY_WATCHER_COALESCE_MS ) )
+		{
+			if ( callback )
+			{
+				for ( const auto& [ changedPath, bModified ] : changes )
+					callback( changedPath, bModified );
+			}
+
+			changes.clear();
+		}
+	}
+}
+
+void DirectoryWatcher::Impl::AddWatches( const fs::path& path )
+{
+	constexpr std::uint32_t watchMask =
+		IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_MOVE_SELF | IN_DELETE | IN_ONLYDIR;
+
+	auto addWatch = [ & ]( const fs::path& dir ) {
+		int wd = inotify_add_watch( inotifyFd, dir.c_str(), watchMask );
+		if ( wd == -1 )
+		{
+			SCION_ERROR( "Failed to watch directory [{}]: {}", dir.string(), std::strerror( errno ) );
+			return;
+		}
+
+		mapWatches[ wd ] = dir;
+	};
+
+	addWatch( path );
+
+	std::error_code ec;
+	for ( auto itr = fs::recursive_directory_iterator( path, fs::directory_options::skip_permission_denied, ec );
+		  !ec && itr != fs::recursive_directory_iterator{};
+		  itr.increment( ec ) )
+	{
+		if ( itr->is_directory( ec ) && !itr->is_symlink( ec ) )
+			addWatch( itr->path() );
+	}
 }
 
+void DirectoryWatcher::Impl::RemoveWatches( const fs::path& path )
+{
+	for ( auto itr = mapWatches.begin(); itr != mapWatches.end(); )
+	{
+		const auto [ itrPath, itrDir ] =
+			std::mismatch( path.begin(), path.end(), itr->second.begin(), itr->second.end() );
+
+		if ( itrPath != path.end() )
+		{
+			++itr;
+			continue;
+		}
+
+		inotify_rm_watch( inotifyFd, itr->first );
+		itr = mapWatches.erase( itr );
+	}
+}
+
+void DirectoryWatcher::Impl::ReadEvents( std::vector<std::pair<fs::path, bool>>& changes )
+{
+	alignas( inotify_event ) char buffer[ 8192 ];
+
+	while ( true )
+	{
+		ssize_t length = read( inotifyFd, buffer, sizeof( buffer ) );
+		if ( length <= 0 )
+		{
+			if ( length == -1 && errno != EAGAIN && errno != EINTR )
+			{
+				SCION_ERROR( "Failed to read inotify events: {}", std::strerror( errno ) );
+			}
+			break;
+		}
+
+		for ( char* pBuffer = buffer; pBuffer < buffer + length; )
+		{
+			const auto* pEvent = reinterpret_cast<const inotify_event*>( pBuffer );
+			pBuffer += sizeof( inotify_event ) + pEvent->len;
+
+			if ( pEvent->mask & IN_Q_OVERFLOW )
+			{
+				SCION_WARN( "Directory watcher of [{}] overflowed, some changes were missed.", rootPath.string() );
+				continue;
+			}
+
+			auto watchItr = mapWatches.find( pEvent->wd );
+			if ( watchItr == mapWatches.end() )
+				continue;
+
+			// The directory was removed, its watch is gone.
+			if ( pEvent->mask & IN_IGNORED )
+			{
+				mapWatches.erase( watchItr );
+				continue;
+			}
+
+			// Directories below the root are dropped with the IN_MOVED_FROM of their parent, only the root is left.
+			if ( pEvent->mask & IN_MOVE_SELF )
+			{
+				SCION_WARN( "Watched directory [{}] was moved, its changes are no longer reported.",
+							watchItr->second.string() );
+				RemoveWatches( fs::path{ watchItr->second } );
+				continue;
+			}
+
+			fs::path changedPath = pEvent->len > 0 ? watchItr->second / pEvent->name : watchItr->second;
+			const bool bDirectory = ( pEvent->mask & IN_ISDIR ) != 0;
+
+			// The watches are added again under the new path by IN_MOVED_TO, if it is still under the root.
+			if ( bDirectory && ( pEvent->mask & IN_MOVED_FROM ) )
+				RemoveWatches( changedPath );
+
+			// Files are reported once they are closed, so they are not read while they are still being written.
+			if ( ( pEvent->mask & IN_CREATE ) && !bDirectory )
+				continue;
+
+			if ( bDirectory && ( pEvent->mask & ( IN_CREATE | IN_MOVED_TO ) ) )
+				AddWatches( changedPath );
+
+			const bool bModified = ( pEvent->mask & ( IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO ) ) != 0;
+
+			auto changeItr =
+				std::ranges::find_if( changes, [ & ]( const auto& change ) { return change.first == changedPath; } );
+
+			if ( changeItr != changes.end() )
+				changeItr->second = bModified;
+			else
+				changes.emplace_back( std::move( changedPath ), bModified );
+		}
+	}
+}
 #endif
 
 } // namespace Scion::Filesystem
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstdint>
+
+namespace Scion::Logger
+{
+struct LogBenchmarkResult
+{
+	std::uint32_t numThreads{ 0 };
+	std::uint64_t numLogs{ 0 };
+	/* The time from the first log being pushed until every thread has pushed all of its logs. */
+	double pushMs{ 0.0 };
+	/* The time from the first log being pushed until the log thread has written every log. */
+	double totalMs{ 0.0 };
+	/* The number of logs dropped because the log queue was full. */
+	std::uint64_t numDropped{ 0 };
+};
+
+/*
+ * @brief Measures the logging throughput by logging from several threads at once.
+ * Every log is unique, so none of them are collapsed as repeats. The logger must be initialized.
+ * @param Takes the number of threads to log from and the number of logs each thread pushes.
+ * @return Returns the timings and the number of logs that were dropped.
+ */
+LogBenchmarkResult RunLogBenchmark( std::uint32_t numThreads, std::uint32_t numLogsPerThread );
+} // namespace Scion::Logger
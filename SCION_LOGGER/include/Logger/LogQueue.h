@@ -0,0 +1,56 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace Scion::Logger
+{
+/*
+ * LogQueue
+ * A bounded, lock free queue for many producers and a single consumer.
+ * Each slot has a sequence number that tells the producers and the consumer whose turn it is to use the slot,
+ * so pushing only takes one compare exchange on the head, and popping does not take any.
+ * The capacity must be a power of two.
+ */
+template <typename T, std::size_t Capacity>
+class LogQueue
+{
+	static_assert( Capacity >= 2 && ( Capacity & ( Capacity - 1 ) ) == 0, "Capacity must be a power of two!" );
+
+  public:
+	LogQueue();
+	~LogQueue() = default;
+
+	LogQueue( const LogQueue& ) = delete;
+	LogQueue& operator=( const LogQueue& ) = delete;
+
+	/*
+	 * @brief Moves the value into the queue. This can be called from any thread.
+	 * @return Returns false if the queue is full. The value is not moved from in that case.
+	 */
+	bool TryPush( T&& value );
+
+	/*
+	 * @brief Moves the oldest value out of the queue. This must only be called from the consumer thread.
+	 * @return Returns false if the queue is empty.
+	 */
+	bool TryPop( T& value );
+
+  private:
+	struct Slot
+	{
+		std::atomic<std::size_t> sequence{ 0 };
+		T value{};
+	};
+
+	/* Keeps the producer and consumer positions on separate cache lines. */
+	static constexpr std::size_t CACHE_LINE_SIZE = 64;
+	static constexpr std::size_t MASK = Capacity - 1;
+
+	std::unique_ptr<Slot[]> m_pSlots;
+	alignas( CACHE_LINE_SIZE ) std::atomic<std::size_t> m_Head;
+	alignas( CACHE_LINE_SIZE ) std::size_t m_Tail;
+};
+} // namespace Scion::Logger
+
+#include "LogQueue.inl"
@@ -0,0 +1,68 @@
+#pragma once
+#include "LogQueue.h"
+#include <cstdint>
+#include <utility>
+
+namespace Scion::Logger
+{
+template <typename T, std::size_t Capacity>
+LogQueue<T, Capacity>::LogQueue()
+	: m_pSlots{ std::make_unique<Slot[]>( Capacity ) }
+	, m_Head{ 0 }
+	, m_Tail{ 0 }
+{
+	for ( std::size_t i = 0; i < Capacity; ++i )
+		m_pSlots[ i ].sequence.store( i, std::memory_order_relaxed );
+}
+
+template <typename T, std::size_t Capacity>
+bool LogQueue<T, Capacity>::TryPush( T&& value )
+{
+	std::size_t position = m_Head.load( std::memory_order_relaxed );
+	Slot* pSlot{ nullptr };
+
+	for ( ;; )
+	{
+		pSlot = &m_pSlots[ position & MASK ];
+		const std::size_t sequence = pSlot->sequence.load( std::memory_order_acquire );
+		const auto diff = static_cast<std::intptr_t>( sequence ) - static_cast<std::intptr_t>( position );
+
+		// The slot is free for this position, try to claim it.
+		if ( diff == 0 )
+		{
+			if ( m_Head.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+				break;
+		}
+		// The consumer has not popped the value from the last lap yet, so the queue is full.
+		else if ( diff < 0 )
+		{
+			return false;
+		}
+		// Another producer claimed the slot first.
+		else
+		{
+			position = m_Head.load( std::memory_order_relaxed );
+		}
+	}
+
+	pSlot->value = std::move( value );
+	pSlot->sequence.store( position + 1, std::memory_order_release );
+	return true;
+}
+
+template <typename T, std::size_t Capacity>
+bool LogQueue<T, Capacity>::TryPop( T& value )
+{
+	Slot& slot = m_pSlots[ m_Tail & MASK ];
+	const std::size_t sequence = slot.sequence.load( std::memory_order_acquire );
+
+	// The producer that claimed this slot has not finished writing to it yet.
+	if ( static_cast<std::intptr_t>( sequence ) - static_cast<std::intptr_t>( m_Tail + 1 ) < 0 )
+		return false;
+
+	value = std::move( slot.value );
+	slot.sequence.store( m_Tail + Capacity, std::memory_order_release );
+	++m_Tail;
+	return true;
+}
+} // namespace Scion::Logger
@@ -1,10 +1,17 @@
 #pragma once
+#include "LogQueue.h"
 #include <string>
 #include <string_view>
 #include <source_location>
 #include <vector>
 #include <cassert>
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <thread>
+#include <unordered_map>
 
 /*
  * @brief Variadic Macro for logging Information. This macro takes in a string message, followed by the
@@ -34,8 +41,9 @@
 #define SCION_ASSERT( x ) assert( x )
 #define SCION_INIT_LOGS( console, retain ) Scion::Logger::Logger::GetInstance().Init( console, retain )
 
-#define SCION_GET_LOGS() Scion::Logger::Logger::GetInstance().GetLogs()
+#define SCION_GET_LOGS( firstLog, logs ) Scion::Logger::Logger::GetInstance().GetLogs( firstLog, logs )
 #define SCION_CLEAR_LOGS() Scion::Logger::Logger::GetInstance().ClearLogs()
+#define SCION_FLUSH_LOGS() Scion::Logger::Logger::GetInstance().Flush()
 
 namespace Scion::Logger
 {
@@ -52,18 +60,45 @@ struct LogEntry
 	std::string log{};
 };
 
+/* The number of logs that can wait for the log thread. Logs pushed while the queue is full are dropped. */
+constexpr std::size_t LOG_QUEUE_CAPACITY = 8192;
+/* The number of logs retained for the editor. Once full, the oldest logs are overwritten. */
+constexpr std::size_t MAX_RETAINED_LOGS = 4096;
+/* A message that repeats inside this window is only written once, followed by the number of repeats. */
+constexpr std::chrono::milliseconds LOG_REPEAT_WINDOW{ 1000 };
+/* The most distinct messages that are checked for repeats at one time. */
+constexpr std::size_t MAX_TRACKED_LOGS = 1024;
+/* How long the log thread sleeps when there is nothing to write. */
+constexpr std::chrono::milliseconds LOG_THREAD_INTERVAL{ 5 };
+
+/*
+ * Logger
+ * Logs are formatted on the calling thread and pushed into a lock free queue. A separate log thread
+ * adds the timestamp, writes them to the console and the log file and keeps the last MAX_RETAINED_LOGS of them.
+ */
 class Logger
 {
   public:
 	static Logger& GetInstance();
 
-	~Logger() = default;
+	~Logger();
 	// Make the logger non-copyable
 	Logger( const Logger& ) = delete;
 	Logger& operator=( const Logger& ) = delete;
 
 	void Init( bool consoleLog = true, bool retainLogs = true );
 
+	/*
+	 * @brief Writes the logs to the given file as well as the console. The file is truncated.
+	 * @param Takes the path to the file. An empty path closes the current log file.
+	 */
+	void SetLogFile( const std::string& sFilepath );
+
+	/*
+	 * @brief Blocks until the log thread has written every log that was pushed before the call.
+	 */
+	void Flush();
+
 	template <typename... Args>
 	void Log( const std::string_view message, Args&&... args );
 
@@ -80,28 +115,81 @@ class Logger
 	void LuaWarn( const std::string_view message );
 	void LuaError( const std::string_view message );
 
-	inline void ClearLogs() { m_LogEntries.clear(); }
-	inline const std::vector<LogEntry>& GetLogs() { return m_LogEntries; }
+	void ClearLogs();
 
-  private:
-	std::string CurrentDateTime();
-	void WriteConsoleLog( std::string_view sv, LogEntry::LogType eType );
+	/*
+	 * @brief Copies the retained logs, starting at firstLog, to the back of the logs vector.
+	 * Logs that have already been overwritten or cleared are skipped.
+	 * @return Returns the index of the next log. Pass it back in to only get the logs that are new.
+	 */
+	std::uint64_t GetLogs( std::uint64_t firstLog, std::vector<LogEntry>& logs );
+
+	inline std::uint64_t GetNumDroppedLogs() const { return m_NumDropped.load( std::memory_order_relaxed ); }
 
   private:
-	std::mutex m_Mutex;
-	std::vector<LogEntry> m_LogEntries;
-	bool m_bInitialized{ false };
-	bool m_bConsoleLog{ true };
-	bool m_bRetainLogs{ true };
+	enum class LogSource
+	{
+		SCION,
+		LUA
+	};
 
-	Logger() = default;
+	struct LogRecord
+	{
+		LogEntry::LogType type{ LogEntry::LogType::INFO };
+		LogSource source{ LogSource::SCION };
+		std::chrono::system_clock::time_point time{};
+		std::string message{};
+	};
 
-	struct LogTime
+	struct RepeatedLog
 	{
-		std::string day, dayNumber, month, year, time;
-		LogTime( const std::string& date );
+		LogRecord record{};
+		std::chrono::steady_clock::time_point windowStart{};
+		std::uint32_t numRepeats{ 0 };
 	};
 
+	Logger() = default;
+
+	void Push( LogEntry::LogType eType, LogSource eSource, std::string&& sMessage );
+
+	/* The log thread. Everything below is only called from this thread. */
+	void ProcessLogs();
+	bool CheckRepeated( const LogRecord& record, std::chrono::steady_clock::time_point now );
+	void WriteRepeats( bool bWriteAll, std::chrono::steady_clock::time_point now );
+	void WriteDropped();
+	void WriteLog( const LogRecord& record, std::uint32_t numRepeats );
+	const std::string& FormatTime( std::chrono::system_clock::time_point time );
+	void WriteConsoleLog( std::string_view sv, LogEntry::LogType eType );
+
+  private:
+	LogQueue<LogRecord, LOG_QUEUE_CAPACITY> m_Queue;
+	std::thread m_LogThread;
+
+	std::mutex m_WakeMutex;
+	std::condition_variable m_WakeCondition;
+	std::condition_variable m_FlushCondition;
+	std::atomic_bool m_bRunning{ false };
+	std::atomic<std::uint64_t> m_NumPushed{ 0 };
+	std::atomic<std::uint64_t> m_NumProcessed{ 0 };
+	std::atomic<std::uint64_t> m_NumDropped{ 0 };
+
+	/* The retained logs are a ring, m_NextLog and m_FirstRetained only ever increase. */
+	std::mutex m_RetainMutex;
+	std::vector<LogEntry> m_RetainedLogs;
+	std::uint64_t m_FirstRetained{ 0 };
+	std::uint64_t m_NextLog{ 0 };
+
+	std::mutex m_FileMutex;
+	std::ofstream m_LogFile;
+
+	std::unordered_map<std::size_t, RepeatedLog> m_mapRepeatedLogs;
+	std::uint64_t m_NumReportedDrops{ 0 };
+	std::time_t m_LastLogTime{ 0 };
+	std::string m_sLastLogTime{};
+
+	bool m_bInitialized{ false };
+	bool m_bConsoleLog{ true };
+	bool m_bRetainLogs{ true };
 };
 } // namespace Scion::Logger
 
@@ -0,0 +1,54 @@
+#include "Logger/LogBenchmark.h"
+#include "Logger/Logger.h"
+
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <thread>
+#include <vector>
+
+namespace Scion::Logger
+{
+LogBenchmarkResult RunLogBenchmark( std::uint32_t numThreads, std::uint32_t numLogsPerThread )
+{
+	// The run is part of every log, so logs from an earlier run are not collapsed as repeats.
+	static std::atomic_uint32_t s_RunIndex{ 0 };
+	const std::uint32_t runIndex = s_RunIndex++;
+
+	auto& logger = Logger::GetInstance();
+
+	// Start from an empty queue, so earlier logs are not part of the timings.
+	logger.Flush();
+	const std::uint64_t numDroppedBefore = logger.GetNumDroppedLogs();
+
+	std::latch startLatch{ static_cast<std::ptrdiff_t>( numThreads ) + 1 };
+	std::vector<std::thread> threads;
+	threads.reserve( numThreads );
+
+	for ( std::uint32_t i = 0; i < numThreads; ++i )
+	{
+		threads.emplace_back( [ &startLatch, runIndex, i, numLogsPerThread ] {
+			startLatch.arrive_and_wait();
+			for ( std::uint32_t j = 0; j < numLogsPerThread; ++j )
+				SCION_LOG( "Log benchmark {} - thread: {}, log: {}", runIndex, i, j );
+		} );
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	startLatch.arrive_and_wait();
+
+	for ( auto& thread : threads )
+		thread.join();
+
+	const auto pushEnd = std::chrono::steady_clock::now();
+	logger.Flush();
+	const auto end = std::chrono::steady_clock::now();
+
+	return LogBenchmarkResult{
+		.numThreads = numThreads,
+		.numLogs = static_cast<std::uint64_t>( numThreads ) * numLogsPerThread,
+		.pushMs = std::chrono::duration<double, std::milli>( pushEnd - start ).count(),
+		.totalMs = std::chrono::duration<double, std::milli>( end - start ).count(),
+		.numDropped = logger.GetNumDroppedLogs() - numDroppedBefore };
+}
+} // namespace Scion::Logger
@@ -15,43 +15,35 @@ static const char* WHITE = "\033[0;30m";
 static const char* CLOSE = "\022[0m";
 #endif
 
+#include <algorithm>
 #include <chrono>
+#include <ctime>
 
 namespace Scion::Logger
 {
 
-Logger::LogTime::LogTime( const std::string& date )
-	: day{ date.substr( 0, 3 ) }
-	, dayNumber{ date.substr( 8, 2 ) }
-	, month{ date.substr( 4, 3 ) }
-	, year{ date.substr( 20, 4 ) }
-	, time{ date.substr( 11, 8 ) }
+Logger& Logger::GetInstance()
 {
-	// Ensure that the day number does not contain a space
-	if (!dayNumber.empty() && std::isspace(dayNumber[0]))
-	{
-		dayNumber[ 0 ] = '0';
-	}
+	static Logger instance{};
+	return instance;
 }
 
-std::string Logger::CurrentDateTime()
+Logger::~Logger()
 {
-	auto time = std::chrono::system_clock::to_time_t( std::chrono::system_clock::now() );
+	if ( !m_LogThread.joinable() )
+		return;
 
-	char buf[ 30 ];
-#ifdef _WIN32
-	ctime_s( buf, sizeof( buf ), &time );
-#else
-	ctime_r( &time, buf );
-#endif
-	LogTime logTime{ std::string{ buf } };
-	return fmt::format( "{0}-{1}-{2} {3}", logTime.year, logTime.month, logTime.dayNumber, logTime.time );
-}
+	{
+		std::scoped_lock lock{ m_WakeMutex };
+		m_bRunning.store( false, std::memory_order_release );
+	}
+	m_WakeCondition.notify_all();
 
-Logger& Logger::GetInstance()
-{
-	static Logger instance{};
-	return instance;
+	// The crash handler exits from whichever thread crashed, which could be the log thread itself.
+	if ( m_LogThread.get_id() == std::this_thread::get_id() )
+		m_LogThread.detach();
+	else
+		m_LogThread.join();
 }
 
 void Logger::Init( bool consoleLog, bool retainLogs )
@@ -66,36 +58,61 @@ void Logger::Init( bool consoleLog, bool retainLogs )
 
 	m_bConsoleLog = consoleLog;
 	m_bRetainLogs = retainLogs;
+
+	if ( m_bRetainLogs )
+		m_RetainedLogs.resize( MAX_RETAINED_LOGS );
+
+	m_bRunning.store( true, std::memory_order_release );
+	m_LogThread = std::thread{ &Logger::ProcessLogs, this };
 	m_bInitialized = true;
 }
 
-void Logger::WriteConsoleLog( std::string_view sv, LogEntry::LogType eType )
+void Logger::SetLogFile( const std::string& sFilepath )
 {
-#ifdef _WIN32
-	HANDLE hConsole = GetStdHandle( STD_OUTPUT_HANDLE );
-	switch ( eType )
-	{
-	case LogEntry::LogType::INFO: SetConsoleTextAttribute( hConsole, GREEN ); break;
-	case LogEntry::LogType::WARN: SetConsoleTextAttribute( hConsole, YELLOW ); break;
-	case LogEntry::LogType::ERR: SetConsoleTextAttribute( hConsole, RED ); break;
-	case LogEntry::LogType::NONE: break;
-	}
-	std::cout << sv << "\n";
-	SetConsoleTextAttribute( hConsole, WHITE );
-#else
-	switch ( eType )
-	{
-	case LogEntry::LogType::INFO: std::cout << GREEN << sv << CLOSE << "\n"; break;
-	case LogEntry::LogType::WARN: std::cout << YELLOW << sv << CLOSE << "\n"; break;
-	case LogEntry::LogType::ERR: std::cout << RED << sv << CLOSE << "\n"; break;
-	case LogEntry::LogType::NONE: std::cout << WHITE << sv << CLOSE << "\n"; break;
-	}
-#endif
+	std::scoped_lock lock{ m_FileMutex };
+	if ( m_LogFile.is_open() )
+		m_LogFile.close();
+
+	if ( sFilepath.empty() )
+		return;
+
+	m_LogFile.open( sFilepath, std::ios::out | std::ios::trunc );
+	if ( !m_LogFile.is_open() )
+		std::cout << "Failed to open log file: " << sFilepath << std::endl;
 }
 
-void Logger::LuaLog( const std::string_view message )
+void Logger::Flush()
+{
+	if ( !m_LogThread.joinable() || m_LogThread.get_id() == std::this_thread::get_id() )
+		return;
+
+	const std::uint64_t numPushed = m_NumPushed.load( std::memory_order_acquire );
+
+	std::unique_lock lock{ m_WakeMutex };
+	m_WakeCondition.notify_all();
+	m_FlushCondition.wait( lock, [ & ] {
+		return m_NumProcessed.load( std::memory_order_acquire ) >= numPushed ||
+			   !m_bRunning.load( std::memory_order_acquire );
+	} );
+}
+
+void Logger::ClearLogs()
+{
+	std::scoped_lock lock{ m_RetainMutex };
+	m_FirstRetained = m_NextLog;
+}
+
+std::uint64_t Logger::GetLogs( std::uint64_t firstLog, std::vector<LogEntry>& logs )
+{
+	std::scoped_lock lock{ m_RetainMutex };
+	for ( std::uint64_t i = std::max( firstLog, m_FirstRetained ); i < m_NextLog; ++i )
+		logs.push_back( m_RetainedLogs[ i % MAX_RETAINED_LOGS ] );
+
+	return m_NextLog;
+}
+
+void Logger::Push( LogEntry::LogType eType, LogSource eSource, std::string&& sMessage )
 {
-	std::scoped_lock lock{ m_Mutex };
 	assert( m_bInitialized && "The logger must be initialized before it is used!" );
 
 	if ( !m_bInitialized )
@@ -104,88 +121,224 @@ void Logger::LuaLog( const std::string_view message )
 		return;
 	}
 
-	std::stringstream ss;
-	ss << "LUA [INFO]: " << CurrentDateTime() << " - " << message << "\n";
+	LogRecord record{
+		.type = eType, .source = eSource, .time = std::chrono::system_clock::now(), .message = std::move( sMessage ) };
 
-	if ( m_bConsoleLog )
+	// Never block the caller, the log thread reports how many logs were dropped instead.
+	if ( !m_Queue.TryPush( std::move( record ) ) )
 	{
-#ifdef _WIN32
-		HANDLE hConsole = GetStdHandle( STD_OUTPUT_HANDLE );
-		SetConsoleTextAttribute( hConsole, GREEN );
-		std::cout << ss.str();
-		SetConsoleTextAttribute( hConsole, WHITE );
-#else
-		std::cout << GREEN << ss.str() << CLOSE << "\n\n";
-#endif
+		m_NumDropped.fetch_add( 1, std::memory_order_relaxed );
+		return;
 	}
 
-	if ( m_bRetainLogs )
+	m_NumPushed.fetch_add( 1, std::memory_order_release );
+}
+
+void Logger::ProcessLogs()
+{
+	LogRecord record{};
+
+	for ( ;; )
 	{
-		m_LogEntries.emplace_back( LogEntry::LogType::INFO, ss.str() );
+		// Read this before draining the queue, so the logs pushed before shutting down are still written.
+		const bool bRunning = m_bRunning.load( std::memory_order_acquire );
+		const auto now = std::chrono::steady_clock::now();
+
+		std::uint64_t numProcessed{ 0 };
+		while ( m_Queue.TryPop( record ) )
+		{
+			if ( !CheckRepeated( record, now ) )
+				WriteLog( record, 0 );
+
+			++numProcessed;
+		}
+
+		WriteDropped();
+		WriteRepeats( !bRunning, now );
+
+		if ( numProcessed > 0 )
+		{
+			std::cout.flush();
+
+			std::scoped_lock fileLock{ m_FileMutex };
+			if ( m_LogFile.is_open() )
+				m_LogFile.flush();
+		}
+
+		std::unique_lock lock{ m_WakeMutex };
+		m_NumProcessed.fetch_add( numProcessed, std::memory_order_release );
+		m_FlushCondition.notify_all();
+
+		if ( !bRunning )
+			break;
+
+		m_WakeCondition.wait_for( lock, LOG_THREAD_INTERVAL );
 	}
 }
 
-void Logger::LuaWarn( const std::string_view message )
+bool Logger::CheckRepeated( const LogRecord& record, std::chrono::steady_clock::time_point now )
 {
-	std::scoped_lock lock{ m_Mutex };
-	assert( m_bInitialized && "The logger must be initialized before it is used!" );
+	const std::size_t hash = std::hash<std::string>{}( record.message ) ^ static_cast<std::size_t>( record.type );
 
-	if ( !m_bInitialized )
+	auto itr = m_mapRepeatedLogs.find( hash );
+	if ( itr == m_mapRepeatedLogs.end() )
 	{
-		std::cout << "The logger must be initialized before it is used!" << std::endl;
-		return;
-	}
+		if ( m_mapRepeatedLogs.size() < MAX_TRACKED_LOGS )
+			m_mapRepeatedLogs.emplace( hash, RepeatedLog{ .record = record, .windowStart = now } );
 
-	std::stringstream ss;
-	ss << "LUA [WARN]: " << CurrentDateTime() << " - " << message << "\n";
+		return false;
+	}
 
-	if ( m_bConsoleLog )
+	auto& repeatedLog = itr->second;
+	if ( repeatedLog.record.type != record.type || repeatedLog.record.source != record.source ||
+		 repeatedLog.record.message != record.message )
 	{
-#ifdef _WIN32
-		HANDLE hConsole = GetStdHandle( STD_OUTPUT_HANDLE );
-		SetConsoleTextAttribute( hConsole, YELLOW );
-		std::cout << ss.str();
-		SetConsoleTextAttribute( hConsole, WHITE );
-#else
-		std::cout << YELLOW << ss.str() << CLOSE << "\n\n";
-#endif
+		return false;
 	}
 
-	if ( m_bRetainLogs )
+	if ( now - repeatedLog.windowStart >= LOG_REPEAT_WINDOW )
 	{
-		m_LogEntries.emplace_back( LogEntry::LogType::WARN, ss.str() );
+		// The window is over, write the repeats so far and start a new window with this log.
+		if ( repeatedLog.numRepeats > 0 )
+			WriteLog( repeatedLog.record, repeatedLog.numRepeats );
+
+		repeatedLog.windowStart = now;
+		repeatedLog.numRepeats = 0;
+		return false;
 	}
+
+	repeatedLog.record.time = record.time;
+	++repeatedLog.numRepeats;
+	return true;
 }
 
-void Logger::LuaError( const std::string_view message )
+void Logger::WriteRepeats( bool bWriteAll, std::chrono::steady_clock::time_point now )
 {
-	std::scoped_lock lock{ m_Mutex };
-	assert( m_bInitialized && "The logger must be initialized before it is used!" );
+	std::erase_if( m_mapRepeatedLogs, [ & ]( const auto& pair ) {
+		const auto& repeatedLog = pair.second;
+		if ( !bWriteAll && now - repeatedLog.windowStart < LOG_REPEAT_WINDOW )
+			return false;
 
-	if ( !m_bInitialized )
-	{
-		std::cout << "The logger must be initialized before it is used!" << std::endl;
+		if ( repeatedLog.numRepeats > 0 )
+			WriteLog( repeatedLog.record, repeatedLog.numRepeats );
+
+		return true;
+	} );
+}
+
+void Logger::WriteDropped()
+{
+	const std::uint64_t numDropped = m_NumDropped.load( std::memory_order_relaxed );
+	if ( numDropped == m_NumReportedDrops )
 		return;
+
+	WriteLog( LogRecord{ .type = LogEntry::LogType::WARN,
+						 .source = LogSource::SCION,
+						 .time = std::chrono::system_clock::now(),
+						 .message = fmt::format( "{} logs were dropped, the log queue was full.",
+												 numDropped - m_NumReportedDrops ) },
+			  0 );
+
+	m_NumReportedDrops = numDropped;
+}
+
+void Logger::WriteLog( const LogRecord& record, std::uint32_t numRepeats )
+{
+	std::string_view sType{};
+	switch ( record.type )
+	{
+	case LogEntry::LogType::INFO: sType = "INFO"; break;
+	case LogEntry::LogType::WARN: sType = "WARN"; break;
+	case LogEntry::LogType::ERR: sType = "ERROR"; break;
+	case LogEntry::LogType::NONE: sType = "NONE"; break;
 	}
 
-	std::stringstream ss;
-	ss << "LUA [ERROR]: " << CurrentDateTime() << " - " << message << "\n";
+	std::string sLog = fmt::format( "{} [{}]: {} - {}",
+									record.source == LogSource::LUA ? "LUA" : "SCION",
+									sType,
+									FormatTime( record.time ),
+									record.message );
+
+	if ( numRepeats > 0 )
+		sLog += fmt::format( "\n(Repeated {} more times)", numRepeats );
 
 	if ( m_bConsoleLog )
+		WriteConsoleLog( sLog, record.type );
+
+	{
+		std::scoped_lock lock{ m_FileMutex };
+		if ( m_LogFile.is_open() )
+			m_LogFile << sLog << "\n";
+	}
+
+	if ( m_bRetainLogs )
 	{
+		std::scoped_lock lock{ m_RetainMutex };
+		m_RetainedLogs[ m_NextLog % MAX_RETAINED_LOGS ] = LogEntry{ .type = record.type, .log = std::move( sLog ) };
+		++m_NextLog;
+		if ( m_NextLog - m_FirstRetained > MAX_RETAINED_LOGS )
+			m_FirstRetained = m_NextLog - MAX_RETAINED_LOGS;
+	}
+}
+
+const std::string& Logger::FormatTime( std::chrono::system_clock::time_point time )
+{
+	// Logs come in bursts, so the formatted time is reused until the second changes.
+	const std::time_t logTime = std::chrono::system_clock::to_time_t( time );
+	if ( logTime == m_LastLogTime && !m_sLastLogTime.empty() )
+		return m_sLastLogTime;
+
+	std::tm localTime{};
 #ifdef _WIN32
-		HANDLE hConsole = GetStdHandle( STD_OUTPUT_HANDLE );
-		SetConsoleTextAttribute( hConsole, RED );
-		std::cout << ss.str();
-		SetConsoleTextAttribute( hConsole, WHITE );
+	localtime_s( &localTime, &logTime );
 #else
-		std::cout << RED << ss.str() << CLOSE << "\n\n";
+	localtime_r( &logTime, &localTime );
 #endif
-	}
 
-	if ( m_bRetainLogs )
+	char buf[ 32 ];
+	std::strftime( buf, sizeof( buf ), "%Y-%b-%d %H:%M:%S", &localTime );
+
+	m_LastLogTime = logTime;
+	m_sLastLogTime = buf;
+	return m_sLastLogTime;
+}
+
+void Logger::WriteConsoleLog( std::string_view sv, LogEntry::LogType eType )
+{
+#ifdef _WIN32
+	HANDLE hConsole = GetStdHandle( STD_OUTPUT_HANDLE );
+	switch ( eType )
+	{
+	case LogEntry::LogType::INFO: SetConsoleTextAttribute( hConsole, GREEN ); break;
+	case LogEntry::LogType::WARN: SetConsoleTextAttribute( hConsole, YELLOW ); break;
+	case LogEntry::LogType::ERR: SetConsoleTextAttribute( hConsole, RED ); break;
+	case LogEntry::LogType::NONE: break;
+	}
+	std::cout << sv << "\n";
+	SetConsoleTextAttribute( hConsole, WHITE );
+#else
+	switch ( eType )
 	{
-		m_LogEntries.emplace_back( LogEntry::LogType::ERR, ss.str() );
+	case LogEntry::LogType::INFO: std::cout << GREEN << sv << CLOSE << "\n"; break;
+	case LogEntry::LogType::WARN: std::cout << YELLOW << sv << CLOSE << "\n"; break;
+	case LogEntry::LogType::ERR: std::cout << RED << sv << CLOSE << "\n"; break;
+	case LogEntry::LogType::NONE: std::cout << WHITE << sv << CLOSE << "\n"; break;
 	}
+#endif
+}
+
+void Logger::LuaLog( const std::string_view message )
+{
+	Push( LogEntry::LogType::INFO, LogSource::LUA, std::string{ message } );
+}
+
+void Logger::LuaWarn( const std::string_view message )
+{
+	Push( LogEntry::LogType::WARN, LogSource::LUA, std::string{ message } );
+}
+
+void Logger::LuaError( const std::string_view message )
+{
+	Push( LogEntry::LogType::ERR, LogSource::LUA, std::string{ message } );
 }
 } // namespace Scion::Logger
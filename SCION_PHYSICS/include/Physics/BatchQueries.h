@@ -0,0 +1,91 @@
+#pragma once
+#include <box2d/box2d.h>
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Scion::Utilities
+{
+class ThreadPool;
+}
+
+namespace Scion::Physics
+{
+/*
+ * RayCastQuery
+ * A single ray submitted to BatchRayCast. Both points are in world space (meters).
+ */
+struct RayCastQuery
+{
+	b2Vec2 start{ 0.f, 0.f };
+	b2Vec2 end{ 0.f, 0.f };
+};
+
+/*
+ * RayCastHit
+ * Compact result for a single ray. Only plain data is stored here, no ObjectData copies.
+ * The entity id can be used to look up anything else about the hit object.
+ */
+struct RayCastHit
+{
+	std::uint32_t entityID{ entt::null };
+	/* The world space point of the closest hit. */
+	b2Vec2 point{ 0.f, 0.f };
+	/* The surface normal at the point of the hit. */
+	b2Vec2 normal{ 0.f, 0.f };
+	/* Fraction along the ray [0, 1] where the hit happened. */
+	float fraction{ 1.f };
+	bool bHit{ false };
+};
+
+/*
+ * BoxTraceResults
+ * Flattened results of a batched box trace. The entity ids for box i are stored
+ * in entities[ offsets[ i ] ] up to entities[ offsets[ i + 1 ] ].
+ */
+struct BoxTraceResults
+{
+	std::vector<std::uint32_t> entities{};
+	std::vector<std::uint32_t> offsets{};
+
+	inline std::size_t NumBoxes() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+	inline std::uint32_t NumHits( std::size_t box ) const { return offsets[ box + 1 ] - offsets[ box ]; }
+	void Clear()
+	{
+		entities.clear();
+		offsets.clear();
+	}
+};
+
+/*
+ * @brief Casts all of the rays against the world and stores the closest hit for each ray.
+ * Box2D queries are read-only, so when a thread pool is supplied and there are enough rays, the
+ * queries are split into chunks and run in parallel. This must not be called while the world is stepping.
+ * @param Takes in the physics world to query.
+ * @param Takes in the rays to cast in world space.
+ * @param Takes in a vector for the results. It is resized to match the number of rays, hits[ i ] belongs to rays[ i ].
+ * @param Takes in the category bits a fixture must match to be hit. Defaults to all categories.
+ * @param Takes in an optional thread pool.
+ */
+void BatchRayCast( const b2World& world, const std::vector<RayCastQuery>& rays, std::vector<RayCastHit>& hits,
+				   std::uint16_t maskBits = 0xFFFF, Scion::Utilities::ThreadPool* pThreadPool = nullptr );
+
+/*
+ * @brief Finds all of the entities whose fixtures overlap each of the passed in boxes.
+ * Like BatchRayCast, this can run the queries in parallel if a thread pool is supplied.
+ * @param Takes in the physics world to query.
+ * @param Takes in the boxes to trace in world space.
+ * @param Takes in the results to fill. Any previous results are cleared.
+ * @param Takes in the category bits a fixture must match to be reported. Defaults to all categories.
+ * @param Takes in an optional thread pool.
+ */
+void BatchBoxTrace( const b2World& world, const std::vector<b2AABB>& boxes, BoxTraceResults& results,
+					std::uint16_t maskBits = 0xFFFF, Scion::Utilities::ThreadPool* pThreadPool = nullptr );
+
+/*
+ * @brief Gets the entity id stored in the fixtures object data without copying the object data.
+ * @return Returns the entity id if the fixture has valid object data, entt::null otherwise.
+ */
+std::uint32_t GetFixtureEntityID( const b2Fixture* pFixture );
+
+} // namespace Scion::Physics
@@ -0,0 +1,209 @@
+#include "Physics/BatchQueries.h"
+#include "Physics/UserData.h"
+#include <ScionUtilities/ThreadPool.h>
+#include <Logger/Logger.h>
+
+#include <future>
+
+namespace Scion::Physics
+{
+namespace
+{
+/* Below this many queries per chunk, it is cheaper to just run them on the calling thread. */
+constexpr std::size_t MIN_QUERIES_PER_TASK = 64;
+
+/*
+ * Keeps the closest hit along the ray. Unlike the RayCastCallback, this callback clips the ray
+ * to each reported fraction so that Box2D returns the nearest fixture rather than the first one found.
+ */
+class ClosestRayCastCallback : public b2RayCastCallback
+{
+  public:
+	ClosestRayCastCallback( RayCastHit& hit, std::uint16_t maskBits )
+		: m_Hit{ hit }
+		, m_MaskBits{ maskBits }
+	{
+	}
+
+	virtual float ReportFixture( b2Fixture* pFixture, const b2Vec2& point, const b2Vec2& normal,
+								 float fraction ) override
+	{
+		// Returning -1 tells Box2D to ignore this fixture and continue.
+		if ( ( pFixture->GetFilterData().categoryBits & m_MaskBits ) == 0 )
+			return -1.f;
+
+		m_Hit.bHit = true;
+		m_Hit.entityID = GetFixtureEntityID( pFixture );
+		m_Hit.point = point;
+		m_Hit.normal = normal;
+		m_Hit.fraction = fraction;
+
+		return fraction;
+	}
+
+  private:
+	RayCastHit& m_Hit;
+	std::uint16_t m_MaskBits;
+};
+
+class EntityQueryCallback : public b2QueryCallback
+{
+  public:
+	EntityQueryCallback( std::vector<std::uint32_t>& entities, std::uint16_t maskBits )
+		: m_Entities{ entities }
+		, m_MaskBits{ maskBits }
+		, m_AABB{}
+	{
+	}
+
+	void SetAABB( const b2AABB& aabb ) { m_AABB = aabb; }
+
+	virtual bool ReportFixture( b2Fixture* pFixture ) override
+	{
+		if ( ( pFixture->GetFilterData().categoryBits & m_MaskBits ) == 0 )
+			return true;
+
+		// The broadphase reports fattened AABBs, test against the fixtures actual bounds.
+		if ( !b2TestOverlap( pFixture->GetAABB( 0 ), m_AABB ) )
+			return true;
+
+		auto entityID = GetFixtureEntityID( pFixture );
+		if ( entityID != entt::null )
+			m_Entities.push_back( entityID );
+
+		return true;
+	}
+
+  private:
+	std::vector<std::uint32_t>& m_Entities;
+	std::uint16_t m_MaskBits;
+	b2AABB m_AABB;
+};
+
+/*
+ * Splits [0, count) into chunks and runs the function on each of them. The calling thread
+ * processes the first chunk while the thread pool handles the rest.
+ */
+template <typename TFunc>
+void RunChunked( std::size_t count, Scion::Utilities::ThreadPool* pThreadPool, TFunc&& func )
+{
+	const std::size_t numWorkers = std::thread::hardware_concurrency();
+	if ( !pThreadPool || count < MIN_QUERIES_PER_TASK * 2 || numWorkers < 2 )
+	{
+		func( 0, count, 0 );
+		return;
+	}
+
+	const std::size_t numChunks = std::min( numWorkers, count / MIN_QUERIES_PER_TASK );
+	const std::size_t chunkSize = ( count + numChunks - 1 ) / numChunks;
+
+	std::vector<std::future<void>> futures;
+	futures.reserve( numChunks - 1 );
+
+	std::size_t chunk = 1;
+	for ( ; chunk < numChunks; ++chunk )
+	{
+		const std::size_t begin = chunk * chunkSize;
+		const std::size_t end = std::min( count, begin + chunkSize );
+
+		try
+		{
+			futures.emplace_back(
+				pThreadPool->Enqueue( [ &func, begin, end, chunk ] { func( begin, end, chunk ); } ) );
+		}
+		catch ( const std::exception& ex )
+		{
+			SCION_ERROR( "Failed to enqueue batched physics queries - {}", ex.what() );
+			break;
+		}
+	}
+
+	// Anything that could not be enqueued is run on the calling thread.
+	for ( ; chunk < numChunks; ++chunk )
+	{
+		const std::size_t begin = chunk * chunkSize;
+		func( begin, std::min( count, begin + chunkSize ), chunk );
+	}
+
+	func( 0, std::min( count, chunkSize ), 0 );
+
+	for ( auto& future : futures )
+		future.wait();
+}
+
+} // namespace
+
+std::uint32_t GetFixtureEntityID( const b2Fixture* pFixture )
+{
+	if ( !pFixture )
+		return entt::null;
+
+	auto* pUserData = reinterpret_cast<UserData*>( pFixture->GetUserData().pointer );
+	if ( !pUserData || pUserData->type_id != entt::type_hash<ObjectData>::value() )
+		return entt::null;
+
+	if ( const auto* pObjectData = std::any_cast<ObjectData>( &pUserData->userData ) )
+		return pObjectData->entityID;
+
+	return entt::null;
+}
+
+void BatchRayCast( const b2World& world, const std::vector<RayCastQuery>& rays, std::vector<RayCastHit>& hits,
+				   std::uint16_t maskBits, Scion::Utilities::ThreadPool* pThreadPool )
+{
+	hits.assign( rays.size(), RayCastHit{} );
+	if ( rays.empty() )
+		return;
+
+	RunChunked( rays.size(), pThreadPool, [ & ]( std::size_t begin, std::size_t end, std::size_t ) {
+		for ( std::size_t i = begin; i < end; ++i )
+		{
+			const auto& ray = rays[ i ];
+
+			// Box2D asserts on zero length rays
+			if ( ( ray.end - ray.start ).LengthSquared() <= 0.f )
+				continue;
+
+			ClosestRayCastCallback callback{ hits[ i ], maskBits };
+			world.RayCast( &callback, ray.start, ray.end );
+		}
+	} );
+}
+
+void BatchBoxTrace( const b2World& world, const std::vector<b2AABB>& boxes, BoxTraceResults& results,
+					std::uint16_t maskBits, Scion::Utilities::ThreadPool* pThreadPool )
+{
+	results.Clear();
+	results.offsets.resize( boxes.size() + 1, 0 );
+	if ( boxes.empty() )
+		return;
+
+	// Each chunk writes into its own entity list, the hit counts are written directly into the offsets.
+	std::vector<std::vector<std::uint32_t>> chunkEntities(
+		std::max<std::size_t>( 1, std::thread::hardware_concurrency() ) );
+
+	RunChunked( boxes.size(), pThreadPool, [ & ]( std::size_t begin, std::size_t end, std::size_t chunk ) {
+		auto& entities = chunkEntities[ chunk ];
+
+		EntityQueryCallback callback{ entities, maskBits };
+		for ( std::size_t i = begin; i < end; ++i )
+		{
+			const auto numBefore = entities.size();
+			callback.SetAABB( boxes[ i ] );
+			world.QueryAABB( &callback, boxes[ i ] );
+			results.offsets[ i + 1 ] = static_cast<std::uint32_t>( entities.size() - numBefore );
+		}
+	} );
+
+	// Convert the counts into offsets
+	for ( std::size_t i = 1; i < results.offsets.size(); ++i )
+		results.offsets[ i ] += results.offsets[ i - 1 ];
+
+	results.entities.reserve( results.offsets.back() );
+
+	// Chunks cover consecutive ranges of boxes, so appending them in order keeps the offsets valid.
+	for ( const auto& entities : chunkEntities )
+		results.entities.insert( results.entities.end(), entities.begin(), entities.end() );
+}
+
+} // namespace Scion::Physics
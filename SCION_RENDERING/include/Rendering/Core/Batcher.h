@@ -1,5 +1,6 @@
 #pragma once
 #include "Rendering/Essentials/Vertex.h"
+#include "Rendering/Utils/RenderStats.h"
 #include <vector>
 #include <memory>
 
@@ -171,6 +172,7 @@ inline void Batcher<TBatch, TGlyph>::Flush( std::vector<TVertex>& vertices )
 	glBufferData( GL_ARRAY_BUFFER, vertices.size() * sizeof( TVertex ), nullptr, GL_DYNAMIC_DRAW );
 	// Upload the data
 	glBufferSubData( GL_ARRAY_BUFFER, 0, vertices.size() * sizeof( TVertex ), vertices.data() );
+	RenderStats::AddVertexUpload( vertices.size(), vertices.size() * sizeof( TVertex ) );
 
 	glBindBuffer( GL_ARRAY_BUFFER, 0 );
 
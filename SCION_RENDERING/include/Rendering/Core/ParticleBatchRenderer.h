@@ -0,0 +1,66 @@
+#pragma once
+#include "Rendering/Essentials/Vertex.h"
+#include <vector>
+
+namespace Scion::Rendering
+{
+/* The most particles that can be drawn before the renderer has to flush. */
+constexpr size_t MAX_PARTICLE_INSTANCES = 131072;
+
+/*
+ * ParticleBatchRenderer
+ * Draws particles as instances of a single quad. The per particle data is uploaded straight from the particle
+ * arrays, one section of the instance buffer for each array, so nothing is interleaved on the CPU.
+ * Consecutive particles that use the same texture are drawn with one instanced draw call.
+ */
+class ParticleBatchRenderer
+{
+  public:
+	ParticleBatchRenderer();
+	~ParticleBatchRenderer();
+
+	ParticleBatchRenderer( const ParticleBatchRenderer& ) = delete;
+	ParticleBatchRenderer& operator=( const ParticleBatchRenderer& ) = delete;
+
+	void Begin();
+
+	/*
+	 * @brief Adds particles to the batch. The arrays must hold at least count entries.
+	 * If the instance buffer fills up, the particles added so far are drawn first.
+	 * @param Takes in the center positions, the sizes in pixels, the colors and the texture id.
+	 * A texture id of 0 draws the particles as solid squares.
+	 */
+	void AddParticles( const float* pPositionsX,
+					   const float* pPositionsY,
+					   const float* pSizes,
+					   const Color* pColors,
+					   size_t count,
+					   GLuint textureID );
+
+	void End();
+	void Render();
+
+  private:
+	struct ParticleBatch
+	{
+		GLuint textureID{ 0 };
+		/* The first instance of the batch, in the instance buffer. */
+		GLuint first{ 0 };
+		GLsizei count{ 0 };
+	};
+
+	void Initialize();
+	void SetInstanceAttributes( GLuint first );
+
+  private:
+	GLuint m_VAO;
+	GLuint m_QuadVBO;
+	GLuint m_IBO;
+	GLuint m_InstanceVBO;
+	/* A 1x1 white texture, used for particles that do not have a texture. */
+	GLuint m_WhiteTexture;
+
+	std::vector<ParticleBatch> m_Batches;
+	GLuint m_NumInstances;
+};
+} // namespace Scion::Rendering
@@ -1,5 +1,6 @@
 #pragma once
 #include "Batcher.h"
+#include "TextLayoutCache.h"
 #include "Rendering/Essentials/BatchTypes.h"
 
 namespace Scion::Rendering
@@ -17,8 +18,25 @@ class TextBatchRenderer : public Batcher<TextBatch, TextGlyph>
 				  int padding = 4, float wrap = 0.f, Color color = Color{ 255, 255, 255, 255 },
 				  glm::mat4 model = glm::mat4{ 1.f } );
 
+	/*
+	 * @brief Adds text that has already been laid out. The layout is moved to the position
+	 * and transformed by the model without being shaped again.
+	 */
+	void AddText( const std::shared_ptr<const TextLayout>& pLayout, const glm::vec2& position,
+				  Color color = Color{ 255, 255, 255, 255 }, glm::mat4 model = glm::mat4{ 1.f } );
+
+	/*
+	 * @brief Gets the cached layout of the text, shaping it if it is not in the cache.
+	 * The layout can be held and passed back into AddText until the text changes.
+	 */
+	std::shared_ptr<const TextLayout> GetTextLayout( const std::string& text, const std::shared_ptr<Font>& font,
+													 int padding = 4, float wrap = 0.f );
+
   private:
 	void Initialize();
 	virtual void GenerateBatches() override;
+
+  private:
+	TextLayoutCache m_LayoutCache;
 };
 } // namespace Scion::Rendering
@@ -0,0 +1,71 @@
+#pragma once
+#include "Rendering/Essentials/BatchTypes.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace Scion::Rendering
+{
+/*
+ * TextLayoutCache
+ * Stores the shaped glyph quads of text, so that the word wrap and glyph lookups only run when the text changes.
+ * Layouts are keyed on the text hash, font, wrap and padding. Entries that have not been used for a number of
+ * frames are evicted at the end of the frame. Layouts that are still held elsewhere stay valid after eviction.
+ */
+class TextLayoutCache
+{
+  public:
+	TextLayoutCache() = default;
+	~TextLayoutCache() = default;
+
+	/*
+	 * @brief Gets the cached layout of the text, creating it if it does not exist.
+	 * @return Returns the layout, or nullptr if the font is invalid.
+	 */
+	std::shared_ptr<const TextLayout> GetLayout( const std::string& sText, const std::shared_ptr<Font>& pFont,
+												 float wrap, int padding );
+
+	/*
+	 * @brief Evicts the layouts that have not been used for the last few frames.
+	 * Should be called once per frame.
+	 */
+	void EndFrame();
+
+	inline void Clear() { m_mapLayouts.clear(); }
+	inline std::size_t Size() const { return m_mapLayouts.size(); }
+
+	/*
+	 * @brief Shapes the text into glyph quads relative to the text position, wrapping the lines if needed.
+	 * If the text fails to wrap, the returned layout has no glyphs.
+	 */
+	static std::shared_ptr<TextLayout> CreateLayout( const std::string& sText, Font& font, float wrap, int padding );
+
+  private:
+	struct LayoutKey
+	{
+		std::size_t textHash{ 0 };
+		const Font* pFont{ nullptr };
+		GLuint fontAtlasID{ 0 };
+		float wrap{ 0.f };
+		int padding{ 0 };
+
+		bool operator==( const LayoutKey& ) const = default;
+	};
+
+	struct LayoutKeyHasher
+	{
+		std::size_t operator()( const LayoutKey& key ) const;
+	};
+
+	struct LayoutEntry
+	{
+		/* Used to detect hash collisions. */
+		std::string sText{};
+		std::shared_ptr<const TextLayout> pLayout{ nullptr };
+		std::uint64_t lastUsedFrame{ 0 };
+	};
+
+	std::unordered_map<LayoutKey, LayoutEntry, LayoutKeyHasher> m_mapLayouts{};
+	std::uint64_t m_CurrentFrame{ 0 };
+};
+} // namespace Scion::Rendering
@@ -1,7 +1,10 @@
 #pragma once
 #include "Vertex.h"
 #include "Font.h"
+#include "SDFFontAtlas.h"
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace Scion::Rendering
 {
@@ -60,20 +63,38 @@ struct CircleGlyph
 
 struct TextBatch
 {
+	GLuint numIndices{ 0 };
 	GLuint offset{ 0 };
-	GLuint numVertices{ 0 };
 	GLuint fontAtlasID{ 0 };
 };
 
+/*
+ * TextLayout
+ * The shaped glyph quads of a text string, relative to the text position.
+ * Created once by the TextLayoutCache and reused until the text, font, wrap or padding changes.
+ */
+struct TextLayout
+{
+	std::vector<FontGlyph> glyphs{};
+	const Font* pFont{ nullptr };
+	GLuint fontAtlasID{ 0 };
+	/* The SDF atlas shelves the glyphs were taken from. The layout is stale if any of them have been evicted. */
+	std::vector<SDFShelfStamp> atlasShelves{};
+	float wrap{ 0.f };
+	int padding{ 0 };
+
+	inline bool IsStale( const Font& font ) const
+	{
+		return pFont != &font || font.IsAtlasStale( atlasShelves );
+	}
+};
+
 struct TextGlyph
 {
-	std::string textStr{};
+	std::shared_ptr<const TextLayout> pLayout{ nullptr };
 	glm::vec2 position{ 0.f };
 	Color color{ 255, 255, 255, 255 };
 	glm::mat4 model{ 1.f };
-	std::shared_ptr<Font> font{ nullptr };
-	float wrap{ 0.f };
-	int padding{ 0 };
 };
 
 struct PickingGlyph
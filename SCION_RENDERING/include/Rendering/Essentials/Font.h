@@ -3,6 +3,8 @@
 #include <glm/glm.hpp>
 #include <glad/glad.h>
 #include <map>
+#include <memory>
+#include <vector>
 
 namespace Scion::Rendering
 {
@@ -12,6 +14,9 @@ struct FontGlyph
 	Vertex max;
 };
 
+class SDFFontAtlas;
+struct SDFShelfStamp;
+
 struct PaddingInfo
 {
 	float paddingX{ 0.f };
@@ -23,12 +28,41 @@ class Font
   public:
 	Font( GLuint fontAtlasID, int width, int height, float fontSize, void* data, float fontAscent = 0.f,
 		  const std::string& sFilename = "" );
+
+	/*
+	 * @brief Creates a font drawn from a signed distance field atlas. Fonts of any size can share the same atlas.
+	 * @param Takes in the atlas, the size to draw the font at, and the filename of the font if loaded from a file.
+	 */
+	Font( std::shared_ptr<SDFFontAtlas> pSDFAtlas, float fontSize, const std::string& sFilename = "" );
 	~Font();
 
 	FontGlyph GetGlyph( char c, glm::vec2& pos );
+	/*
+	 * @brief Gets the glyph of a unicode codepoint. Bitmap fonts only contain ASCII glyphs,
+	 * any other codepoint returns an empty glyph.
+	 */
+	FontGlyph GetCodepointGlyph( std::uint32_t codepoint, glm::vec2& pos );
 	void GetNextCharPos( char c, glm::vec2& pos );
 	const PaddingInfo& GetPaddingInfoForChar( char c ) const;
 
+	/*
+	 * @brief Starts recording the SDF atlas shelves used while shaping a layout. Does nothing for bitmap fonts.
+	 */
+	void BeginShaping();
+
+	/*
+	 * @brief Stops recording the SDF atlas shelves.
+	 * @return Returns the shelves used since BeginShaping, always empty for bitmap fonts.
+	 */
+	std::vector<SDFShelfStamp> EndShaping();
+
+	/*
+	 * @brief Checks if glyphs were evicted from the SDF atlas shelves since they were recorded.
+	 * Layouts using evicted glyphs need to be created again. Always false for bitmap fonts.
+	 */
+	bool IsAtlasStale( const std::vector<SDFShelfStamp>& shelves ) const;
+
+	inline bool IsSDF() const { return m_pSDFAtlas != nullptr; }
 	inline const GLuint GetFontAtlasID() const { return m_FontAtlasID; }
 	inline const float GetFontSize() const { return m_FontSize; }
 	inline const PaddingInfo& AveragePaddingInfo() const { return m_AveragePadding; }
@@ -53,5 +87,7 @@ class Font
 	std::map<char, PaddingInfo> m_mapPaddingInfo;
 	/* Filename of font if loaded from a file. */
 	std::string m_sFilename;
+	/* The distance field atlas, if this is an SDF font. Shared between fonts of the same file. */
+	std::shared_ptr<SDFFontAtlas> m_pSDFAtlas;
 };
 } // namespace Scion::Rendering
@@ -28,5 +28,14 @@ class FontLoader
 	 */
 	static std::shared_ptr<class Font> CreateFromMemory( const unsigned char* fontData, float fontSize = 32.f,
 														 int width = 512, int height = 512 );
+
+	/*
+	 * @brief Creates a signed distance field atlas for the font file. Glyphs are added to the atlas as they are used.
+	 * Pass the atlas into the SDF Font constructor, fonts of different sizes can share the same atlas.
+	 * @param A string for the font path, and the width and height of the atlas texture.
+	 * @return Returns a shared_ptr to the atlas if successful, nullptr otherwise.
+	 */
+	static std::shared_ptr<class SDFFontAtlas> CreateSDFAtlas( const std::string& fontPath, int width = 1024,
+															   int height = 1024 );
 };
 } // namespace Scion::Rendering
@@ -16,14 +16,48 @@ class PickingTexture
 	void Resize( int width, int height );
 	void CheckResize();
 
+	/*
+	 * @brief Reads the entity id at the pixel. This waits for the GPU to finish drawing the picking pass.
+	 */
 	uint32_t ReadPixel( int x, int y ) const;
 
+	/*
+	 * @brief Starts an asynchronous read of the pixel into a pixel buffer object.
+	 * The result can be collected with TryGetPixel one or two frames later, once the GPU has caught up.
+	 * If every buffer is still in flight, the oldest read is dropped.
+	 */
+	void RequestPixel( int x, int y );
+
+	/*
+	 * @brief Collects the result of the oldest finished read without waiting for the GPU.
+	 * A read that has been pending for MAX_PICKING_LATENCY frames is waited on, so a result is never
+	 * delayed by more than that.
+	 * @param Takes in the value to write the entity id to.
+	 * @return Returns true if a read finished, false if there is nothing to collect yet.
+	 */
+	bool TryGetPixel( uint32_t& pixel );
+
+	inline bool HasPendingRead() const { return m_NumPendingReads > 0; }
+
 	inline int GetWidth() const { return m_Width; }
 	inline int GetHeight() const { return m_Height; }
 
   private:
 	bool Init( int width, int height );
 	void CleanUp();
+	void ClearPendingReads();
+
+  private:
+	/* The number of reads that can be in flight at once. */
+	static constexpr int NUM_PICKING_BUFFERS = 2;
+	/* The number of polls before a pending read is waited on. */
+	static constexpr int MAX_PICKING_LATENCY = 3;
+
+	struct PendingRead
+	{
+		GLsync fence{ nullptr };
+		int numPolls{ 0 };
+	};
 
   private:
 	GLuint m_TextureID;
@@ -32,5 +66,12 @@ class PickingTexture
 	int m_Width;
 	int m_Height;
 	bool m_bShouldResize;
+
+	GLuint m_PixelBuffers[ NUM_PICKING_BUFFERS ];
+	PendingRead m_PendingReads[ NUM_PICKING_BUFFERS ];
+	/* The buffer the next read is written to, and the oldest buffer that is still pending. */
+	int m_WriteIndex;
+	int m_ReadIndex;
+	int m_NumPendingReads;
 };
 } // namespace Scion::Rendering
@@ -0,0 +1,141 @@
+#pragma once
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct stbtt_fontinfo;
+
+namespace Scion::Rendering
+{
+/*
+ * SDFGlyph
+ * The metrics and atlas location of a glyph rasterized at the atlas base size.
+ */
+struct SDFGlyph
+{
+	/* Offset from the pen position on the baseline to the top left of the quad. */
+	glm::vec2 offset{ 0.f };
+	/* Size of the quad, including the distance field padding. */
+	glm::vec2 size{ 0.f };
+	glm::vec2 uvMin{ 0.f };
+	glm::vec2 uvMax{ 0.f };
+	float advance{ 0.f };
+};
+
+/*
+ * SDFShelfStamp
+ * A shelf of the SDF atlas and its generation at the time a layout took glyphs from it.
+ */
+struct SDFShelfStamp
+{
+	std::uint32_t shelf{ 0 };
+	std::uint32_t generation{ 0 };
+};
+
+/*
+ * SDFFontAtlas
+ * Dynamic atlas of signed distance field glyphs for one font file.
+ * Glyphs are rasterized on demand at a single base size and scaled when drawn, so one atlas serves every font size.
+ * Glyphs are packed into shelves. When the atlas is full, the least recently used shelf is cleared and reused,
+ * which increments the generation of that shelf so that only the layouts holding its old UVs shape again.
+ */
+class SDFFontAtlas
+{
+  public:
+	~SDFFontAtlas();
+
+	/*
+	 * @brief Creates an atlas from the bytes of a ttf font.
+	 * @param Takes in the font data, the atlas keeps its own copy.
+	 * @param Takes in the width and height of the atlas texture.
+	 * @return Returns the atlas if successful, nullptr otherwise.
+	 */
+	static std::shared_ptr<SDFFontAtlas> Create( std::vector<unsigned char> fontData, int width = 1024,
+												 int height = 1024 );
+
+	/*
+	 * @brief Gets the glyph of the codepoint, rasterizing it into the atlas if needed.
+	 * @return Returns the glyph, or nullptr if the font does not have it and has no fallback glyph.
+	 */
+	const SDFGlyph* GetGlyph( std::uint32_t codepoint );
+
+	/*
+	 * @brief Starts recording the shelves of the glyphs that are requested, until EndShaping is called.
+	 * @brief The recorded shelves are pinned, so the glyphs of a layout can not evict each other while it is shaped.
+	 */
+	void BeginShaping();
+
+	/*
+	 * @brief Stops recording the used shelves and unpins them.
+	 * @return Returns the shelves used since BeginShaping, with their generation.
+	 */
+	std::vector<SDFShelfStamp> EndShaping();
+
+	/*
+	 * @brief Checks if any of the shelves have been evicted since the stamps were taken.
+	 * @return Returns true if the glyphs taken from the shelves are no longer valid, false otherwise.
+	 */
+	bool IsStale( const std::vector<SDFShelfStamp>& shelves ) const;
+
+	inline GLuint GetTextureID() const { return m_TextureID; }
+	/* The pixel height that the glyphs are rasterized at. */
+	inline float GetBaseSize() const { return m_BaseSize; }
+	/* Distance from the baseline to highest point in a glyph at the base size. */
+	inline float GetAscent() const { return m_Ascent; }
+	inline std::size_t NumGlyphs() const { return m_mapGlyphs.size(); }
+
+  private:
+	SDFFontAtlas();
+
+	struct Shelf
+	{
+		int y{ 0 };
+		int height{ 0 };
+		int nextX{ 0 };
+		std::vector<std::uint32_t> codepoints{};
+		/* The number of times the shelf has been evicted. */
+		std::uint32_t generation{ 0 };
+		/* Set while the shelf is used by the layout being shaped, pinned shelves are not evicted. */
+		bool bPinned{ false };
+		/* Position in the LRU list, the front is the most recently used. */
+		std::list<std::size_t>::iterator lruItr{};
+	};
+
+	struct GlyphEntry
+	{
+		SDFGlyph glyph{};
+		std::size_t shelfIndex{ 0 };
+	};
+
+	const SDFGlyph* RasterizeGlyph( std::uint32_t codepoint );
+	bool AllocateRect( int width, int height, std::size_t& shelfIndex, int& x, int& y );
+	void TouchShelf( std::size_t shelfIndex );
+	void EvictShelf( std::size_t shelfIndex );
+
+  private:
+	std::vector<unsigned char> m_FontData{};
+	std::unique_ptr<stbtt_fontinfo> m_pFontInfo{ nullptr };
+
+	std::unordered_map<std::uint32_t, GlyphEntry> m_mapGlyphs{};
+	std::vector<Shelf> m_Shelves{};
+	std::list<std::size_t> m_ShelfLRU{};
+
+	GLuint m_TextureID{ 0 };
+	int m_Width{ 0 };
+	int m_Height{ 0 };
+	/* The y position of the next shelf. */
+	int m_NextShelfY{ 0 };
+
+	float m_BaseSize{ 48.f };
+	float m_Scale{ 0.f };
+	float m_Ascent{ 0.f };
+
+	bool m_bShaping{ false };
+	std::vector<SDFShelfStamp> m_ShapingShelves{};
+};
+} // namespace Scion::Rendering
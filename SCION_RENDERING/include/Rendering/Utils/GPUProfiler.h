@@ -0,0 +1,130 @@
+#pragma once
+#include "Rendering/Utils/RenderStats.h"
+#include <glad/glad.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#define SCION_GPU_ZONE_CONCAT_IMPL( a, b ) a##b
+#define SCION_GPU_ZONE_CONCAT( a, b ) SCION_GPU_ZONE_CONCAT_IMPL( a, b )
+
+#ifdef SCION_PROFILER
+/*
+ * @brief Times the GL commands issued in the rest of the enclosing scope on the GPU.
+ * @param Takes the name of the zone. It must be a string literal, or outlive the profiler.
+ */
+#define SCION_GPU_ZONE( name )                                                                                         \
+	Scion::Rendering::GPUZoneScope SCION_GPU_ZONE_CONCAT( gpuZone, __LINE__ ) { name }
+#else
+#define SCION_GPU_ZONE( name )
+#endif
+
+namespace Scion::Rendering
+{
+/*
+ * The number of frames the queries are kept for before they are read back. The GPU is usually a frame or two
+ * behind, so reading the queries of the oldest frame does not stall waiting for the GPU.
+ */
+constexpr std::size_t GPU_PROFILER_FRAMES = 3;
+/* Zones past this count are not timed for the rest of the frame. */
+constexpr std::size_t MAX_GPU_ZONES_PER_FRAME = 128;
+
+/*
+ * GPUProfiler
+ * Times zones on the GPU with GL_TIMESTAMP queries written at the start and end of each zone. Unlike
+ * GL_TIME_ELAPSED queries, timestamps can be nested. Each frame uses its own set of queries, which are read back
+ * GPU_PROFILER_FRAMES frames later and passed to the RenderStats. Until Initialize succeeds, every call is a no-op,
+ * so the profiler costs nothing on the null context or headless runs.
+ */
+class GPUProfiler
+{
+  public:
+	static GPUProfiler& GetInstance();
+
+	~GPUProfiler() = default;
+	GPUProfiler( const GPUProfiler& ) = delete;
+	GPUProfiler& operator=( const GPUProfiler& ) = delete;
+
+	/*
+	 * @brief Creates the queries. Must be called with the GL context current.
+	 * @return Returns false on the null context, or if the context does not support timer queries.
+	 */
+	bool Initialize();
+	/* @brief Deletes the queries. Must be called before the GL context is destroyed. */
+	void Shutdown();
+
+	inline bool IsActive() const { return m_bInitialized && m_bEnabled; }
+	inline bool IsEnabled() const { return m_bEnabled; }
+	inline void SetEnabled( bool bEnabled ) { m_bEnabled = bEnabled; }
+
+	/*
+	 * @brief Writes the start timestamp of a zone.
+	 * @return Returns the zone to pass to EndZone, -1 if the zone is not timed.
+	 */
+	int BeginZone( const char* sName );
+	void EndZone( int zone );
+
+	/*
+	 * @brief Reads back the zones of the oldest frame and starts the next frame.
+	 * Should be called once at the end of every frame, before RenderStats::EndFrame.
+	 */
+	void EndFrame();
+
+	/* @brief Gets the number of frames whose zones were dropped, because the GPU had not finished them yet. */
+	inline std::uint64_t GetNumDroppedFrames() const { return m_NumDroppedFrames; }
+
+  private:
+	struct ZoneQueries
+	{
+		const char* sName{ nullptr };
+		bool bEnded{ false };
+	};
+
+	struct FrameQueries
+	{
+		/* The start and end timestamp queries of zone i are at 2 * i and 2 * i + 1. */
+		std::array<GLuint, MAX_GPU_ZONES_PER_FRAME * 2> queries{};
+		std::vector<ZoneQueries> zones{};
+		/* The last query that was written. Once it is available, the rest of the frame is as well. */
+		GLuint lastQuery{ 0 };
+	};
+
+	GPUProfiler();
+	void ResolveFrame( FrameQueries& frame );
+
+  private:
+	bool m_bInitialized;
+	bool m_bEnabled;
+	std::array<FrameQueries, GPU_PROFILER_FRAMES> m_Frames;
+	std::size_t m_FrameIndex;
+	std::uint64_t m_NumDroppedFrames;
+	double m_GPUMs;
+	std::vector<GPUZoneTime> m_Zones;
+};
+
+/*
+ * GPUZoneScope
+ * Times a GPU zone from its construction to its destruction. Use the SCION_GPU_ZONE macro instead,
+ * so the zone compiles out when the profiler is disabled.
+ */
+class GPUZoneScope
+{
+  public:
+	explicit GPUZoneScope( const char* sName )
+		: m_Zone{ GPUProfiler::GetInstance().BeginZone( sName ) }
+	{
+	}
+
+	~GPUZoneScope()
+	{
+		if ( m_Zone >= 0 )
+			GPUProfiler::GetInstance().EndZone( m_Zone );
+	}
+
+	GPUZoneScope( const GPUZoneScope& ) = delete;
+	GPUZoneScope& operator=( const GPUZoneScope& ) = delete;
+
+  private:
+	int m_Zone;
+};
+} // namespace Scion::Rendering
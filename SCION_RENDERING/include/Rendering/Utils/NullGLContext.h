@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+
+namespace Scion::Rendering
+{
+/*
+ * NullGLStats
+ * The work that would have been sent to the GPU while the null context is loaded.
+ */
+struct NullGLStats
+{
+	/* Number of glDraw* calls issued. */
+	std::uint64_t drawCalls{ 0 };
+	/* Number of vertices/indices referenced by the draw calls. */
+	std::uint64_t verticesDrawn{ 0 };
+	/* Number of glBufferData/glBufferSubData calls that uploaded data. */
+	std::uint64_t bufferUploads{ 0 };
+	/* Total bytes uploaded to vertex/index buffers. */
+	std::uint64_t bufferBytesUploaded{ 0 };
+	/* The largest single buffer allocation requested. */
+	std::uint64_t largestBufferSize{ 0 };
+	/* Number of glTexImage2D calls. */
+	std::uint64_t textureUploads{ 0 };
+	/* Approximate bytes uploaded to textures, assumes 4 bytes per pixel. */
+	std::uint64_t textureBytesUploaded{ 0 };
+};
+
+/*
+ * NullGLContext
+ * Loads glad with stub functions instead of a real OpenGL driver. Every GL call made by the engine
+ * becomes a no-op, except for the calls that need to return valid object ids/statuses and the draw and
+ * upload calls, which are recorded in the NullGLStats. This allows the engine to run without a window or GPU.
+ *
+ * Note: Functions that are not explicitly stubbed are routed to a single no-op function. This relies on the
+ * caller cleaning up the arguments, which holds true for the x64 calling conventions we build for. Functions that
+ * return a value or fill out-params must have a typed stub, the callers would read garbage otherwise.
+ */
+class NullGLContext final
+{
+  public:
+	/*
+	 * @brief Loads all of the glad function pointers with the null implementations.
+	 * @return Returns true if glad was successfully loaded, false otherwise.
+	 */
+	static bool Load();
+
+	static inline bool IsLoaded() { return s_bLoaded; }
+
+	/*
+	 * @brief Gets the stats that have been recorded since the last reset.
+	 */
+	static const NullGLStats& GetStats();
+	static void ResetStats();
+
+  private:
+	static void* GetProcAddress( const char* sProcName );
+
+	NullGLContext() = delete;
+	~NullGLContext() = delete;
+
+  private:
+	static inline bool s_bLoaded{ false };
+};
+} // namespace Scion::Rendering
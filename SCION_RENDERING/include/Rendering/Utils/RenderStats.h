@@ -0,0 +1,91 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Scion::Rendering
+{
+/* The GPU time of the zones with the same name, measured with timer queries. */
+struct GPUZoneTime
+{
+	const char* sName{ nullptr };
+	double ms{ 0.0 };
+	std::uint32_t numCalls{ 0 };
+};
+
+/*
+ * RenderFrameStats
+ * The work the batch renderers sent to the GPU during a frame.
+ */
+struct RenderFrameStats
+{
+	/* Number of glDraw* calls issued. Every batch is drawn with a single call. */
+	std::uint32_t drawCalls{ 0 };
+	/* Number of vertices/indices referenced by the draw calls. */
+	std::uint64_t verticesDrawn{ 0 };
+	/* Number of times a batcher uploaded its vertices. */
+	std::uint32_t vertexUploads{ 0 };
+	std::uint64_t verticesUploaded{ 0 };
+	std::uint64_t bytesUploaded{ 0 };
+	/* The time from the first to the last GPU zone, 0 if the GPU profiler is not running. */
+	double gpuMs{ 0.0 };
+	/*
+	 * The GPU zones arrive a few frames late, since the profiler does not wait for the GPU.
+	 * See GPU_PROFILER_FRAMES in the GPUProfiler.
+	 */
+	std::vector<GPUZoneTime> gpuZones{};
+};
+
+/*
+ * RenderStats
+ * Counts the draw calls and vertex uploads of the batch renderers. Unlike the NullGLStats, these are
+ * counted with a real context as well. The counters are only touched by the render thread.
+ */
+class RenderStats final
+{
+  public:
+	static inline void AddDrawCall( std::uint64_t numVertices )
+	{
+		++s_CurrentFrame.drawCalls;
+		s_CurrentFrame.verticesDrawn += numVertices;
+	}
+
+	static inline void AddVertexUpload( std::uint64_t numVertices, std::uint64_t numBytes )
+	{
+		++s_CurrentFrame.vertexUploads;
+		s_CurrentFrame.verticesUploaded += numVertices;
+		s_CurrentFrame.bytesUploaded += numBytes;
+	}
+
+	static inline void SetGPUZones( double gpuMs, const std::vector<GPUZoneTime>& gpuZones )
+	{
+		s_CurrentFrame.gpuMs = gpuMs;
+		s_CurrentFrame.gpuZones = gpuZones;
+	}
+
+	/*
+	 * @brief Keeps the counts of the frame that just ended and starts counting the next frame.
+	 * Should be called once at the end of every frame.
+	 */
+	static inline void EndFrame()
+	{
+		std::swap( s_LastFrame, s_CurrentFrame );
+
+		// Keep the memory of the zones, so the next frame does not have to allocate it again.
+		auto gpuZones = std::move( s_CurrentFrame.gpuZones );
+		gpuZones.clear();
+		s_CurrentFrame = RenderFrameStats{ .gpuZones = std::move( gpuZones ) };
+	}
+
+	/* @brief Gets the counts of the last finished frame. */
+	static inline const RenderFrameStats& GetLastFrame() { return s_LastFrame; }
+
+  private:
+	RenderStats() = delete;
+	~RenderStats() = delete;
+
+  private:
+	static inline RenderFrameStats s_CurrentFrame{};
+	static inline RenderFrameStats s_LastFrame{};
+};
+} // namespace Scion::Rendering
@@ -1,4 +1,6 @@
 #include "Rendering/Core/BatchRenderer.h"
+#include "Rendering/Utils/GPUProfiler.h"
+#include "Rendering/Utils/RenderStats.h"
 #include <algorithm>
 
 namespace Scion::Rendering
@@ -57,6 +59,7 @@ void SpriteBatchRenderer::GenerateBatches()
 
 		glBufferData( GL_ARRAY_BUFFER, vertices.size() * sizeof( Vertex ), nullptr, GL_DYNAMIC_DRAW );
 		glBufferSubData( GL_ARRAY_BUFFER, 0, vertices.size() * sizeof( Vertex ), vertices.data() );
+		RenderStats::AddVertexUpload( vertices.size(), vertices.size() * sizeof( Vertex ) );
 
 		glBindBuffer( GL_ARRAY_BUFFER, 0 );
 	}
@@ -93,12 +96,15 @@ void SpriteBatchRenderer::Render()
 	if ( m_Batches.empty() )
 		return;
 
+	SCION_GPU_ZONE( "SpriteBatchRenderer::Render" );
+
 	EnableVAO();
 
 	for ( const auto& batch : m_Batches )
 	{
 		glBindTextureUnit( 0, batch->textureID );
 		glDrawElements( GL_TRIANGLES, batch->numIndices, GL_UNSIGNED_INT, (void*)( sizeof( GLuint ) * batch->offset ) );
+		RenderStats::AddDrawCall( batch->numIndices );
 	}
 
 	DisableVAO();
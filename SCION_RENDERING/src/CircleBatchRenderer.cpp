@@ -1,4 +1,6 @@
 #include "Rendering/Core/CircleBatchRenderer.h"
+#include "Rendering/Utils/GPUProfiler.h"
+#include "Rendering/Utils/RenderStats.h"
 #include "Rendering/Essentials/Primitives.h"
 
 namespace Scion::Rendering
@@ -42,6 +44,7 @@ void CircleBatchRenderer::GenerateBatches()
 		glBufferData( GL_ARRAY_BUFFER, vertices.size() * sizeof( CircleVertex ), nullptr, GL_DYNAMIC_DRAW );
 
 		glBufferSubData( GL_ARRAY_BUFFER, 0, vertices.size() * sizeof( CircleVertex ), vertices.data() );
+		RenderStats::AddVertexUpload( vertices.size(), vertices.size() * sizeof( CircleVertex ) );
 
 		glBindBuffer( GL_ARRAY_BUFFER, 0 );
 	}
@@ -151,11 +154,14 @@ void CircleBatchRenderer::Render()
 	if ( m_Batches.empty() )
 		return;
 
+	SCION_GPU_ZONE( "CircleBatchRenderer::Render" );
+
 	EnableVAO();
 
 	for ( const auto& batch : m_Batches )
 	{
 		glDrawElements( GL_TRIANGLES, batch->numIndices, GL_UNSIGNED_INT, (void*)( sizeof( GLuint ) * batch->offset ) );
+		RenderStats::AddDrawCall( batch->numIndices );
 	}
 
 	DisableVAO();
@@ -1,4 +1,5 @@
 #include "Rendering/Essentials/Font.h"
+#include "Rendering/Essentials/SDFFontAtlas.h"
 #include <stb_truetype.h>
 #include <iostream>
 
@@ -38,9 +39,43 @@ Font::Font( GLuint fontAtlasID, int width, int height, float fontSize, void* dat
 	m_AveragePadding.paddingY = std::floor( paddingY / m_mapPaddingInfo.size() );
 }
 
+Font::Font( std::shared_ptr<SDFFontAtlas> pSDFAtlas, float fontSize, const std::string& sFilename )
+	: m_FontAtlasID{ pSDFAtlas->GetTextureID() }
+	, m_Width{ 0 }
+	, m_Height{ 0 }
+	, m_FontSize{ fontSize }
+	, m_FontAscent{ pSDFAtlas->GetAscent() * fontSize / pSDFAtlas->GetBaseSize() }
+	, m_pData{ nullptr }
+	, m_sFilename{ sFilename }
+	, m_pSDFAtlas{ std::move( pSDFAtlas ) }
+{
+	const float scale = m_FontSize / m_pSDFAtlas->GetBaseSize();
+
+	// This also rasterizes the ASCII glyphs up front.
+	for ( int i = 32; i < 128; i++ )
+	{
+		const auto* pGlyph = m_pSDFAtlas->GetGlyph( static_cast<std::uint32_t>( i ) );
+		const glm::vec2 size = pGlyph ? pGlyph->size * scale : glm::vec2{ 0.f };
+
+		m_mapPaddingInfo.emplace( static_cast<char>( i ),
+								  PaddingInfo{ .paddingX = m_FontSize - size.x, .paddingY = m_FontSize - size.y } );
+	}
+
+	float paddingX{ 0.f }, paddingY{ 0.f };
+	for ( const auto& [ c, paddingInfo ] : m_mapPaddingInfo )
+	{
+		paddingX += paddingInfo.paddingX;
+		paddingY += paddingInfo.paddingY;
+	}
+
+	m_AveragePadding.paddingX = std::floor( paddingX / m_mapPaddingInfo.size() );
+	m_AveragePadding.paddingY = std::floor( paddingY / m_mapPaddingInfo.size() );
+}
+
 Font::~Font()
 {
-	if ( m_FontAtlasID != 0 )
+	// The SDF atlas owns its texture
+	if ( m_FontAtlasID != 0 && !m_pSDFAtlas )
 		glDeleteTextures( 1, &m_FontAtlasID );
 
 	if ( m_pData )
@@ -52,6 +87,9 @@ Font::~Font()
 
 FontGlyph Font::GetGlyph( char c, glm::vec2& pos )
 {
+	if ( m_pSDFAtlas )
+		return GetCodepointGlyph( static_cast<unsigned char>( c ), pos );
+
 	FontGlyph glyph{};
 	float y = pos.y + m_FontAscent;
 
@@ -68,8 +106,59 @@ FontGlyph Font::GetGlyph( char c, glm::vec2& pos )
 	return glyph;
 }
 
+FontGlyph Font::GetCodepointGlyph( std::uint32_t codepoint, glm::vec2& pos )
+{
+	if ( !m_pSDFAtlas )
+		return codepoint < 128 ? GetGlyph( static_cast<char>( codepoint ), pos ) : FontGlyph{};
+
+	const auto* pGlyph = m_pSDFAtlas->GetGlyph( codepoint );
+	if ( !pGlyph )
+		return FontGlyph{};
+
+	const float scale = m_FontSize / m_pSDFAtlas->GetBaseSize();
+	const glm::vec2 min = glm::vec2{ pos.x, pos.y + m_FontAscent } + pGlyph->offset * scale;
+	const glm::vec2 max = min + pGlyph->size * scale;
+	pos.x += pGlyph->advance * scale;
+
+	return FontGlyph{ .min = Vertex{ .position = min, .uvs = pGlyph->uvMin },
+					  .max = Vertex{ .position = max, .uvs = pGlyph->uvMax } };
+}
+
+void Font::BeginShaping()
+{
+	if ( m_pSDFAtlas )
+		m_pSDFAtlas->BeginShaping();
+}
+
+std::vector<SDFShelfStamp> Font::EndShaping()
+{
+	return m_pSDFAtlas ? m_pSDFAtlas->EndShaping() : std::vector<SDFShelfStamp>{};
+}
+
+bool Font::IsAtlasStale( const std::vector<SDFShelfStamp>& shelves ) const
+{
+	return m_pSDFAtlas && m_pSDFAtlas->IsStale( shelves );
+}
+
 void Font::GetNextCharPos( char c, glm::vec2& pos )
 {
+	if ( m_pSDFAtlas )
+	{
+		const auto byte = static_cast<unsigned char>( c );
+		if ( byte < 0x80 )
+		{
+			if ( const auto* pGlyph = m_pSDFAtlas->GetGlyph( byte ) )
+				pos.x += pGlyph->advance * m_FontSize / m_pSDFAtlas->GetBaseSize();
+		}
+		// Only the lead byte of a UTF-8 sequence moves the position, estimated as half of the font size.
+		else if ( ( byte & 0xC0 ) == 0xC0 )
+		{
+			pos.x += m_FontSize * 0.5f;
+		}
+
+		return;
+	}
+
 	if ( c >= 32 && c < 128 )
 	{
 		stbtt_aligned_quad quad;
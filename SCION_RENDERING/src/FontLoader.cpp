@@ -1,5 +1,6 @@
 #include "Rendering/Essentials/FontLoader.h"
 #include "Rendering/Essentials/Font.h"
+#include "Rendering/Essentials/SDFFontAtlas.h"
 #include <fstream>
 #include <vector>
 #include <Logger/Logger.h>
@@ -68,6 +69,27 @@ std::shared_ptr<Font> FontLoader::Create( const std::string& fontPath, float fon
 	return std::make_shared<Font>( fontId, width, height, fontSize, data, fontAscent, fontPath );
 }
 
+std::shared_ptr<SDFFontAtlas> FontLoader::CreateSDFAtlas( const std::string& fontPath, int width, int height )
+{
+	std::ifstream fontStream{ fontPath, std::ios::binary };
+
+	if ( fontStream.fail() )
+	{
+		SCION_ERROR( "Failed to load SDF font [{}] - Unable to read buffer!", fontPath );
+		return nullptr;
+	}
+
+	fontStream.seekg( 0, fontStream.end );
+	int64_t length = fontStream.tellg();
+	fontStream.seekg( 0, fontStream.beg );
+
+	std::vector<unsigned char> buffer;
+	buffer.resize( length );
+	fontStream.read( (char*)( &buffer[ 0 ] ), length );
+
+	return SDFFontAtlas::Create( std::move( buffer ), width, height );
+}
+
 std::shared_ptr<Font> FontLoader::CreateFromMemory( const unsigned char* fontData, float fontSize, int width,
 													int height )
 {
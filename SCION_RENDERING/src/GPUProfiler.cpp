@@ -0,0 +1,179 @@
+#include "Rendering/Utils/GPUProfiler.h"
+#include "Rendering/Utils/NullGLContext.h"
+#include <Logger/Logger.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace Scion::Rendering
+{
+GPUProfiler& GPUProfiler::GetInstance()
+{
+	static GPUProfiler instance{};
+	return instance;
+}
+
+GPUProfiler::GPUProfiler()
+	: m_bInitialized{ false }
+#ifdef SCION_PROFILER
+	, m_bEnabled{ true }
+#else
+	, m_bEnabled{ false }
+#endif
+	, m_Frames{}
+	, m_FrameIndex{ 0 }
+	, m_NumDroppedFrames{ 0 }
+	, m_GPUMs{ 0.0 }
+	, m_Zones{}
+{
+}
+
+bool GPUProfiler::Initialize()
+{
+	if ( m_bInitialized )
+		return true;
+
+	// The null context has no GPU to time.
+	if ( NullGLContext::IsLoaded() )
+		return false;
+
+	if ( !GLAD_GL_VERSION_3_3 && !GLAD_GL_ARB_timer_query )
+	{
+		SCION_WARN( "Timer queries are not supported. GPU zones will not be timed." );
+		return false;
+	}
+
+	GLint timestampBits{ 0 };
+	glGetQueryiv( GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &timestampBits );
+	if ( timestampBits == 0 )
+	{
+		SCION_WARN( "The GPU does not support timestamp queries. GPU zones will not be timed." );
+		return false;
+	}
+
+	for ( auto& frame : m_Frames )
+	{
+		glGenQueries( static_cast<GLsizei>( frame.queries.size() ), frame.queries.data() );
+		frame.zones.reserve( MAX_GPU_ZONES_PER_FRAME );
+	}
+
+	m_Zones.reserve( MAX_GPU_ZONES_PER_FRAME );
+	m_bInitialized = true;
+	return true;
+}
+
+void GPUProfiler::Shutdown()
+{
+	if ( !m_bInitialized )
+		return;
+
+	for ( auto& frame : m_Frames )
+	{
+		glDeleteQueries( static_cast<GLsizei>( frame.queries.size() ), frame.queries.data() );
+		frame.zones.clear();
+		frame.lastQuery = 0;
+	}
+
+	m_bInitialized = false;
+}
+
+int GPUProfiler::BeginZone( const char* sName )
+{
+	if ( !IsActive() )
+		return -1;
+
+	auto& frame = m_Frames[ m_FrameIndex ];
+	if ( frame.zones.size() == MAX_GPU_ZONES_PER_FRAME )
+		return -1;
+
+	const int zone = static_cast<int>( frame.zones.size() );
+	frame.zones.push_back( ZoneQueries{ .sName = sName } );
+
+	frame.lastQuery = frame.queries[ zone * 2 ];
+	glQueryCounter( frame.lastQuery, GL_TIMESTAMP );
+	return zone;
+}
+
+void GPUProfiler::EndZone( int zone )
+{
+	auto& frame = m_Frames[ m_FrameIndex ];
+	if ( !m_bInitialized || zone < 0 || zone >= static_cast<int>( frame.zones.size() ) )
+		return;
+
+	frame.zones[ zone ].bEnded = true;
+	frame.lastQuery = frame.queries[ zone * 2 + 1 ];
+	glQueryCounter( frame.lastQuery, GL_TIMESTAMP );
+}
+
+void GPUProfiler::EndFrame()
+{
+	if ( !m_bInitialized )
+		return;
+
+	// The next frame writes over the queries of the oldest frame, so read them back first.
+	m_FrameIndex = ( m_FrameIndex + 1 ) % GPU_PROFILER_FRAMES;
+	ResolveFrame( m_Frames[ m_FrameIndex ] );
+
+	RenderStats::SetGPUZones( m_GPUMs, m_Zones );
+}
+
+void GPUProfiler::ResolveFrame( FrameQueries& frame )
+{
+	m_GPUMs = 0.0;
+	m_Zones.clear();
+
+	if ( frame.zones.empty() )
+		return;
+
+	// Timestamps are written in order, so once the last one is available, every query of the frame is.
+	GLint bAvailable{ 0 };
+	glGetQueryObjectiv( frame.lastQuery, GL_QUERY_RESULT_AVAILABLE, &bAvailable );
+
+	if ( !bAvailable )
+	{
+		// Waiting for the results would stall the CPU until the GPU catches up, drop them instead.
+		++m_NumDroppedFrames;
+		frame.zones.clear();
+		return;
+	}
+
+	GLuint64 frameStart{ std::numeric_limits<GLuint64>::max() }, frameEnd{ 0 };
+
+	for ( std::size_t i = 0; i < frame.zones.size(); ++i )
+	{
+		const auto& zone = frame.zones[ i ];
+		if ( !zone.bEnded )
+			continue;
+
+		GLuint64 start{ 0 }, end{ 0 };
+		glGetQueryObjectui64v( frame.queries[ i * 2 ], GL_QUERY_RESULT, &start );
+		glGetQueryObjectui64v( frame.queries[ i * 2 + 1 ], GL_QUERY_RESULT, &end );
+
+		frameStart = std::min( frameStart, start );
+		frameEnd = std::max( frameEnd, end );
+
+		const double zoneMs = ( end - start ) / 1'000'000.0;
+
+		auto itZone = std::find_if( m_Zones.begin(), m_Zones.end(), [ &zone ]( const GPUZoneTime& zoneTime ) {
+			return zoneTime.sName == zone.sName || std::strcmp( zoneTime.sName, zone.sName ) == 0;
+		} );
+
+		if ( itZone == m_Zones.end() )
+		{
+			m_Zones.push_back( GPUZoneTime{ .sName = zone.sName, .ms = zoneMs, .numCalls = 1 } );
+		}
+		else
+		{
+			itZone->ms += zoneMs;
+			++itZone->numCalls;
+		}
+	}
+
+	if ( frameEnd > frameStart )
+		m_GPUMs = ( frameEnd - frameStart ) / 1'000'000.0;
+
+	frame.zones.clear();
+}
+
+} // namespace Scion::Rendering
@@ -1,4 +1,6 @@
 #include "Rendering/Core/LineBatchRenderer.h"
+#include "Rendering/Utils/GPUProfiler.h"
+#include "Rendering/Utils/RenderStats.h"
 
 namespace Scion::Rendering
 {
@@ -28,6 +30,7 @@ void LineBatchRenderer::GenerateBatches()
 
 	glBufferData( GL_ARRAY_BUFFER, vertices.size() * sizeof( Vertex ), nullptr, GL_DYNAMIC_DRAW );
 	glBufferSubData( GL_ARRAY_BUFFER, 0, vertices.size() * sizeof( Vertex ), vertices.data() );
+	RenderStats::AddVertexUpload( vertices.size(), vertices.size() * sizeof( Vertex ) );
 
 	glBindBuffer( GL_ARRAY_BUFFER, 0 );
 }
@@ -54,11 +57,17 @@ void LineBatchRenderer::End()
 
 void LineBatchRenderer::Render()
 {
+	if ( m_Batches.empty() )
+		return;
+
+	SCION_GPU_ZONE( "LineBatchRenderer::Render" );
+
 	glEnable( GL_LINE_SMOOTH );
 	EnableVAO();
 	for ( const auto& batch : m_Batches )
 	{
 		glDrawArrays( GL_LINES, 0, batch->numVertices );
+		RenderStats::AddDrawCall( batch->numVertices );
 	}
 	DisableVAO();
 	glDisable( GL_LINE_SMOOTH );
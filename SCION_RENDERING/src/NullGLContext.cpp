@@ -0,0 +1,460 @@
+#include "Rendering/Utils/NullGLContext.h"
+#include <glad/glad.h>
+#include <Logger/Logger.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Scion::Rendering
+{
+namespace
+{
+NullGLStats s_Stats{};
+GLuint s_NextObjectID{ 1 };
+std::unordered_set<GLenum> s_EnabledCaps{};
+
+/* Everything that is not explicitly stubbed below ends up here. Only void functions may be left to it. */
+void APIENTRY NullNoOp()
+{
+}
+
+/* Value returning functions that have nothing to report return an empty value, 0, GL_FALSE or nullptr. */
+template <typename TReturn, typename... TArgs>
+TReturn APIENTRY NullReturnZero( TArgs... )
+{
+	return TReturn{};
+}
+
+/* @brief Gets the number of values a glGet* query writes, so every one of them is cleared. */
+int NumQueryValues( GLenum pname )
+{
+	switch ( pname )
+	{
+	case GL_VIEWPORT:
+	case GL_SCISSOR_BOX:
+	case GL_COLOR_CLEAR_VALUE:
+	case GL_COLOR_WRITEMASK:
+	case GL_BLEND_COLOR: return 4;
+	case GL_POLYGON_MODE:
+	case GL_DEPTH_RANGE:
+	case GL_MAX_VIEWPORT_DIMS:
+	case GL_ALIASED_LINE_WIDTH_RANGE:
+	case GL_SMOOTH_LINE_WIDTH_RANGE: return 2;
+	default: return 1;
+	}
+}
+
+template <typename TValue>
+void APIENTRY NullGetv( GLenum pname, TValue* data )
+{
+	if ( data )
+		std::fill_n( data, NumQueryValues( pname ), TValue{} );
+}
+
+/* glGetQueryiv, glGetTexParameteriv, glGetBufferParameteriv and the other target and pname queries. */
+template <typename TValue>
+void APIENTRY NullGetParameterv( GLenum, GLenum, TValue* params )
+{
+	if ( params )
+		*params = TValue{};
+}
+
+/* glGetVertexAttribiv, glGetTextureParameteriv and the other object and pname queries. */
+template <typename TValue>
+void APIENTRY NullGetObjectParameterv( GLuint, GLenum, TValue* params )
+{
+	if ( params )
+		*params = TValue{};
+}
+
+void APIENTRY NullGetTexLevelParameteriv( GLenum, GLint, GLenum, GLint* params )
+{
+	if ( params )
+		*params = 0;
+}
+
+void APIENTRY NullGetTextureLevelParameteriv( GLuint, GLint, GLenum, GLint* params )
+{
+	if ( params )
+		*params = 0;
+}
+
+void APIENTRY NullGetFramebufferAttachmentParameteriv( GLenum, GLenum, GLenum, GLint* params )
+{
+	if ( params )
+		*params = 0;
+}
+
+void APIENTRY NullGetBufferSubData( GLenum, GLintptr, GLsizeiptr size, void* data )
+{
+	if ( data && size > 0 )
+		std::memset( data, 0, static_cast<std::size_t>( size ) );
+}
+
+void APIENTRY NullGetNamedBufferSubData( GLuint, GLintptr, GLsizeiptr size, void* data )
+{
+	if ( data && size > 0 )
+		std::memset( data, 0, static_cast<std::size_t>( size ) );
+}
+
+GLint APIENTRY NullGetLocation( GLuint, const GLchar* )
+{
+	return -1;
+}
+
+GLuint APIENTRY NullGetUniformBlockIndex( GLuint, const GLchar* )
+{
+	return GL_INVALID_INDEX;
+}
+
+GLboolean APIENTRY NullIsObject( GLuint id )
+{
+	return id != 0 ? GL_TRUE : GL_FALSE;
+}
+
+/* Nothing is ever mapped, so nothing can have been corrupted while it was. */
+GLboolean APIENTRY NullUnmapBuffer( GLenum )
+{
+	return GL_TRUE;
+}
+
+GLboolean APIENTRY NullUnmapNamedBuffer( GLuint )
+{
+	return GL_TRUE;
+}
+
+const GLubyte* APIENTRY NullGetString( GLenum name )
+{
+	switch ( name )
+	{
+	case GL_VENDOR: return reinterpret_cast<const GLubyte*>( "Scion2D" );
+	case GL_RENDERER: return reinterpret_cast<const GLubyte*>( "Scion2D Null Renderer" );
+	case GL_VERSION: return reinterpret_cast<const GLubyte*>( "4.5.0 Scion2D Null" );
+	case GL_SHADING_LANGUAGE_VERSION: return reinterpret_cast<const GLubyte*>( "4.50" );
+	default: return reinterpret_cast<const GLubyte*>( "" );
+	}
+}
+
+const GLubyte* APIENTRY NullGetStringi( GLenum, GLuint )
+{
+	return reinterpret_cast<const GLubyte*>( "" );
+}
+
+void APIENTRY NullGetIntegerv( GLenum pname, GLint* data )
+{
+	if ( !data )
+		return;
+
+	switch ( pname )
+	{
+	case GL_MAJOR_VERSION: *data = 4; break;
+	case GL_MINOR_VERSION: *data = 5; break;
+	default: std::fill_n( data, NumQueryValues( pname ), 0 ); break;
+	}
+}
+
+GLenum APIENTRY NullGetError()
+{
+	return GL_NO_ERROR;
+}
+
+void APIENTRY NullGenObjects( GLsizei n, GLuint* ids )
+{
+	for ( GLsizei i = 0; i < n; ++i )
+		ids[ i ] = s_NextObjectID++;
+}
+
+/* glCreateTextures and glCreateQueries take the target before the count. */
+void APIENTRY NullCreateTargetObjects( GLenum, GLsizei n, GLuint* ids )
+{
+	NullGenObjects( n, ids );
+}
+
+GLuint APIENTRY NullCreateShader( GLenum )
+{
+	return s_NextObjectID++;
+}
+
+GLuint APIENTRY NullCreateProgram()
+{
+	return s_NextObjectID++;
+}
+
+void APIENTRY NullGetObjectiv( GLuint, GLenum pname, GLint* params )
+{
+	if ( !params )
+		return;
+
+	switch ( pname )
+	{
+	case GL_COMPILE_STATUS:
+	case GL_LINK_STATUS:
+	case GL_VALIDATE_STATUS: *params = GL_TRUE; break;
+	default: *params = 0; break;
+	}
+}
+
+void APIENTRY NullGetInfoLog( GLuint, GLsizei bufSize, GLsizei* length, GLchar* infoLog )
+{
+	if ( length )
+		*length = 0;
+	if ( infoLog && bufSize > 0 )
+		infoLog[ 0 ] = '\0';
+}
+
+GLint APIENTRY NullGetUniformLocation( GLuint, const GLchar* )
+{
+	return 0;
+}
+
+GLenum APIENTRY NullCheckFramebufferStatus( GLenum )
+{
+	return GL_FRAMEBUFFER_COMPLETE;
+}
+
+GLenum APIENTRY NullCheckNamedFramebufferStatus( GLuint, GLenum )
+{
+	return GL_FRAMEBUFFER_COMPLETE;
+}
+
+void APIENTRY NullEnable( GLenum cap )
+{
+	s_EnabledCaps.insert( cap );
+}
+
+void APIENTRY NullDisable( GLenum cap )
+{
+	s_EnabledCaps.erase( cap );
+}
+
+GLboolean APIENTRY NullIsEnabled( GLenum cap )
+{
+	return s_EnabledCaps.contains( cap ) ? GL_TRUE : GL_FALSE;
+}
+
+void APIENTRY NullDrawArrays( GLenum, GLint, GLsizei count )
+{
+	++s_Stats.drawCalls;
+	s_Stats.verticesDrawn += count;
+}
+
+void APIENTRY NullDrawElements( GLenum, GLsizei count, GLenum, const void* )
+{
+	++s_Stats.drawCalls;
+	s_Stats.verticesDrawn += count;
+}
+
+void APIENTRY NullDrawArraysInstanced( GLenum, GLint, GLsizei count, GLsizei instanceCount )
+{
+	++s_Stats.drawCalls;
+	s_Stats.verticesDrawn += static_cast<std::uint64_t>( count ) * instanceCount;
+}
+
+void APIENTRY NullDrawElementsInstanced( GLenum, GLsizei count, GLenum, const void*, GLsizei instanceCount )
+{
+	++s_Stats.drawCalls;
+	s_Stats.verticesDrawn += static_cast<std::uint64_t>( count ) * instanceCount;
+}
+
+void APIENTRY NullBufferData( GLenum, GLsizeiptr size, const void* data, GLenum )
+{
+	s_Stats.largestBufferSize = std::max( s_Stats.largestBufferSize, static_cast<std::uint64_t>( size ) );
+
+	// Orphaning the buffer with a nullptr does not upload anything
+	if ( !data )
+		return;
+
+	++s_Stats.bufferUploads;
+	s_Stats.bufferBytesUploaded += size;
+}
+
+void APIENTRY NullBufferSubData( GLenum, GLintptr, GLsizeiptr size, const void* )
+{
+	++s_Stats.bufferUploads;
+	s_Stats.bufferBytesUploaded += size;
+}
+
+void APIENTRY NullTexImage2D( GLenum, GLint, GLint, GLsizei width, GLsizei height, GLint, GLenum, GLenum,
+							  const void* )
+{
+	++s_Stats.textureUploads;
+	s_Stats.textureBytesUploaded += static_cast<std::uint64_t>( width ) * height * 4;
+}
+
+template <typename TValue>
+void APIENTRY NullGetQueryObjectv( GLuint, GLenum pname, TValue* params )
+{
+	if ( params )
+		*params = pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0;
+}
+
+GLsync APIENTRY NullFenceSync( GLenum, GLbitfield )
+{
+	return reinterpret_cast<GLsync>( static_cast<std::uintptr_t>( s_NextObjectID++ ) );
+}
+
+GLenum APIENTRY NullClientWaitSync( GLsync, GLbitfield, GLuint64 )
+{
+	return GL_ALREADY_SIGNALED;
+}
+
+void APIENTRY NullGetSynciv( GLsync, GLenum pname, GLsizei bufSize, GLsizei* length, GLint* values )
+{
+	if ( length )
+		*length = bufSize > 0 ? 1 : 0;
+
+	if ( values && bufSize > 0 )
+		*values = pname == GL_SYNC_STATUS ? GL_SIGNALED : 0;
+}
+
+template <typename TFunc>
+void* ToProc( TFunc func )
+{
+	return reinterpret_cast<void*>( func );
+}
+
+// clang-format off
+const std::unordered_map<std::string_view, void*>& GetNullProcs()
+{
+	static const std::unordered_map<std::string_view, void*> s_mapNullProcs{
+		{ "glGetString",				ToProc( &NullGetString ) },
+		{ "glGetStringi",				ToProc( &NullGetStringi ) },
+		{ "glGetIntegerv",				ToProc( &NullGetIntegerv ) },
+		{ "glGetError",					ToProc( &NullGetError ) },
+		{ "glGenBuffers",				ToProc( &NullGenObjects ) },
+		{ "glGenVertexArrays",			ToProc( &NullGenObjects ) },
+		{ "glGenTextures",				ToProc( &NullGenObjects ) },
+		{ "glGenFramebuffers",			ToProc( &NullGenObjects ) },
+		{ "glGenRenderbuffers",			ToProc( &NullGenObjects ) },
+		{ "glGenQueries",				ToProc( &NullGenObjects ) },
+		{ "glCreateBuffers",			ToProc( &NullGenObjects ) },
+		{ "glCreateVertexArrays",		ToProc( &NullGenObjects ) },
+		{ "glCreateFramebuffers",		ToProc( &NullGenObjects ) },
+		{ "glCreateRenderbuffers",		ToProc( &NullGenObjects ) },
+		{ "glCreateShader",				ToProc( &NullCreateShader ) },
+		{ "glCreateProgram",			ToProc( &NullCreateProgram ) },
+		{ "glGetShaderiv",				ToProc( &NullGetObjectiv ) },
+		{ "glGetProgramiv",				ToProc( &NullGetObjectiv ) },
+		{ "glGetShaderInfoLog",			ToProc( &NullGetInfoLog ) },
+		{ "glGetProgramInfoLog",		ToProc( &NullGetInfoLog ) },
+		{ "glGetUniformLocation",		ToProc( &NullGetUniformLocation ) },
+		{ "glCheckFramebufferStatus",	ToProc( &NullCheckFramebufferStatus ) },
+		{ "glEnable",					ToProc( &NullEnable ) },
+		{ "glDisable",					ToProc( &NullDisable ) },
+		{ "glIsEnabled",				ToProc( &NullIsEnabled ) },
+		{ "glDrawArrays",				ToProc( &NullDrawArrays ) },
+		{ "glDrawElements",				ToProc( &NullDrawElements ) },
+		{ "glDrawArraysInstanced",		ToProc( &NullDrawArraysInstanced ) },
+		{ "glDrawElementsInstanced",	ToProc( &NullDrawElementsInstanced ) },
+		{ "glBufferData",				ToProc( &NullBufferData ) },
+		{ "glBufferSubData",			ToProc( &NullBufferSubData ) },
+		{ "glTexImage2D",				ToProc( &NullTexImage2D ) },
+		{ "glGetQueryObjectui64v",		ToProc( &NullGetQueryObjectv<GLuint64> ) },
+		{ "glGetQueryObjecti64v",		ToProc( &NullGetQueryObjectv<GLint64> ) },
+		{ "glGetQueryObjectuiv",		ToProc( &NullGetQueryObjectv<GLuint> ) },
+		{ "glGetQueryObjectiv",			ToProc( &NullGetQueryObjectv<GLint> ) },
+		{ "glFenceSync",				ToProc( &NullFenceSync ) },
+		{ "glClientWaitSync",			ToProc( &NullClientWaitSync ) },
+		{ "glGetSynciv",				ToProc( &NullGetSynciv ) },
+		{ "glIsSync",					ToProc( &NullReturnZero<GLboolean, GLsync> ) },
+
+		// Object creation that does not share the glGen* signature.
+		{ "glCreateTextures",			ToProc( &NullCreateTargetObjects ) },
+		{ "glCreateQueries",			ToProc( &NullCreateTargetObjects ) },
+		{ "glGenSamplers",				ToProc( &NullGenObjects ) },
+		{ "glCreateSamplers",			ToProc( &NullGenObjects ) },
+		{ "glGenProgramPipelines",		ToProc( &NullGenObjects ) },
+		{ "glCreateProgramPipelines",	ToProc( &NullGenObjects ) },
+
+		// Queries that fill out-params, callers must not read what was on their stack.
+		{ "glGetFloatv",				ToProc( &NullGetv<GLfloat> ) },
+		{ "glGetBooleanv",				ToProc( &NullGetv<GLboolean> ) },
+		{ "glGetDoublev",				ToProc( &NullGetv<GLdouble> ) },
+		{ "glGetInteger64v",			ToProc( &NullGetv<GLint64> ) },
+		{ "glGetQueryiv",				ToProc( &NullGetParameterv<GLint> ) },
+		{ "glGetTexParameteriv",		ToProc( &NullGetParameterv<GLint> ) },
+		{ "glGetTexParameterfv",		ToProc( &NullGetParameterv<GLfloat> ) },
+		{ "glGetBufferParameteriv",		ToProc( &NullGetParameterv<GLint> ) },
+		{ "glGetBufferParameteri64v",	ToProc( &NullGetParameterv<GLint64> ) },
+		{ "glGetRenderbufferParameteriv",	ToProc( &NullGetParameterv<GLint> ) },
+		{ "glGetVertexAttribiv",		ToProc( &NullGetObjectParameterv<GLint> ) },
+		{ "glGetVertexAttribfv",		ToProc( &NullGetObjectParameterv<GLfloat> ) },
+		{ "glGetTextureParameteriv",	ToProc( &NullGetObjectParameterv<GLint> ) },
+		{ "glGetNamedBufferParameteriv",	ToProc( &NullGetObjectParameterv<GLint> ) },
+		{ "glGetTexLevelParameteriv",	ToProc( &NullGetTexLevelParameteriv ) },
+		{ "glGetTextureLevelParameteriv",	ToProc( &NullGetTextureLevelParameteriv ) },
+		{ "glGetFramebufferAttachmentParameteriv",	ToProc( &NullGetFramebufferAttachmentParameteriv ) },
+		{ "glGetBufferSubData",			ToProc( &NullGetBufferSubData ) },
+		{ "glGetNamedBufferSubData",	ToProc( &NullGetNamedBufferSubData ) },
+
+		// Value returning functions.
+		{ "glGetAttribLocation",		ToProc( &NullGetLocation ) },
+		{ "glGetFragDataLocation",		ToProc( &NullGetLocation ) },
+		{ "glGetUniformBlockIndex",		ToProc( &NullGetUniformBlockIndex ) },
+		{ "glMapBuffer",				ToProc( &NullReturnZero<void*, GLenum, GLenum> ) },
+		{ "glMapBufferRange",			ToProc( &NullReturnZero<void*, GLenum, GLintptr, GLsizeiptr, GLbitfield> ) },
+		{ "glMapNamedBuffer",			ToProc( &NullReturnZero<void*, GLuint, GLenum> ) },
+		{ "glMapNamedBufferRange",		ToProc( &NullReturnZero<void*, GLuint, GLintptr, GLsizeiptr, GLbitfield> ) },
+		{ "glUnmapBuffer",				ToProc( &NullUnmapBuffer ) },
+		{ "glUnmapNamedBuffer",			ToProc( &NullUnmapNamedBuffer ) },
+		{ "glCheckNamedFramebufferStatus",	ToProc( &NullCheckNamedFramebufferStatus ) },
+		{ "glGetGraphicsResetStatus",	ToProc( &NullReturnZero<GLenum> ) },
+		{ "glIsBuffer",					ToProc( &NullIsObject ) },
+		{ "glIsTexture",				ToProc( &NullIsObject ) },
+		{ "glIsShader",					ToProc( &NullIsObject ) },
+		{ "glIsProgram",				ToProc( &NullIsObject ) },
+		{ "glIsFramebuffer",			ToProc( &NullIsObject ) },
+		{ "glIsRenderbuffer",			ToProc( &NullIsObject ) },
+		{ "glIsVertexArray",			ToProc( &NullIsObject ) },
+		{ "glIsQuery",					ToProc( &NullIsObject ) },
+		{ "glGetDebugMessageLog",
+		  ToProc( &NullReturnZero<GLuint, GLuint, GLsizei, GLenum*, GLenum*, GLuint*, GLenum*, GLsizei*, GLchar*> ) }
+	};
+
+	return s_mapNullProcs;
+}
+// clang-format on
+
+} // namespace
+
+bool NullGLContext::Load()
+{
+	if ( s_bLoaded )
+		return true;
+
+	if ( gladLoadGLLoader( &NullGLContext::GetProcAddress ) == 0 )
+	{
+		SCION_ERROR( "Failed to load the null OpenGL context." );
+		return false;
+	}
+
+	s_bLoaded = true;
+	ResetStats();
+
+	SCION_LOG( "Loaded null OpenGL context. No GPU commands will be issued." );
+	return true;
+}
+
+const NullGLStats& NullGLContext::GetStats()
+{
+	return s_Stats;
+}
+
+void NullGLContext::ResetStats()
+{
+	s_Stats = NullGLStats{};
+}
+
+void* NullGLContext::GetProcAddress( const char* sProcName )
+{
+	const auto& mapNullProcs = GetNullProcs();
+	if ( auto procItr = mapNullProcs.find( std::string_view{ sProcName } ); procItr != mapNullProcs.end() )
+		return procItr->second;
+
+	return ToProc( &NullNoOp );
+}
+
+} // namespace Scion::Rendering
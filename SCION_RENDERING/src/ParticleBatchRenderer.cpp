@@ -0,0 +1,211 @@
+#include "Rendering/Core/ParticleBatchRenderer.h"
+#include "Rendering/Utils/GPUProfiler.h"
+#include "Rendering/Utils/RenderStats.h"
+#include <algorithm>
+
+namespace Scion::Rendering
+{
+namespace
+{
+struct ParticleQuadVertex
+{
+	glm::vec2 position{ 0.f };
+	glm::vec2 uvs{ 0.f };
+};
+
+/* The instance buffer holds one section per particle array, each large enough for every instance. */
+constexpr GLsizeiptr POSITIONS_X_OFFSET = 0;
+constexpr GLsizeiptr POSITIONS_Y_OFFSET = POSITIONS_X_OFFSET + sizeof( float ) * MAX_PARTICLE_INSTANCES;
+constexpr GLsizeiptr SIZES_OFFSET = POSITIONS_Y_OFFSET + sizeof( float ) * MAX_PARTICLE_INSTANCES;
+constexpr GLsizeiptr COLORS_OFFSET = SIZES_OFFSET + sizeof( float ) * MAX_PARTICLE_INSTANCES;
+constexpr GLsizeiptr INSTANCE_BUFFER_SIZE = COLORS_OFFSET + sizeof( Color ) * MAX_PARTICLE_INSTANCES;
+} // namespace
+
+ParticleBatchRenderer::ParticleBatchRenderer()
+	: m_VAO{ 0 }
+	, m_QuadVBO{ 0 }
+	, m_IBO{ 0 }
+	, m_InstanceVBO{ 0 }
+	, m_WhiteTexture{ 0 }
+	, m_Batches{}
+	, m_NumInstances{ 0 }
+{
+	Initialize();
+}
+
+ParticleBatchRenderer::~ParticleBatchRenderer()
+{
+	if ( m_VAO != 0 )
+		glDeleteVertexArrays( 1, &m_VAO );
+
+	GLuint buffers[]{ m_QuadVBO, m_IBO, m_InstanceVBO };
+	glDeleteBuffers( 3, buffers );
+
+	if ( m_WhiteTexture != 0 )
+		glDeleteTextures( 1, &m_WhiteTexture );
+}
+
+void ParticleBatchRenderer::Initialize()
+{
+	// The quad is centered on the particle position and scaled by the particle size in the shader.
+	// clang-format off
+	ParticleQuadVertex quad[ 4 ]{
+		{ .position = glm::vec2{ -0.5f, -0.5f }, .uvs = glm::vec2{ 0.f, 0.f } },
+		{ .position = glm::vec2{ 0.5f, -0.5f }, .uvs = glm::vec2{ 1.f, 0.f } },
+		{ .position = glm::vec2{ 0.5f, 0.5f }, .uvs = glm::vec2{ 1.f, 1.f } },
+		{ .position = glm::vec2{ -0.5f, 0.5f }, .uvs = glm::vec2{ 0.f, 1.f } }
+	};
+	// clang-format on
+	GLuint indices[ 6 ]{ 0, 1, 2, 2, 3, 0 };
+
+	glGenVertexArrays( 1, &m_VAO );
+	glBindVertexArray( m_VAO );
+
+	glGenBuffers( 1, &m_QuadVBO );
+	glBindBuffer( GL_ARRAY_BUFFER, m_QuadVBO );
+	glBufferData( GL_ARRAY_BUFFER, sizeof( quad ), quad, GL_STATIC_DRAW );
+
+	glVertexAttribPointer(
+		0, 2, GL_FLOAT, GL_FALSE, sizeof( ParticleQuadVertex ), (void*)offsetof( ParticleQuadVertex, position ) );
+	glEnableVertexAttribArray( 0 );
+	glVertexAttribPointer(
+		1, 2, GL_FLOAT, GL_FALSE, sizeof( ParticleQuadVertex ), (void*)offsetof( ParticleQuadVertex, uvs ) );
+	glEnableVertexAttribArray( 1 );
+
+	glGenBuffers( 1, &m_IBO );
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, m_IBO );
+	glBufferData( GL_ELEMENT_ARRAY_BUFFER, sizeof( indices ), indices, GL_STATIC_DRAW );
+
+	glGenBuffers( 1, &m_InstanceVBO );
+	glBindBuffer( GL_ARRAY_BUFFER, m_InstanceVBO );
+	glBufferData( GL_ARRAY_BUFFER, INSTANCE_BUFFER_SIZE, nullptr, GL_STREAM_DRAW );
+
+	// Instance attributes advance once per particle instead of once per vertex.
+	for ( GLuint location = 2; location <= 5; ++location )
+	{
+		glEnableVertexAttribArray( location );
+		glVertexAttribDivisor( location, 1 );
+	}
+
+	SetInstanceAttributes( 0 );
+
+	glBindVertexArray( 0 );
+	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+	const Color white{};
+	glGenTextures( 1, &m_WhiteTexture );
+	glBindTexture( GL_TEXTURE_2D, m_WhiteTexture );
+	glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &white );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+	glBindTexture( GL_TEXTURE_2D, 0 );
+}
+
+void ParticleBatchRenderer::SetInstanceAttributes( GLuint first )
+{
+	// Each array is tightly packed, so the attributes for a batch start at its first instance in every section.
+	glBindBuffer( GL_ARRAY_BUFFER, m_InstanceVBO );
+	glVertexAttribPointer(
+		2, 1, GL_FLOAT, GL_FALSE, sizeof( float ), (void*)( POSITIONS_X_OFFSET + sizeof( float ) * first ) );
+	glVertexAttribPointer(
+		3, 1, GL_FLOAT, GL_FALSE, sizeof( float ), (void*)( POSITIONS_Y_OFFSET + sizeof( float ) * first ) );
+	glVertexAttribPointer(
+		4, 1, GL_FLOAT, GL_FALSE, sizeof( float ), (void*)( SIZES_OFFSET + sizeof( float ) * first ) );
+	glVertexAttribPointer(
+		5, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof( Color ), (void*)( COLORS_OFFSET + sizeof( Color ) * first ) );
+}
+
+void ParticleBatchRenderer::Begin()
+{
+	m_Batches.clear();
+	m_NumInstances = 0;
+
+	// Orphan the buffer, so the driver does not wait for the last frame's draws to finish.
+	glBindBuffer( GL_ARRAY_BUFFER, m_InstanceVBO );
+	glBufferData( GL_ARRAY_BUFFER, INSTANCE_BUFFER_SIZE, nullptr, GL_STREAM_DRAW );
+	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+}
+
+void ParticleBatchRenderer::AddParticles( const float* pPositionsX,
+										  const float* pPositionsY,
+										  const float* pSizes,
+										  const Color* pColors,
+										  size_t count,
+										  GLuint textureID )
+{
+	if ( textureID == 0 )
+		textureID = m_WhiteTexture;
+
+	size_t numAdded{ 0 };
+	while ( numAdded < count )
+	{
+		if ( m_NumInstances == MAX_PARTICLE_INSTANCES )
+		{
+			Render();
+			Begin();
+		}
+
+		const size_t numToAdd = std::min( count - numAdded, MAX_PARTICLE_INSTANCES - m_NumInstances );
+
+		glBindBuffer( GL_ARRAY_BUFFER, m_InstanceVBO );
+		glBufferSubData( GL_ARRAY_BUFFER,
+						 POSITIONS_X_OFFSET + sizeof( float ) * m_NumInstances,
+						 sizeof( float ) * numToAdd,
+						 pPositionsX + numAdded );
+		glBufferSubData( GL_ARRAY_BUFFER,
+						 POSITIONS_Y_OFFSET + sizeof( float ) * m_NumInstances,
+						 sizeof( float ) * numToAdd,
+						 pPositionsY + numAdded );
+		glBufferSubData( GL_ARRAY_BUFFER,
+						 SIZES_OFFSET + sizeof( float ) * m_NumInstances,
+						 sizeof( float ) * numToAdd,
+						 pSizes + numAdded );
+		glBufferSubData( GL_ARRAY_BUFFER,
+						 COLORS_OFFSET + sizeof( Color ) * m_NumInstances,
+						 sizeof( Color ) * numToAdd,
+						 pColors + numAdded );
+		glBindBuffer( GL_ARRAY_BUFFER, 0 );
+		RenderStats::AddVertexUpload( numToAdd, ( sizeof( float ) * 3 + sizeof( Color ) ) * numToAdd );
+
+		if ( !m_Batches.empty() && m_Batches.back().textureID == textureID )
+		{
+			m_Batches.back().count += static_cast<GLsizei>( numToAdd );
+		}
+		else
+		{
+			m_Batches.emplace_back( ParticleBatch{
+				.textureID = textureID, .first = m_NumInstances, .count = static_cast<GLsizei>( numToAdd ) } );
+		}
+
+		m_NumInstances += static_cast<GLuint>( numToAdd );
+		numAdded += numToAdd;
+	}
+}
+
+void ParticleBatchRenderer::End()
+{
+	// The particles are uploaded as they are added, there is nothing left to generate.
+}
+
+void ParticleBatchRenderer::Render()
+{
+	if ( m_Batches.empty() )
+		return;
+
+	SCION_GPU_ZONE( "ParticleBatchRenderer::Render" );
+
+	glBindVertexArray( m_VAO );
+
+	for ( const auto& batch : m_Batches )
+	{
+		SetInstanceAttributes( batch.first );
+		glBindTextureUnit( 0, batch.textureID );
+		glDrawElementsInstanced( GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, batch.count );
+		RenderStats::AddDrawCall( 6 * static_cast<std::uint64_t>( batch.count ) );
+	}
+
+	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+	glBindVertexArray( 0 );
+}
+
+} // namespace Scion::Rendering
@@ -1,4 +1,6 @@
 #include "Rendering/Core/PickingBatchRenderer.h"
+#include "Rendering/Utils/GPUProfiler.h"
+#include "Rendering/Utils/RenderStats.h"
 #include <algorithm>
 
 namespace Scion::Rendering
@@ -44,6 +46,7 @@ void PickingBatchRenderer::GenerateBatches()
 
 	glBufferData( GL_ARRAY_BUFFER, vertices.size() * sizeof( PickingVertex ), nullptr, GL_DYNAMIC_DRAW );
 	glBufferSubData( GL_ARRAY_BUFFER, 0, vertices.size() * sizeof( PickingVertex ), vertices.data() );
+	RenderStats::AddVertexUpload( vertices.size(), vertices.size() * sizeof( PickingVertex ) );
 
 	glBindBuffer( GL_ARRAY_BUFFER, 0 );
 }
@@ -70,12 +73,15 @@ void PickingBatchRenderer::Render()
 	if ( m_Batches.empty() )
 		return;
 
+	SCION_GPU_ZONE( "PickingBatchRenderer::Render" );
+
 	EnableVAO();
 
 	for ( const auto& batch : m_Batches )
 	{
 		glBindTextureUnit( 0, batch->textureID );
 		glDrawElements( GL_TRIANGLES, batch->numIndices, GL_UNSIGNED_INT, (void*)( sizeof( GLuint ) * batch->offset ) );
+		RenderStats::AddDrawCall( batch->numIndices );
 	}
 
 	DisableVAO();
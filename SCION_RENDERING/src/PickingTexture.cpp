@@ -1,6 +1,7 @@
 #include "Rendering/Essentials/PickingTexture.h"
 #include "Logger/Logger.h"
 #include <entt/entt.hpp>
+#include <algorithm>
 
 namespace Scion::Rendering
 {
@@ -16,6 +17,11 @@ PickingTexture::PickingTexture( int width, int height )
 	, m_Width{ width }
 	, m_Height{ height }
 	, m_bShouldResize{ false }
+	, m_PixelBuffers{ 0 }
+	, m_PendingReads{}
+	, m_WriteIndex{ 0 }
+	, m_ReadIndex{ 0 }
+	, m_NumPendingReads{ 0 }
 {
 	if (!Init(width, height))
 	{
@@ -71,6 +77,75 @@ uint32_t PickingTexture::ReadPixel( int x, int y ) const
 	return pixelData;
 }
 
+void PickingTexture::RequestPixel( int x, int y )
+{
+	// Every buffer is in flight, drop the oldest read.
+	if ( m_NumPendingReads == NUM_PICKING_BUFFERS )
+	{
+		glDeleteSync( m_PendingReads[ m_ReadIndex ].fence );
+		m_PendingReads[ m_ReadIndex ] = PendingRead{};
+		m_ReadIndex = ( m_ReadIndex + 1 ) % NUM_PICKING_BUFFERS;
+		--m_NumPendingReads;
+	}
+
+	glBindFramebuffer( GL_READ_FRAMEBUFFER, m_FBO );
+	glReadBuffer( GL_COLOR_ATTACHMENT0 );
+
+	// With a pack buffer bound, glReadPixels writes into the buffer and returns right away.
+	glBindBuffer( GL_PIXEL_PACK_BUFFER, m_PixelBuffers[ m_WriteIndex ] );
+	glReadPixels( x, m_Height - y, 1, 1, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr );
+	glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+
+	glReadBuffer( GL_NONE );
+	glBindFramebuffer( GL_READ_FRAMEBUFFER, 0 );
+
+	m_PendingReads[ m_WriteIndex ] =
+		PendingRead{ .fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 ), .numPolls = 0 };
+
+	m_WriteIndex = ( m_WriteIndex + 1 ) % NUM_PICKING_BUFFERS;
+	++m_NumPendingReads;
+}
+
+bool PickingTexture::TryGetPixel( uint32_t& pixel )
+{
+	bool bFinished{ false };
+
+	while ( m_NumPendingReads > 0 )
+	{
+		auto& pendingRead = m_PendingReads[ m_ReadIndex ];
+
+		GLenum waitResult{ GL_TIMEOUT_EXPIRED };
+		if ( ++pendingRead.numPolls < MAX_PICKING_LATENCY )
+		{
+			waitResult = glClientWaitSync( pendingRead.fence, 0, 0 );
+		}
+		else
+		{
+			// The read has been pending for too long, flush and wait for it.
+			waitResult = glClientWaitSync( pendingRead.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED );
+		}
+
+		if ( waitResult != GL_ALREADY_SIGNALED && waitResult != GL_CONDITION_SATISFIED )
+			break;
+
+		uint32_t pixelData{ static_cast<uint32_t>( entt::null ) };
+		glBindBuffer( GL_PIXEL_PACK_BUFFER, m_PixelBuffers[ m_ReadIndex ] );
+		glGetBufferSubData( GL_PIXEL_PACK_BUFFER, 0, sizeof( uint32_t ), &pixelData );
+		glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+
+		glDeleteSync( pendingRead.fence );
+		pendingRead = PendingRead{};
+		m_ReadIndex = ( m_ReadIndex + 1 ) % NUM_PICKING_BUFFERS;
+		--m_NumPendingReads;
+
+		// If more than one read finished, the newest one wins.
+		pixel = pixelData;
+		bFinished = true;
+	}
+
+	return bFinished;
+}
+
 bool PickingTexture::Init( int width, int height )
 {
 	// Generate the framebuffer
@@ -111,10 +186,28 @@ bool PickingTexture::Init( int width, int height )
 	// unbind the texture and framebuffer
 	glBindTexture( GL_TEXTURE_2D, 0 );
 	glBindFramebuffer( GL_FRAMEBUFFER, 0 );
+
+	// Create the buffers for the asynchronous reads, each holds a single entity id.
+	glGenBuffers( NUM_PICKING_BUFFERS, m_PixelBuffers );
+	for ( auto pixelBuffer : m_PixelBuffers )
+	{
+		glBindBuffer( GL_PIXEL_PACK_BUFFER, pixelBuffer );
+		glBufferData( GL_PIXEL_PACK_BUFFER, sizeof( uint32_t ), nullptr, GL_STREAM_READ );
+	}
+
+	glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
 	return true;
 }
 void PickingTexture::CleanUp()
 {
+	ClearPendingReads();
+
+	if ( m_PixelBuffers[ 0 ] > 0 )
+	{
+		glDeleteBuffers( NUM_PICKING_BUFFERS, m_PixelBuffers );
+		std::fill( std::begin( m_PixelBuffers ), std::end( m_PixelBuffers ), 0 );
+	}
+
 	if ( m_FBO > 0 )
 	{
 		glDeleteFramebuffers( 1, &m_FBO );
@@ -133,4 +226,19 @@ void PickingTexture::CleanUp()
 		m_DepthTexture = 0;
 	}
 }
+
+void PickingTexture::ClearPendingReads()
+{
+	for ( auto& pendingRead : m_PendingReads )
+	{
+		if ( pendingRead.fence )
+			glDeleteSync( pendingRead.fence );
+
+		pendingRead = PendingRead{};
+	}
+
+	m_WriteIndex = 0;
+	m_ReadIndex = 0;
+	m_NumPendingReads = 0;
+}
 } // namespace Scion::Rendering
@@ -1,4 +1,6 @@
 #include "Rendering/Core/RectBatchRenderer.h"
+#include "Rendering/Utils/GPUProfiler.h"
+#include "Rendering/Utils/RenderStats.h"
 #include "Rendering/Essentials/Primitives.h"
 
 namespace Scion::Rendering
@@ -45,6 +47,7 @@ void RectBatchRenderer::GenerateBatches()
 		glBufferData( GL_ARRAY_BUFFER, vertices.size() * sizeof( Vertex ), nullptr, GL_DYNAMIC_DRAW );
 		// Upload the data
 		glBufferSubData( GL_ARRAY_BUFFER, 0, vertices.size() * sizeof( Vertex ), vertices.data() );
+		RenderStats::AddVertexUpload( vertices.size(), vertices.size() * sizeof( Vertex ) );
 
 		glBindBuffer( GL_ARRAY_BUFFER, 0 );
 	}
@@ -73,11 +76,17 @@ void RectBatchRenderer::End()
 
 void RectBatchRenderer::Render()
 {
+	if ( m_Batches.empty() )
+		return;
+
+	SCION_GPU_ZONE( "RectBatchRenderer::Render" );
+
 	EnableVAO();
 
 	for ( const auto& batch : m_Batches )
 	{
 		glDrawElements( GL_TRIANGLES, batch->numIndices, GL_UNSIGNED_INT, (void*)( sizeof( GLuint ) * batch->offset ) );
+		RenderStats::AddDrawCall( batch->numIndices );
 	}
 
 	DisableVAO();
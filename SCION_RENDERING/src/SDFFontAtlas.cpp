@@ -0,0 +1,272 @@
+#include "Rendering/Essentials/SDFFontAtlas.h"
+#include <Logger/Logger.h>
+#include <stb_truetype.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+/* Pixels of distance field around each glyph. */
+constexpr int SDF_PADDING = 6;
+/* Value stored at the glyph edge, the shader treats 0.5 as the edge. */
+constexpr unsigned char SDF_ON_EDGE_VALUE = 128;
+/* Distance field value change per pixel, so the padding covers the full range. */
+constexpr float SDF_PIXEL_DIST_SCALE = static_cast<float>( SDF_ON_EDGE_VALUE ) / SDF_PADDING;
+/* Shelves are rounded up to this height, so glyphs of similar heights can share them. */
+constexpr int SDF_SHELF_ROUNDING = 8;
+/* Empty pixels between glyphs, prevents bleeding when sampling. */
+constexpr int SDF_GLYPH_GUTTER = 1;
+constexpr std::size_t NO_SHELF = std::numeric_limits<std::size_t>::max();
+
+namespace Scion::Rendering
+{
+
+SDFFontAtlas::SDFFontAtlas() = default;
+
+SDFFontAtlas::~SDFFontAtlas()
+{
+	if ( m_TextureID != 0 )
+		glDeleteTextures( 1, &m_TextureID );
+}
+
+std::shared_ptr<SDFFontAtlas> SDFFontAtlas::Create( std::vector<unsigned char> fontData, int width, int height )
+{
+	if ( fontData.empty() )
+	{
+		SCION_ERROR( "Failed to create SDF font atlas. Font data is empty." );
+		return nullptr;
+	}
+
+	std::shared_ptr<SDFFontAtlas> pAtlas{ new SDFFontAtlas{} };
+	pAtlas->m_FontData = std::move( fontData );
+	pAtlas->m_pFontInfo = std::make_unique<stbtt_fontinfo>();
+
+	const auto* pData = pAtlas->m_FontData.data();
+	if ( !stbtt_InitFont( pAtlas->m_pFontInfo.get(), pData, stbtt_GetFontOffsetForIndex( pData, 0 ) ) )
+	{
+		SCION_ERROR( "Failed to create SDF font atlas. Failed to initialize Font Info." );
+		return nullptr;
+	}
+
+	// Top of tallest glyph above baseline
+	int ascent;
+	// How far below baseline descenders go
+	int descent;
+	// Extra padding between lines
+	int lineGap;
+	stbtt_GetFontVMetrics( pAtlas->m_pFontInfo.get(), &ascent, &descent, &lineGap );
+
+	pAtlas->m_Scale = stbtt_ScaleForPixelHeight( pAtlas->m_pFontInfo.get(), pAtlas->m_BaseSize );
+	pAtlas->m_Ascent = ascent * pAtlas->m_Scale;
+	pAtlas->m_Width = width;
+	pAtlas->m_Height = height;
+
+	glGenTextures( 1, &pAtlas->m_TextureID );
+	glBindTexture( GL_TEXTURE_2D, pAtlas->m_TextureID );
+
+	// Start with a cleared atlas, glyphs are uploaded as they are rasterized.
+	std::vector<unsigned char> clearData( static_cast<std::size_t>( width ) * height, 0 );
+	glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+	glTexImage2D( GL_TEXTURE_2D, 0, GL_R8, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, clearData.data() );
+	glPixelStorei( GL_UNPACK_ALIGNMENT, 4 );
+
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+	glBindTexture( GL_TEXTURE_2D, 0 );
+
+	return pAtlas;
+}
+
+const SDFGlyph* SDFFontAtlas::GetGlyph( std::uint32_t codepoint )
+{
+	if ( auto glyphItr = m_mapGlyphs.find( codepoint ); glyphItr != m_mapGlyphs.end() )
+	{
+		TouchShelf( glyphItr->second.shelfIndex );
+		return &glyphItr->second.glyph;
+	}
+
+	return RasterizeGlyph( codepoint );
+}
+
+void SDFFontAtlas::BeginShaping()
+{
+	m_bShaping = true;
+	m_ShapingShelves.clear();
+}
+
+std::vector<SDFShelfStamp> SDFFontAtlas::EndShaping()
+{
+	for ( const auto& stamp : m_ShapingShelves )
+		m_Shelves[ stamp.shelf ].bPinned = false;
+
+	m_bShaping = false;
+	return std::exchange( m_ShapingShelves, {} );
+}
+
+bool SDFFontAtlas::IsStale( const std::vector<SDFShelfStamp>& shelves ) const
+{
+	return std::ranges::any_of( shelves, [ this ]( const auto& stamp ) {
+		return stamp.shelf >= m_Shelves.size() || m_Shelves[ stamp.shelf ].generation != stamp.generation;
+	} );
+}
+
+const SDFGlyph* SDFFontAtlas::RasterizeGlyph( std::uint32_t codepoint )
+{
+	auto* pInfo = m_pFontInfo.get();
+	int glyphIndex = stbtt_FindGlyphIndex( pInfo, static_cast<int>( codepoint ) );
+
+	// Glyph index 0 is the missing glyph box, which is still drawn so the user knows something is wrong.
+	int advance, leftSideBearing;
+	stbtt_GetGlyphHMetrics( pInfo, glyphIndex, &advance, &leftSideBearing );
+
+	int width{ 0 }, height{ 0 }, xOffset{ 0 }, yOffset{ 0 };
+	unsigned char* pSDF = stbtt_GetGlyphSDF( pInfo,
+											 m_Scale,
+											 glyphIndex,
+											 SDF_PADDING,
+											 SDF_ON_EDGE_VALUE,
+											 SDF_PIXEL_DIST_SCALE,
+											 &width,
+											 &height,
+											 &xOffset,
+											 &yOffset );
+
+	GlyphEntry entry{ .glyph = SDFGlyph{ .advance = advance * m_Scale }, .shelfIndex = NO_SHELF };
+
+	// Glyphs like space have no shape, they only advance the position.
+	if ( pSDF )
+	{
+		std::size_t shelfIndex{ 0 };
+		int x{ 0 }, y{ 0 };
+		if ( !AllocateRect( width + SDF_GLYPH_GUTTER, height + SDF_GLYPH_GUTTER, shelfIndex, x, y ) )
+		{
+			SCION_ERROR( "Failed to add glyph [{}] to the SDF font atlas. The glyph is larger than the atlas.",
+						 codepoint );
+			stbtt_FreeSDF( pSDF, nullptr );
+			return nullptr;
+		}
+
+		glBindTexture( GL_TEXTURE_2D, m_TextureID );
+		glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+		glTexSubImage2D( GL_TEXTURE_2D, 0, x, y, width, height, GL_RED, GL_UNSIGNED_BYTE, pSDF );
+		glPixelStorei( GL_UNPACK_ALIGNMENT, 4 );
+		glBindTexture( GL_TEXTURE_2D, 0 );
+
+		stbtt_FreeSDF( pSDF, nullptr );
+
+		const glm::vec2 atlasSize{ static_cast<float>( m_Width ), static_cast<float>( m_Height ) };
+		entry.glyph.offset = glm::vec2{ static_cast<float>( xOffset ), static_cast<float>( yOffset ) };
+		entry.glyph.size = glm::vec2{ static_cast<float>( width ), static_cast<float>( height ) };
+		entry.glyph.uvMin = glm::vec2{ static_cast<float>( x ), static_cast<float>( y ) } / atlasSize;
+		entry.glyph.uvMax = ( glm::vec2{ static_cast<float>( x ), static_cast<float>( y ) } + entry.glyph.size ) / atlasSize;
+		entry.shelfIndex = shelfIndex;
+
+		m_Shelves[ shelfIndex ].codepoints.push_back( codepoint );
+	}
+
+	auto [ glyphItr, bSuccess ] = m_mapGlyphs.emplace( codepoint, entry );
+	return &glyphItr->second.glyph;
+}
+
+bool SDFFontAtlas::AllocateRect( int width, int height, std::size_t& shelfIndex, int& x, int& y )
+{
+	if ( width > m_Width || height > m_Height )
+		return false;
+
+	// Find the shelf with the least wasted height that still has room.
+	std::size_t bestShelf{ NO_SHELF };
+	for ( std::size_t i = 0; i < m_Shelves.size(); ++i )
+	{
+		const auto& shelf = m_Shelves[ i ];
+		if ( shelf.height < height || shelf.nextX + width > m_Width )
+			continue;
+
+		if ( bestShelf == NO_SHELF || shelf.height < m_Shelves[ bestShelf ].height )
+			bestShelf = i;
+	}
+
+	// Wasting more than half of a shelf is worse than starting a new one, if there is room for it.
+	const int shelfHeight =
+		std::min( ( height + SDF_SHELF_ROUNDING - 1 ) / SDF_SHELF_ROUNDING * SDF_SHELF_ROUNDING, m_Height );
+	const bool bCanAddShelf = m_NextShelfY + shelfHeight <= m_Height;
+
+	if ( bestShelf == NO_SHELF || ( m_Shelves[ bestShelf ].height > height * 2 && bCanAddShelf ) )
+	{
+		if ( bCanAddShelf )
+		{
+			m_Shelves.emplace_back( Shelf{ .y = m_NextShelfY, .height = shelfHeight } );
+			m_ShelfLRU.push_front( m_Shelves.size() - 1 );
+			m_Shelves.back().lruItr = m_ShelfLRU.begin();
+			m_NextShelfY += shelfHeight;
+			bestShelf = m_Shelves.size() - 1;
+		}
+	}
+
+	if ( bestShelf == NO_SHELF )
+	{
+		// The atlas is full, reuse the least recently used shelf that is tall enough and not used by the layout.
+		for ( auto lruItr = m_ShelfLRU.rbegin(); lruItr != m_ShelfLRU.rend(); ++lruItr )
+		{
+			if ( !m_Shelves[ *lruItr ].bPinned && m_Shelves[ *lruItr ].height >= height )
+			{
+				bestShelf = *lruItr;
+				break;
+			}
+		}
+
+		if ( bestShelf == NO_SHELF )
+			return false;
+
+		EvictShelf( bestShelf );
+	}
+
+	auto& shelf = m_Shelves[ bestShelf ];
+	shelfIndex = bestShelf;
+	x = shelf.nextX;
+	y = shelf.y;
+	shelf.nextX += width;
+
+	TouchShelf( bestShelf );
+	return true;
+}
+
+void SDFFontAtlas::TouchShelf( std::size_t shelfIndex )
+{
+	if ( shelfIndex == NO_SHELF )
+		return;
+
+	auto& shelf = m_Shelves[ shelfIndex ];
+	m_ShelfLRU.splice( m_ShelfLRU.begin(), m_ShelfLRU, shelf.lruItr );
+
+	if ( m_bShaping && !shelf.bPinned )
+	{
+		shelf.bPinned = true;
+		m_ShapingShelves.push_back(
+			SDFShelfStamp{ .shelf = static_cast<std::uint32_t>( shelfIndex ), .generation = shelf.generation } );
+	}
+}
+
+void SDFFontAtlas::EvictShelf( std::size_t shelfIndex )
+{
+	auto& shelf = m_Shelves[ shelfIndex ];
+	for ( auto codepoint : shelf.codepoints )
+		m_mapGlyphs.erase( codepoint );
+
+	shelf.codepoints.clear();
+	shelf.nextX = 0;
+
+	// Clear the old glyphs, the gutters of the new glyphs would otherwise sample their edges.
+	std::vector<unsigned char> clearData( static_cast<std::size_t>( m_Width ) * shelf.height, 0 );
+	glBindTexture( GL_TEXTURE_2D, m_TextureID );
+	glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+	glTexSubImage2D( GL_TEXTURE_2D, 0, 0, shelf.y, m_Width, shelf.height, GL_RED, GL_UNSIGNED_BYTE, clearData.data() );
+	glPixelStorei( GL_UNPACK_ALIGNMENT, 4 );
+	glBindTexture( GL_TEXTURE_2D, 0 );
+
+	// Only the layouts that used the evicted glyphs have invalid uvs.
+	++shelf.generation;
+}
+
+} // namespace Scion::Rendering
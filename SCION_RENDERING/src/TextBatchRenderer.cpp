@@ -1,11 +1,8 @@
 #include "Rendering/Core/TextBatchRenderer.h"
+#include "Rendering/Utils/GPUProfiler.h"
+#include "Rendering/Utils/RenderStats.h"
 #include <Logger/Logger.h>
 
-/* If the loop is more that 100, fail and let the user know. */
-constexpr int MAX_LOOP_FAIL_CHECK = 100;
-constexpr GLuint NUM_VERTICES = 6;
-constexpr float MIN_TEXT_WRAP = 100.f;
-
 namespace Scion::Rendering
 {
 
@@ -18,198 +15,96 @@ void TextBatchRenderer::Initialize()
 
 void TextBatchRenderer::GenerateBatches()
 {
-	GLuint offset{ 0 }, prevFontID{ 0 };
-	int currentFont{ 0 };
-
-	size_t total{ 0 }, currentVertex{ 0 };
+	std::size_t total{ 0 };
 
 	// Add up the total characters
-	for ( const auto& textGlpyh : m_Glyphs )
-		total += textGlpyh->textStr.size();
+	for ( const auto& textGlyph : m_Glyphs )
+		total += textGlyph->pLayout->glyphs.size();
+
+	if ( total == 0 )
+		return;
 
 	std::vector<Vertex> vertices;
-	vertices.resize( total * NUM_VERTICES );
+	vertices.resize( ( total > MAX_SPRITES ? MAX_SPRITES : total ) * NUM_SPRITE_VERTICES );
+
+	GLuint prevFontID{ 0 };
 
 	for ( const auto& textGlyph : m_Glyphs )
 	{
-		std::vector<std::string> textChunks{};
-		std::string text_holder{};
-		glm::vec2 temp_pos = textGlyph->position;
-		auto fontSize = textGlyph->font->GetFontSize();
-		int infiniteLoopCheck{ 0 };
+		const auto& layout = *textGlyph->pLayout;
+		const auto& color = textGlyph->color;
+
+		// The layout is relative to the text position, snap it to whole pixels like the font quads.
+		const glm::vec2 position = glm::floor( textGlyph->position + 0.5f );
 
-		if ( textGlyph->wrap > MIN_TEXT_WRAP )
+		// Reduce the model to a 2D affine transform, so each corner costs two multiply adds.
+		const auto& model = textGlyph->model;
+		const glm::vec2 axisX{ model[ 0 ] };
+		const glm::vec2 axisY{ model[ 1 ] };
+		const glm::vec2 origin = glm::vec2{ model[ 3 ] } + axisX * position.x + axisY * position.y;
+
+		for ( const auto& glyph : layout.glyphs )
 		{
-			// Create the text chunks for each line.
-			for ( int i = 0; i < textGlyph->textStr.size(); i++ )
+			const glm::vec2 minX = axisX * glyph.min.position.x;
+			const glm::vec2 maxX = axisX * glyph.max.position.x;
+			const glm::vec2 minY = origin + axisY * glyph.min.position.y;
+			const glm::vec2 maxY = origin + axisY * glyph.max.position.y;
+
+			vertices[ m_CurrentVertex++ ] = Vertex{
+				.position = minX + minY, .uvs = glm::vec2{ glyph.min.uvs.x, glyph.min.uvs.y }, .color = color };
+			vertices[ m_CurrentVertex++ ] = Vertex{
+				.position = maxX + minY, .uvs = glm::vec2{ glyph.max.uvs.x, glyph.min.uvs.y }, .color = color };
+			vertices[ m_CurrentVertex++ ] = Vertex{
+				.position = maxX + maxY, .uvs = glm::vec2{ glyph.max.uvs.x, glyph.max.uvs.y }, .color = color };
+			vertices[ m_CurrentVertex++ ] = Vertex{
+				.position = minX + maxY, .uvs = glm::vec2{ glyph.min.uvs.x, glyph.max.uvs.y }, .color = color };
+
+			if ( m_CurrentObject == 0 || layout.fontAtlasID != prevFontID )
 			{
-				if ( infiniteLoopCheck >= MAX_LOOP_FAIL_CHECK )
-				{
-					SCION_ERROR(
-						"Failed to draw text batch correctly. Please check your text wrap, padding, textStr, etc." );
-					return;
-				}
-
-				auto character = textGlyph->textStr[ i ];
-				text_holder += character;
-				bool bNewLine = character == '\n';
-				size_t text_size = text_holder.size();
-				// Move the temp_pos with each character
-				textGlyph->font->GetNextCharPos( character, temp_pos );
-
-				if ( text_size > 0 &&
-					 ( temp_pos.x > ( textGlyph->wrap + textGlyph->position.x ) || character == '\0' || bNewLine ) )
-				{
-					if ( !bNewLine )
-					{
-						// if not an end mark, pop off the character
-						while ( textGlyph->textStr[ i ] != ' ' && textGlyph->textStr[ i ] != '.' &&
-								textGlyph->textStr[ i ] != '!' && textGlyph->textStr[ i ] != '?' && text_size > 0 )
-						{
-							i--;
-							infiniteLoopCheck++;
-
-							if ( i < 0 )
-							{
-								SCION_ERROR( "Failed to draw text [{}] - Wrap [{}] is too small for the text to wrap "
-											 "successfully!",
-											 textGlyph->textStr,
-											 textGlyph->wrap );
-								return;
-							}
-
-							if ( !text_holder.empty() )
-							{
-								text_holder.pop_back();
-								text_size = text_holder.size();
-								temp_pos.x -= fontSize;
-							}
-						}
-					}
-					else
-					{
-						text_holder.pop_back(); // Pop off the newline character
-					}
-
-					if ( text_size > 0 )
-					{
-						if ( std::isalpha( text_holder[ 0 ] ) )
-						{
-							textChunks.push_back( text_holder );
-							temp_pos = textGlyph->position;
-							text_holder.clear();
-							infiniteLoopCheck = 0;
-						}
-						else
-						{
-							text_holder.erase( 0, 1 );
-							temp_pos.x -= fontSize;
-						}
-					}
-				}
+				m_Batches.push_back( std::make_unique<TextBatch>( TextBatch{
+					.numIndices = NUM_SPRITE_INDICES, .offset = m_Offset, .fontAtlasID = layout.fontAtlasID } ) );
 			}
-
-			if ( !text_holder.empty() )
+			else
 			{
-				textChunks.push_back( text_holder );
-				text_holder.clear();
+				m_Batches.back()->numIndices += NUM_SPRITE_INDICES;
 			}
-		}
-		else // Push back the entire string
-		{
-			textChunks.push_back( textGlyph->textStr );
-		}
-
-		// Reset the text position
-		temp_pos = textGlyph->position;
 
-		// Add new Text Sprite
-		for ( const auto& textStr : textChunks )
-		{
-			for ( const auto& character : textStr )
-			{
-				auto glyph = textGlyph->font->GetGlyph( character, temp_pos );
-
-				// First Triangle
-				vertices[ currentVertex++ ] = Vertex{
-					.position = textGlyph->model * glm::vec4{ glyph.min.position.x, glyph.min.position.y, 0.f, 1.f },
-					.uvs = glm::vec2{ glyph.min.uvs.x, glyph.min.uvs.y },
-					.color = textGlyph->color };
-
-				vertices[ currentVertex++ ] = Vertex{
-					.position = textGlyph->model * glm::vec4{ glyph.max.position.x, glyph.max.position.y, 0.f, 1.f },
-					.uvs = glm::vec2{ glyph.max.uvs.x, glyph.max.uvs.y },
-					.color = textGlyph->color };
-
-				vertices[ currentVertex++ ] = Vertex{
-					.position = textGlyph->model * glm::vec4{ glyph.max.position.x, glyph.min.position.y, 0.f, 1.f },
-					.uvs = glm::vec2{ glyph.max.uvs.x, glyph.min.uvs.y },
-					.color = textGlyph->color };
-
-				// Second Triangle
-				vertices[ currentVertex++ ] = Vertex{
-					.position = textGlyph->model * glm::vec4{ glyph.min.position.x, glyph.min.position.y, 0.f, 1.f },
-					.uvs = glm::vec2{ glyph.min.uvs.x, glyph.min.uvs.y },
-					.color = textGlyph->color };
-
-				vertices[ currentVertex++ ] = Vertex{
-					.position = textGlyph->model * glm::vec4{ glyph.min.position.x, glyph.max.position.y, 0.f, 1.f },
-					.uvs = glm::vec2{ glyph.min.uvs.x, glyph.max.uvs.y },
-					.color = textGlyph->color };
-
-				vertices[ currentVertex++ ] = Vertex{
-					.position = textGlyph->model * glm::vec4{ glyph.max.position.x, glyph.max.position.y, 0.f, 1.f },
-					.uvs = glm::vec2{ glyph.max.uvs.x, glyph.max.uvs.y },
-					.color = textGlyph->color };
-
-				if ( currentFont == 0 )
-				{
-					m_Batches.push_back(
-						std::make_unique<TextBatch>( TextBatch{ .offset = offset,
-																.numVertices = NUM_VERTICES,
-																.fontAtlasID = textGlyph->font->GetFontAtlasID() } ) );
-				}
-				else if ( textGlyph->font->GetFontAtlasID() != prevFontID )
-				{
-					m_Batches.push_back(
-						std::make_unique<TextBatch>( TextBatch{ .offset = offset,
-																.numVertices = NUM_VERTICES,
-																.fontAtlasID = textGlyph->font->GetFontAtlasID() } ) );
-				}
-				else
-				{
-					m_Batches.back()->numVertices += NUM_VERTICES;
-				}
-
-				currentFont++;
-				prevFontID = textGlyph->font->GetFontAtlasID();
-				offset += NUM_VERTICES;
-			}
+			prevFontID = layout.fontAtlasID;
+			m_CurrentObject++;
+			m_Offset += NUM_SPRITE_INDICES;
 
-			// Move to the next Line
-			temp_pos.x = textGlyph->position.x;
-			temp_pos.y += textGlyph->font->GetFontSize() + textGlyph->padding;
+			// If the number of glyphs are equal to max sprites,
+			// Flush early
+			if ( m_CurrentObject == MAX_SPRITES )
+				Flush( vertices );
 		}
 	}
 
-	glBindBuffer( GL_ARRAY_BUFFER, GetVBO() );
-	glBufferData( GL_ARRAY_BUFFER, vertices.size() * sizeof( Vertex ), nullptr, GL_DYNAMIC_DRAW );
-	glBufferSubData( GL_ARRAY_BUFFER, 0, vertices.size() * sizeof( Vertex ), vertices.data() );
-	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+	// Buffer remaining data
+	if ( !m_Batches.empty() )
+	{
+		glBindBuffer( GL_ARRAY_BUFFER, GetVBO() );
+		// Orphan the buffer
+		glBufferData( GL_ARRAY_BUFFER, vertices.size() * sizeof( Vertex ), nullptr, GL_DYNAMIC_DRAW );
+		// Upload the data
+		glBufferSubData( GL_ARRAY_BUFFER, 0, vertices.size() * sizeof( Vertex ), vertices.data() );
+		RenderStats::AddVertexUpload( vertices.size(), vertices.size() * sizeof( Vertex ) );
+		glBindBuffer( GL_ARRAY_BUFFER, 0 );
+	}
 }
 
 TextBatchRenderer::TextBatchRenderer()
-	: Batcher( false )
+	: Batcher( true )
 {
 	Initialize();
 }
 
 void TextBatchRenderer::End()
 {
-	if ( m_Glyphs.empty() )
-		return;
+	if ( !m_Glyphs.empty() )
+		GenerateBatches();
 
-	GenerateBatches();
+	m_LayoutCache.EndFrame();
 }
 
 void TextBatchRenderer::Render()
@@ -217,12 +112,16 @@ void TextBatchRenderer::Render()
 	if ( m_Batches.empty() )
 		return;
 
+	SCION_GPU_ZONE( "TextBatchRenderer::Render" );
+
 	EnableVAO();
 	for ( const auto& batch : m_Batches )
 	{
 		glActiveTexture( GL_TEXTURE0 );
 		glBindTexture( GL_TEXTURE_2D, batch->fontAtlasID );
-		glDrawArrays( GL_TRIANGLES, batch->offset, batch->numVertices );
+		glDrawElements(
+			GL_TRIANGLES, batch->numIndices, GL_UNSIGNED_INT, (void*)( sizeof( GLuint ) * batch->offset ) );
+		RenderStats::AddDrawCall( batch->numIndices );
 	}
 	DisableVAO();
 }
@@ -230,23 +129,36 @@ void TextBatchRenderer::Render()
 void TextBatchRenderer::AddText( const std::string& text, const std::shared_ptr<Font>& font, const glm::vec2& position,
 								 int padding, float wrap, Color color, glm::mat4 model )
 {
-	if ( !font )
+	if ( !font || text.empty() )
+		return;
+
+	AddText( m_LayoutCache.GetLayout( text, font, wrap, padding ), position, color, model );
+}
+
+void TextBatchRenderer::AddText( const std::shared_ptr<const TextLayout>& pLayout, const glm::vec2& position,
+								 Color color, glm::mat4 model )
+{
+	if ( !pLayout || pLayout->glyphs.empty() )
 		return;
 
 	// clang-format off
 	m_Glyphs.emplace_back(
 		std::make_unique<TextGlyph>(
 			TextGlyph{
-				.textStr = text,
+				.pLayout = pLayout,
 				.position = position,
 				.color = color,
-				.model = model,
-				.font = font,
-				.wrap = wrap,
-				.padding = padding
+				.model = model
 			}
 		)
 	);
 	// clang-format on
 }
-} // namespace Scion::Rendering
+
+std::shared_ptr<const TextLayout> TextBatchRenderer::GetTextLayout( const std::string& text,
+																	const std::shared_ptr<Font>& font, int padding,
+																	float wrap )
+{
+	return m_LayoutCache.GetLayout( text, font, wrap, padding );
+}
+} // namespace Scion::Rendering
\ No newline at end of file
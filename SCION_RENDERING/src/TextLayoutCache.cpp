@@ -0,0 +1,237 @@
+#include "Rendering/Core/TextLayoutCache.h"
+#include <Logger/Logger.h>
+#include <cctype>
+
+/* If the loop is more that 100, fail and let the user know. */
+constexpr int MAX_LOOP_FAIL_CHECK = 100;
+constexpr float MIN_TEXT_WRAP = 100.f;
+/* Number of frames a layout can go unused before it is evicted. */
+constexpr std::uint64_t MAX_UNUSED_FRAMES = 120;
+
+namespace Scion::Rendering
+{
+namespace
+{
+/*
+ * @brief Decodes the UTF-8 sequence at the index and moves the index past it.
+ * Invalid sequences decode to the replacement character.
+ */
+std::uint32_t DecodeUTF8( const std::string& sText, std::size_t& index )
+{
+	constexpr std::uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+	const auto lead = static_cast<unsigned char>( sText[ index++ ] );
+	if ( lead < 0x80 )
+		return lead;
+
+	std::size_t numContinuation{ 0 };
+	std::uint32_t codepoint{ 0 };
+	if ( ( lead & 0xE0 ) == 0xC0 )
+	{
+		numContinuation = 1;
+		codepoint = lead & 0x1F;
+	}
+	else if ( ( lead & 0xF0 ) == 0xE0 )
+	{
+		numContinuation = 2;
+		codepoint = lead & 0x0F;
+	}
+	else if ( ( lead & 0xF8 ) == 0xF0 )
+	{
+		numContinuation = 3;
+		codepoint = lead & 0x07;
+	}
+	else
+	{
+		return REPLACEMENT_CHARACTER;
+	}
+
+	for ( std::size_t i = 0; i < numContinuation; ++i )
+	{
+		if ( index >= sText.size() || ( static_cast<unsigned char>( sText[ index ] ) & 0xC0 ) != 0x80 )
+			return REPLACEMENT_CHARACTER;
+
+		codepoint = ( codepoint << 6 ) | ( static_cast<unsigned char>( sText[ index++ ] ) & 0x3F );
+	}
+
+	return codepoint;
+}
+} // namespace
+
+std::size_t TextLayoutCache::LayoutKeyHasher::operator()( const LayoutKey& key ) const
+{
+	std::size_t seed = key.textHash;
+	auto combine = [ &seed ]( std::size_t value ) { seed ^= value + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 ); };
+
+	combine( std::hash<const Font*>{}( key.pFont ) );
+	combine( std::hash<GLuint>{}( key.fontAtlasID ) );
+	combine( std::hash<float>{}( key.wrap ) );
+	combine( std::hash<int>{}( key.padding ) );
+
+	return seed;
+}
+
+std::shared_ptr<const TextLayout> TextLayoutCache::GetLayout( const std::string& sText,
+															  const std::shared_ptr<Font>& pFont, float wrap,
+															  int padding )
+{
+	if ( !pFont )
+		return nullptr;
+
+	const LayoutKey key{ .textHash = std::hash<std::string>{}( sText ),
+						 .pFont = pFont.get(),
+						 .fontAtlasID = pFont->GetFontAtlasID(),
+						 .wrap = wrap,
+						 .padding = padding };
+
+	auto& entry = m_mapLayouts[ key ];
+	entry.lastUsedFrame = m_CurrentFrame;
+
+	if ( !entry.pLayout || entry.sText != sText || entry.pLayout->IsStale( *pFont ) )
+	{
+		entry.sText = sText;
+
+		// The shelves used by the layout are pinned while it is shaped, its glyphs can not evict each other.
+		pFont->BeginShaping();
+		auto pLayout = CreateLayout( sText, *pFont, wrap, padding );
+		pLayout->atlasShelves = pFont->EndShaping();
+		entry.pLayout = std::move( pLayout );
+	}
+
+	return entry.pLayout;
+}
+
+void TextLayoutCache::EndFrame()
+{
+	std::erase_if( m_mapLayouts, [ this ]( const auto& keyEntry ) {
+		return m_CurrentFrame - keyEntry.second.lastUsedFrame > MAX_UNUSED_FRAMES;
+	} );
+
+	++m_CurrentFrame;
+}
+
+std::shared_ptr<TextLayout> TextLayoutCache::CreateLayout( const std::string& sText, Font& font, float wrap,
+														   int padding )
+{
+	auto pLayout = std::make_shared<TextLayout>( TextLayout{ .pFont = &font,
+															 .fontAtlasID = font.GetFontAtlasID(),
+															 .wrap = wrap,
+															 .padding = padding } );
+
+	std::vector<std::string> textChunks{};
+	std::string text_holder{};
+	glm::vec2 temp_pos{ 0.f };
+	auto fontSize = font.GetFontSize();
+	int infiniteLoopCheck{ 0 };
+
+	if ( wrap > MIN_TEXT_WRAP )
+	{
+		// Create the text chunks for each line.
+		for ( int i = 0; i < sText.size(); i++ )
+		{
+			if ( infiniteLoopCheck >= MAX_LOOP_FAIL_CHECK )
+			{
+				SCION_ERROR( "Failed to create text layout correctly. Please check your text wrap, padding, textStr, etc." );
+				return pLayout;
+			}
+
+			auto character = sText[ i ];
+			text_holder += character;
+			bool bNewLine = character == '\n';
+			size_t text_size = text_holder.size();
+			// Move the temp_pos with each character
+			font.GetNextCharPos( character, temp_pos );
+
+			if ( text_size > 0 && ( temp_pos.x > wrap || character == '\0' || bNewLine ) )
+			{
+				if ( !bNewLine )
+				{
+					// if not an end mark, pop off the character
+					while ( sText[ i ] != ' ' && sText[ i ] != '.' && sText[ i ] != '!' && sText[ i ] != '?' &&
+							text_size > 0 )
+					{
+						i--;
+						infiniteLoopCheck++;
+
+						if ( i < 0 )
+						{
+							SCION_ERROR( "Failed to draw text [{}] - Wrap [{}] is too small for the text to wrap "
+										 "successfully!",
+										 sText,
+										 wrap );
+							return pLayout;
+						}
+
+						if ( !text_holder.empty() )
+						{
+							text_holder.pop_back();
+							text_size = text_holder.size();
+							temp_pos.x -= fontSize;
+						}
+					}
+				}
+				else
+				{
+					text_holder.pop_back(); // Pop off the newline character
+				}
+
+				if ( text_size > 0 )
+				{
+					if ( std::isalpha( text_holder[ 0 ] ) )
+					{
+						textChunks.push_back( text_holder );
+						temp_pos = glm::vec2{ 0.f };
+						text_holder.clear();
+						infiniteLoopCheck = 0;
+					}
+					else
+					{
+						text_holder.erase( 0, 1 );
+						temp_pos.x -= fontSize;
+					}
+				}
+			}
+		}
+
+		if ( !text_holder.empty() )
+		{
+			textChunks.push_back( text_holder );
+			text_holder.clear();
+		}
+	}
+	else // Push back the entire string
+	{
+		textChunks.push_back( sText );
+	}
+
+	// Reset the text position
+	temp_pos = glm::vec2{ 0.f };
+
+	std::size_t numGlyphs{ 0 };
+	for ( const auto& textStr : textChunks )
+		numGlyphs += textStr.size();
+
+	pLayout->glyphs.reserve( numGlyphs );
+
+	for ( const auto& textStr : textChunks )
+	{
+		if ( font.IsSDF() )
+		{
+			for ( std::size_t i = 0; i < textStr.size(); )
+				pLayout->glyphs.push_back( font.GetCodepointGlyph( DecodeUTF8( textStr, i ), temp_pos ) );
+		}
+		else
+		{
+			for ( const auto& character : textStr )
+				pLayout->glyphs.push_back( font.GetGlyph( character, temp_pos ) );
+		}
+
+		// Move to the next Line
+		temp_pos.x = 0.f;
+		temp_pos.y += fontSize + padding;
+	}
+
+	return pLayout;
+}
+
+} // namespace Scion::Rendering
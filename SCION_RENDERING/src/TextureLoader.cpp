@@ -1,5 +1,6 @@
 #include "Rendering/Essentials/TextureLoader.h"
 #include "Rendering/Essentials/IconInfo.h"
+#include "Rendering/Utils/NullGLContext.h"
 #include <Logger/Logger.h>
 
 #include <SOIL2/SOIL2.h>
@@ -84,6 +85,25 @@ bool TextureLoader::LoadFBTexture( GLuint& id, int& width, int& height )
 bool TextureLoader::LoadTextureFromMemory( const unsigned char* imageData, size_t length, GLuint& id, int& width,
 										   int& height, bool blended )
 {
+	// SOIL creates the texture through the real driver, there is none when running headless.
+	if ( NullGLContext::IsLoaded() )
+	{
+		int channels = 0;
+		unsigned char* image = SOIL_load_image_from_memory(
+			imageData, static_cast<int>( length ), &width, &height, &channels, SOIL_LOAD_RGBA );
+
+		if ( !image )
+		{
+			SCION_ERROR( "Failed to load texture from memory -- {}", SOIL_last_result() );
+			return false;
+		}
+
+		glGenTextures( 1, &id );
+		glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image );
+		SOIL_free_image_data( image );
+		return true;
+	}
+
 	id = SOIL_load_OGL_texture_from_memory( imageData, length, SOIL_LOAD_RGBA, SOIL_CREATE_NEW_ID, NULL );
 
 	if ( id == 0 )
@@ -153,21 +173,13 @@ bool TextureLoader::LoadIconTexture( const std::string& filepath, GLuint& id, in
 	{
 		width = 0;
 		height = 0;
-		
-		id = SOIL_load_OGL_texture_from_memory( imageData, static_cast<int>(size), SOIL_LOAD_RGBA, SOIL_CREATE_NEW_ID, NULL );
-		if (id == 0)
+
+		// Loading from memory also handles the headless path, where SOIL has no driver to create the texture with.
+		if ( !LoadTextureFromMemory( imageData, size, id, width, height, true ) )
 		{
 			SCION_ERROR( "Failed to load icon. Failed to decode PNG inside of ICO." );
 			return false;
 		}
-
-		// Get the width and height data from the texture
-		glBindTexture( GL_TEXTURE_2D, id );
-		glad_glGetTextureLevelParameteriv( id, 0, GL_TEXTURE_WIDTH, &width );
-		glad_glGetTextureLevelParameteriv( id, 0, GL_TEXTURE_HEIGHT, &height );
-
-		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
-		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
 	}
 	else
 	{
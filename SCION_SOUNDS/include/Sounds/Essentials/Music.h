@@ -1,6 +1,8 @@
 #pragma once
 #include <ScionUtilities/SDL_Wrappers.h>
 #include "SoundParams.h"
+#include "Sounds/MusicPlayer/MusicStream.h"
+#include <optional>
 
 namespace Scion::Sounds
 {
@@ -8,11 +10,18 @@ class Music
 {
   public:
 	Music( const SoundParams& params, MusicPtr pMusic );
+
+	/*
+	 * @brief Creates a streamed music. Nothing is read until the music is loaded, which happens the first time it
+	 * is played, and only a few blocks of the file are kept in memory while it is loaded.
+	 */
+	Music( const SoundParams& params, const MusicSource& source );
 	~Music() = default;
 
 	inline const std::string& GetName() const { return m_Params.name; }
 	inline const std::string& GetFilename() const { return m_Params.filename; }
 	inline const std::string& GetDescription() const { return m_Params.description; }
+	/* The duration of a streamed music is only known once it has been loaded. */
 	inline const double GetDuration() const { return m_Params.duration; }
 
 	inline Mix_Music* GetMusicPtr() const
@@ -22,8 +31,24 @@ class Music
 		return m_pMusic.get();
 	}
 
+	inline bool IsStreamed() const { return m_optSource.has_value(); }
+	inline bool IsLoaded() const { return m_pMusic != nullptr; }
+
+	/*
+	 * @brief Opens the stream of a streamed music. Music that is not streamed is always loaded.
+	 * @return Returns true if the music is loaded.
+	 */
+	bool Load();
+
+	/*
+	 * @brief Closes the stream of a streamed music, stopping it if it is playing.
+	 * Music that is not streamed is not unloaded.
+	 */
+	void Unload();
+
   private:
 	SoundParams m_Params{};
 	MusicPtr m_pMusic{ nullptr };
+	std::optional<MusicSource> m_optSource{ std::nullopt };
 };
 } // namespace Scion::Sounds
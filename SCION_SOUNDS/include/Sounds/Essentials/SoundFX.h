@@ -1,9 +1,13 @@
 #pragma once
 #include "SoundParams.h"
 #include <ScionUtilities/SDL_Wrappers.h>
+#include <algorithm>
+#include <memory>
 
 namespace Scion::Sounds
 {
+class PCMBuffer;
+
 class SoundFX
 {
   public:
@@ -14,6 +18,14 @@ class SoundFX
 	inline const std::string& GetDescription() const { return m_Params.description; }
 	inline const std::string& GetFilename() const { return m_Params.filename; }
 	inline const double GetDuration() const { return m_Params.duration; }
+
+	/* Higher priority sounds steal the voices of lower priority sounds when every voice is busy. */
+	inline int GetPriority() const { return m_Priority; }
+	inline void SetPriority( int priority ) { m_Priority = priority; }
+
+	/* The number of instances of the sound that can play at once, 0 for no limit. */
+	inline int GetMaxInstances() const { return m_MaxInstances; }
+	inline void SetMaxInstances( int maxInstances ) { m_MaxInstances = std::max( maxInstances, 0 ); }
 	inline Mix_Chunk* GetSoundFxPtr() const
 	{
 		if ( !m_pSoundFx )
@@ -21,8 +33,18 @@ class SoundFX
 		return m_pSoundFx.get();
 	}
 
+	/*
+	 * @brief Gets the samples of the sound for the software mixer. They are converted from the chunk the first time
+	 * this is called, since most sounds are only ever played through the SDL_mixer channels.
+	 * @return Returns the buffer, nullptr if the chunk could not be converted.
+	 */
+	std::shared_ptr<const PCMBuffer> GetPCMBuffer();
+
   private:
 	SoundParams m_Params;
 	SoundFxPtr m_pSoundFx;
+	int m_Priority;
+	int m_MaxInstances;
+	std::shared_ptr<const PCMBuffer> m_pPCMBuffer;
 };
 } // namespace Scion::Sounds
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace Scion::Sounds::MixKernels
+{
+/*
+ * The mix kernels work on interleaved stereo float samples. They use AVX when the build targets it,
+ * SSE2 on every other x86 build and plain loops elsewhere. None of them allocate, so they are safe to call
+ * from the audio callback.
+ */
+
+/* @brief Gets the name of the instruction set the kernels were built with. */
+const char* GetInstructionSet();
+
+/*
+ * @brief Adds the stereo frames of the input to the output, scaling the left and right samples by their gains.
+ * @param Takes the output and input samples, the number of stereo frames and the left and right gains.
+ */
+void MixStereo( float* pOut, const float* pIn, std::size_t numFrames, float gainLeft, float gainRight );
+
+/*
+ * @brief Adds the float samples to the signed 16 bit samples of the stream, clamping the result.
+ * @param Takes the stream, the float samples in the range [-1, 1] and the number of samples, not frames.
+ */
+void AddToS16( std::int16_t* pStream, const float* pMix, std::size_t numSamples );
+
+/*
+ * @brief Adds the float samples to the float samples of the stream.
+ * @param Takes the stream, the float samples and the number of samples, not frames.
+ */
+void AddToF32( float* pStream, const float* pMix, std::size_t numSamples );
+} // namespace Scion::Sounds::MixKernels
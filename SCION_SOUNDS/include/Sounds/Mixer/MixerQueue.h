@@ -0,0 +1,49 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace Scion::Sounds
+{
+/*
+ * MixerQueue
+ * A bounded, lock free queue for a single producer and a single consumer. The game thread pushes the mixer
+ * commands and the audio callback pops them, so neither of them ever waits on the other.
+ * The capacity must be a power of two.
+ */
+template <typename T, std::size_t Capacity>
+class MixerQueue
+{
+	static_assert( Capacity >= 2 && ( Capacity & ( Capacity - 1 ) ) == 0, "Capacity must be a power of two!" );
+
+  public:
+	MixerQueue();
+	~MixerQueue() = default;
+
+	MixerQueue( const MixerQueue& ) = delete;
+	MixerQueue& operator=( const MixerQueue& ) = delete;
+
+	/*
+	 * @brief Copies the value into the queue. This must only be called from the producer thread.
+	 * @return Returns false if the queue is full.
+	 */
+	bool TryPush( const T& value );
+
+	/*
+	 * @brief Copies the oldest value out of the queue. This must only be called from the consumer thread.
+	 * @return Returns false if the queue is empty.
+	 */
+	bool TryPop( T& value );
+
+  private:
+	/* Keeps the producer and consumer positions on separate cache lines. */
+	static constexpr std::size_t CACHE_LINE_SIZE = 64;
+	static constexpr std::size_t MASK = Capacity - 1;
+
+	std::array<T, Capacity> m_Values;
+	alignas( CACHE_LINE_SIZE ) std::atomic<std::size_t> m_Head;
+	alignas( CACHE_LINE_SIZE ) std::atomic<std::size_t> m_Tail;
+};
+} // namespace Scion::Sounds
+
+#include "MixerQueue.inl"
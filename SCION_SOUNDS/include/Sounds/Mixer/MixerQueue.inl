@@ -0,0 +1,39 @@
+#pragma once
+#include "MixerQueue.h"
+
+namespace Scion::Sounds
+{
+template <typename T, std::size_t Capacity>
+MixerQueue<T, Capacity>::MixerQueue()
+	: m_Values{}
+	, m_Head{ 0 }
+	, m_Tail{ 0 }
+{
+}
+
+template <typename T, std::size_t Capacity>
+bool MixerQueue<T, Capacity>::TryPush( const T& value )
+{
+	const std::size_t head = m_Head.load( std::memory_order_relaxed );
+	if ( head - m_Tail.load( std::memory_order_acquire ) == Capacity )
+		return false;
+
+	m_Values[ head & MASK ] = value;
+	// Publish the value, the consumer reads the head with acquire.
+	m_Head.store( head + 1, std::memory_order_release );
+	return true;
+}
+
+template <typename T, std::size_t Capacity>
+bool MixerQueue<T, Capacity>::TryPop( T& value )
+{
+	const std::size_t tail = m_Tail.load( std::memory_order_relaxed );
+	if ( tail == m_Head.load( std::memory_order_acquire ) )
+		return false;
+
+	value = m_Values[ tail & MASK ];
+	// Hand the slot back to the producer.
+	m_Tail.store( tail + 1, std::memory_order_release );
+	return true;
+}
+} // namespace Scion::Sounds
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+struct Mix_Chunk;
+
+namespace Scion::Sounds
+{
+/*
+ * PCMBuffer
+ * Decoded audio, stored as interleaved stereo float samples at the rate of the audio device, so the software mixer
+ * never has to convert or resample while mixing.
+ */
+class PCMBuffer
+{
+  public:
+	PCMBuffer( std::vector<float> samples, int sampleRate );
+	~PCMBuffer() = default;
+
+	/*
+	 * @brief Converts the samples of a chunk to float. SDL_mixer has already converted the chunk to the format of
+	 * the opened device, so this only has to read that format.
+	 * @return Returns the buffer, or nullptr if the device is not open or its format is not supported.
+	 */
+	static std::shared_ptr<PCMBuffer> CreateFromChunk( const Mix_Chunk& chunk );
+
+	inline const float* GetSamples() const { return m_Samples.data(); }
+	inline std::size_t GetNumFrames() const { return m_Samples.size() / 2; }
+	inline int GetSampleRate() const { return m_SampleRate; }
+
+  private:
+	std::vector<float> m_Samples;
+	int m_SampleRate;
+};
+} // namespace Scion::Sounds
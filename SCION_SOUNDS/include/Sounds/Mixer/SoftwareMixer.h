@@ -0,0 +1,181 @@
+#pragma once
+#include "MixerQueue.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Scion::Sounds
+{
+class PCMBuffer;
+
+/* The number of voices the software mixer can play at once. */
+constexpr std::size_t MAX_MIXER_VOICES = 64;
+/* The number of commands the game thread can queue between two audio callbacks. */
+constexpr std::size_t MIXER_COMMAND_CAPACITY = 256;
+/* The callback is mixed in blocks of this many frames, so the mix buffer never has to grow in the callback. */
+constexpr std::size_t MIXER_BLOCK_FRAMES = 1024;
+
+/* Identifies a voice of the software mixer. The slot is reused, the id is not. */
+using MixerVoiceID = std::uint32_t;
+constexpr MixerVoiceID INVALID_MIXER_VOICE = 0;
+
+struct MixerVoiceParams
+{
+	float gain{ 1.f };
+	/* -1 is fully left, 1 is fully right. Positional voices add the pan of their position to this. */
+	float pan{ 0.f };
+	/* Positional voices are attenuated and panned by their distance to the listener. */
+	bool bPositional{ false };
+	float x{ 0.f };
+	float y{ 0.f };
+	/* The voice is at full volume up to the min distance and silent past the max distance, in world units. */
+	float minDistance{ 64.f };
+	float maxDistance{ 1024.f };
+	/* The number of times the voice loops, -1 to loop until it is stopped. */
+	int loops{ 0 };
+};
+
+struct MixerStats
+{
+	int activeVoices{ 0 };
+	/* Voices that were not played, because every voice was busy. */
+	std::uint64_t numRejected{ 0 };
+	/* Commands that were lost, because the audio callback had not caught up with the queue. */
+	std::uint64_t numDroppedCommands{ 0 };
+};
+
+/*
+ * SoftwareMixer
+ * Mixes PCM buffers in the engine instead of through the SDL_mixer channels. The mixed voices are added to the
+ * output of SDL_mixer in its post mix callback, so music and channel sounds keep playing alongside them, and it runs
+ * on any SDL audio driver, including the dummy and disk drivers.
+ * The game thread never touches the voices that are mixing. It sends commands through a lock free queue, which the
+ * audio callback applies before mixing, and the callback reports the voices it finished through atomics.
+ */
+class SoftwareMixer
+{
+  public:
+	SoftwareMixer();
+	~SoftwareMixer();
+
+	SoftwareMixer( const SoftwareMixer& ) = delete;
+	SoftwareMixer& operator=( const SoftwareMixer& ) = delete;
+
+	/*
+	 * @brief Starts mixing into the post mix callback of SDL_mixer. The audio device must be open.
+	 * @return Returns false if the device is not open, or its format is not supported.
+	 */
+	bool Attach();
+	/*
+	 * @brief Stops mixing into the device. Once this returns, the callback is no longer running.
+	 * Unless the mix is driven manually, the voices that were playing are stopped.
+	 */
+	void Detach();
+	inline bool IsAttached() const { return m_bAttached; }
+
+	/*
+	 * @brief Lets voices play without a device, the caller is then responsible for calling Mix.
+	 */
+	inline void SetManualMix( bool bManualMix ) { m_bManualMix = bManualMix; }
+	/* @brief Checks if anything is mixing the voices, either the device or the caller. */
+	inline bool IsMixing() const { return m_bAttached || m_bManualMix; }
+
+	/*
+	 * @brief Starts playing the buffer on a free voice.
+	 * @return Returns the id of the voice, INVALID_MIXER_VOICE if every voice is busy or nothing is mixing.
+	 */
+	MixerVoiceID Play( std::shared_ptr<const PCMBuffer> pBuffer, const MixerVoiceParams& params );
+	void Stop( MixerVoiceID voiceId );
+	void StopAll();
+
+	/*
+	 * @brief Changes the gain, pan, position and distances of a playing voice. The loops are only read by Play.
+	 */
+	void SetParams( MixerVoiceID voiceId, const MixerVoiceParams& params );
+	/* @brief Gets the params of the voice, nullptr if the voice has finished. */
+	const MixerVoiceParams* GetParams( MixerVoiceID voiceId ) const;
+	bool IsPlaying( MixerVoiceID voiceId ) const;
+
+	/* @brief Sets the world position positional voices are heard from. */
+	void SetListener( float x, float y );
+
+	/*
+	 * @brief Releases the buffers of the voices the audio callback has finished. Should be called once every frame.
+	 */
+	void Update();
+
+	const MixerStats& GetStats();
+
+	/*
+	 * @brief Mixes the next frames of every voice into the buffer, overwriting it. Called from the audio callback,
+	 * but it does not need a device, so it can also be driven directly.
+	 * @param Takes interleaved stereo samples and the number of frames, at most MIXER_BLOCK_FRAMES.
+	 */
+	void Mix( float* pOut, std::size_t numFrames );
+
+  private:
+	enum class CommandType : std::uint8_t
+	{
+		Play,
+		Stop,
+		SetParams,
+		SetListener
+	};
+
+	struct Command
+	{
+		CommandType type{ CommandType::Play };
+		std::uint32_t slot{ 0 };
+		std::uint32_t generation{ 0 };
+		const PCMBuffer* pBuffer{ nullptr };
+		MixerVoiceParams params{};
+	};
+
+	/* The state of a voice, only used by the audio callback. */
+	struct MixVoice
+	{
+		const PCMBuffer* pBuffer{ nullptr };
+		std::uint32_t generation{ 0 };
+		std::size_t frame{ 0 };
+		int loopsLeft{ 0 };
+		MixerVoiceParams params{};
+	};
+
+	/* The state of a voice, only used by the game thread. Keeps the buffer alive while the voice plays. */
+	struct GameVoice
+	{
+		std::shared_ptr<const PCMBuffer> pBuffer{ nullptr };
+		std::uint32_t generation{ 0 };
+		MixerVoiceParams params{};
+	};
+
+	static void PostMix( void* pUserData, std::uint8_t* pStream, int length );
+
+	void ApplyCommands();
+	void FinishVoice( MixVoice& voice, std::uint32_t slot );
+	void MixVoiceFrames( MixVoice& voice, std::uint32_t slot, float* pOut, std::size_t numFrames );
+	bool PushCommand( const Command& command );
+	/* @brief Gets the slot of the voice, -1 if the id is stale. */
+	int GetSlot( MixerVoiceID voiceId ) const;
+
+  private:
+	MixerQueue<Command, MIXER_COMMAND_CAPACITY> m_Commands;
+	/* The audio callback stores the generation of each voice it finishes in the voice slot. */
+	std::array<std::atomic<std::uint32_t>, MAX_MIXER_VOICES> m_FinishedGenerations;
+
+	std::array<MixVoice, MAX_MIXER_VOICES> m_MixVoices;
+	float m_ListenerX;
+	float m_ListenerY;
+	std::vector<float> m_MixBuffer;
+	/* Set when the device uses float samples, otherwise it uses signed 16 bit samples. */
+	bool m_bFloatStream;
+
+	std::array<GameVoice, MAX_MIXER_VOICES> m_GameVoices;
+	std::uint32_t m_NextGeneration;
+	MixerStats m_Stats;
+	bool m_bAttached;
+	bool m_bManualMix;
+};
+} // namespace Scion::Sounds
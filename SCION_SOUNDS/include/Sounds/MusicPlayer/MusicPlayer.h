@@ -21,7 +21,7 @@ class MusicPlayer
 	~MusicPlayer();
 
 	/*
-	 * @brief Calls Mix_PlayMusic and tries to play the desired music
+	 * @brief Calls Mix_PlayMusic and tries to play the desired music. Streamed music is loaded first if needed.
 	 * @param Takes a Reference to the Music and the number loops to play
 	 * the music. Use '-1' to play music indefinitely.
 	 */
@@ -58,5 +58,14 @@ class MusicPlayer
 	 * @brief Returns true if the music is currently paused
 	 */
 	bool IsPaused();
+
+	/*
+	 * @brief Returns true if the music is the one playing or paused.
+	 */
+	bool IsCurrent( const class Music& music ) const;
+
+  private:
+	/* The last music that was played. Only compared against, it may have been freed since. */
+	const class Music* m_pCurrentMusic{ nullptr };
 };
 } // namespace Scion::Sounds
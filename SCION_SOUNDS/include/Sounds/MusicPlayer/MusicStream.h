@@ -0,0 +1,107 @@
+#pragma once
+#include <ScionUtilities/SDL_Wrappers.h>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace Scion::Sounds
+{
+/* The size of each block of compressed music the worker thread reads ahead. */
+constexpr std::size_t MUSIC_STREAM_BLOCK_SIZE = 64 * 1024;
+/* The number of blocks in the ring of each open stream. */
+constexpr std::size_t MUSIC_STREAM_NUM_BLOCKS = 4;
+
+/*
+ * MusicSource
+ * Where the compressed data of a streamed track is. Packaged games keep every track in one pack file,
+ * so the track can start anywhere in the file.
+ */
+struct MusicSource
+{
+	std::string sFilepath{};
+	/* The offset of the track in the file, in bytes. */
+	std::uint64_t offset{ 0 };
+	/* The size of the track in bytes. 0 reads to the end of the file. */
+	std::uint64_t size{ 0 };
+	/* The type of the track, MUS_NONE to let SDL_mixer detect it. */
+	Mix_MusicType eType{ MUS_NONE };
+};
+
+/*
+ * MusicStream
+ * Reads a track for SDL_mixer without loading it into memory. A worker thread keeps a small ring of blocks filled
+ * ahead of the position SDL_mixer decodes from, so the audio thread only copies from memory. It only waits on the
+ * file when it jumps to data that was not read ahead, such as when the track is opened or loops.
+ */
+class MusicStream
+{
+  public:
+	/*
+	 * @brief Opens a stream of the source and wraps it in the SDL_RWops SDL_mixer reads it through.
+	 * The stream is destroyed when the rwops is closed, so it can be passed to SDL_mixer with freesrc set.
+	 * @return Returns the rwops, or nullptr if the file could not be opened or is smaller than the source.
+	 */
+	static SDL_RWops* Open( const MusicSource& source );
+
+	~MusicStream();
+
+	MusicStream( const MusicStream& ) = delete;
+	MusicStream& operator=( const MusicStream& ) = delete;
+
+  private:
+	enum class EBlockState
+	{
+		Empty,
+		Pending,
+		Ready
+	};
+
+	struct Block
+	{
+		std::unique_ptr<unsigned char[]> pData{ nullptr };
+		/* The position of the block in the track. */
+		std::uint64_t start{ 0 };
+		std::size_t size{ 0 };
+		EBlockState eState{ EBlockState::Empty };
+	};
+
+	MusicStream( std::ifstream file, const MusicSource& source, std::uint64_t size );
+
+	/* @brief Copies the next bytes of the track. Called from the audio thread. */
+	std::size_t Read( void* pDest, std::size_t numBytes );
+	/* @brief Moves the read position, whence is one of RW_SEEK_SET, RW_SEEK_CUR or RW_SEEK_END. */
+	std::int64_t Seek( std::int64_t offset, int whence );
+
+	/* @brief Gets the ready block that holds the position, nullptr if it has not been read. */
+	Block* FindBlock( std::uint64_t position );
+	bool IsPending( std::uint64_t position ) const;
+	/* @brief Drops the blocks that are behind the read position and queues the empty blocks to be read. */
+	void ScheduleBlocks();
+	/* @brief Reads the pending blocks from the file until the stream is closed. */
+	void ReadBlocks();
+
+  private:
+	std::ifstream m_File;
+	std::uint64_t m_Offset;
+	std::uint64_t m_Size;
+
+	std::mutex m_Mutex;
+	/* Wakes the worker when a block is queued or the stream is closed. */
+	std::condition_variable m_BlockQueued;
+	/* Wakes the audio thread when a block has been read. */
+	std::condition_variable m_BlockRead;
+	std::array<Block, MUSIC_STREAM_NUM_BLOCKS> m_Blocks;
+	std::uint64_t m_Position;
+	/* The position the next empty block will be read from. */
+	std::uint64_t m_NextRead;
+	bool m_bFailed;
+	bool m_bClosing;
+
+	std::thread m_Worker;
+};
+} // namespace Scion::Sounds
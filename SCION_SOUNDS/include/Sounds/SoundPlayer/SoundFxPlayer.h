@@ -1,4 +1,5 @@
 #pragma once
+#include "VoicePool.h"
 
 namespace Scion::Sounds
 {
@@ -9,20 +10,28 @@ class SoundFxPlayer
 	~SoundFxPlayer() = default;
 
 	/*
-	 * @brief Calls Mix_PlayChannel and tries to play the desired soundFx.
-	 * Assumes not looping and to play on any open channel.
+	 * @brief Tries to play the desired soundFx on a voice picked by the voice pool.
+	 * Assumes not looping.
 	 * @param A reference to the SoundFx to play.
 	 */
 	void Play( class SoundFX& soundFx );
 
 	/*
-	 * @brief Calls Mix_PlayChannel and tries to play the desired soundFx
+	 * @brief Tries to play the desired soundFx
 	 * @param A reference to the SoundFx to play.
 	 * @param An int for the number of times the soundFx should loop.
-	 * @param An int for the channel to play the music on. Pass in -1 to play on any open channel.
+	 * @param An int for the channel to play the music on. Pass in -1 to let the voice pool pick the channel.
+	 * A sound played on a specific channel is never stolen by the voice pool.
 	 */
 	void Play( class SoundFX& soundFx, int loops, int channel = -1 );
 
+	/*
+	 * @brief Starts a new frame for the voice pool. Should be called once every frame.
+	 */
+	inline void Update() { m_VoicePool.Update(); }
+
+	inline const VoicePoolStats& GetStats() { return m_VoicePool.GetStats(); }
+
 	/*
 	 * @brief Sets the volume for the specified sound channel
 	 * @param Takes in an int for the channel we want to set the volume.
@@ -43,5 +52,8 @@ class SoundFxPlayer
 	 * @param an int for the desired channel to check.
 	 */
 	bool IsPlaying( int channel );
+
+  private:
+	VoicePool m_VoicePool;
 };
 } // namespace Scion::Sounds
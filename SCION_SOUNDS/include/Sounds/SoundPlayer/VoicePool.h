@@ -0,0 +1,92 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Scion::Sounds
+{
+class SoundFX;
+
+/*
+ * The number of channels allocated when the mixer is opened. Matches the default of the audio config, which
+ * allocates more channels when a project asks for them.
+ */
+constexpr int DEFAULT_SOUND_CHANNELS = 8;
+
+/* Voices played on a specific channel use this priority, so they are never stolen. */
+constexpr int PINNED_VOICE_PRIORITY = std::numeric_limits<int>::max();
+
+struct VoicePoolStats
+{
+	/* The number of mixer channels the pool plays on. Follows the channels allocated by the audio config. */
+	int numChannels{ 0 };
+	int activeVoices{ 0 };
+	std::uint64_t numPlayed{ 0 };
+	/* Voices that were stopped to make room for a sound of a higher or equal priority. */
+	std::uint64_t numStolen{ 0 };
+	/* Sounds that were not played, because every voice had a higher priority. */
+	std::uint64_t numRejected{ 0 };
+	/* Sounds that were not played, because the same sound was already played this frame. */
+	std::uint64_t numDeduplicated{ 0 };
+};
+
+/*
+ * VoicePool
+ * Picks the SDL_mixer channel for each sound fx instead of letting Mix_PlayChannel fail once every channel is busy.
+ * When no channel is free, the voice with the lowest priority is stolen, the oldest one if several share the
+ * lowest priority. A sound with a max instance count steals its own oldest instance once the count is reached.
+ * Triggering the same sound several times in one frame only plays it once.
+ */
+class VoicePool
+{
+  public:
+	VoicePool();
+	~VoicePool() = default;
+
+	/*
+	 * @brief Starts a new frame, so sounds can be played again. Also picks up changes to the number of allocated
+	 * channels. Should be called once every frame.
+	 */
+	void Update();
+
+	/*
+	 * @brief Plays the sound on a free or stolen voice.
+	 * @param Takes the sound to play and the number of times to loop it.
+	 * @return Returns the channel the sound is played on, -1 if it was rejected, deduplicated or failed to play.
+	 */
+	int Play( SoundFX& soundFx, int loops );
+
+	/*
+	 * @brief Plays the sound on the given channel, stopping whatever was playing there.
+	 * The voice is pinned, so it is never stolen by the pool.
+	 * @return Returns true if the sound is playing.
+	 */
+	bool PlayOnChannel( SoundFX& soundFx, int loops, int channel );
+
+	/* @brief Gets the stats, with the number of active voices counted when this is called. */
+	const VoicePoolStats& GetStats();
+
+  private:
+	struct Voice
+	{
+		const SoundFX* pSoundFx{ nullptr };
+		int priority{ 0 };
+		/* When the voice was started, older voices have a lower value. */
+		std::uint64_t startOrder{ 0 };
+	};
+
+	/* @brief Resizes the voices to the number of allocated channels. */
+	void SyncChannels();
+	/* @brief Clears the voices of the channels that have finished playing. */
+	void RefreshVoices();
+	int FindVoice( const SoundFX& soundFx );
+	bool StartVoice( int channel, SoundFX& soundFx, int loops, int priority );
+
+  private:
+	std::vector<Voice> m_Voices;
+	/* The sounds that have been played this frame. */
+	std::vector<const SoundFX*> m_FrameSounds;
+	std::uint64_t m_NextStartOrder;
+	VoicePoolStats m_Stats;
+};
+} // namespace Scion::Sounds
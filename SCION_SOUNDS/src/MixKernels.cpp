@@ -0,0 +1,109 @@
+#include "Sounds/Mixer/MixKernels.h"
+
+#include <algorithm>
+
+#if defined( __AVX__ )
+#define SCION_MIX_AVX
+#include <immintrin.h>
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define SCION_MIX_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined( SCION_MIX_AVX ) && !defined( SCION_MIX_SSE2 )
+// AVX implies SSE2, the 16 bit conversion uses the SSE2 integer instructions.
+#define SCION_MIX_SSE2
+#endif
+
+namespace Scion::Sounds::MixKernels
+{
+const char* GetInstructionSet()
+{
+#if defined( SCION_MIX_AVX )
+	return "AVX";
+#elif defined( SCION_MIX_SSE2 )
+	return "SSE2";
+#else
+	return "Scalar";
+#endif
+}
+
+void MixStereo( float* pOut, const float* pIn, std::size_t numFrames, float gainLeft, float gainRight )
+{
+	const std::size_t numSamples = numFrames * 2;
+	std::size_t i{ 0 };
+
+#if defined( SCION_MIX_AVX )
+	// The samples are interleaved, so the gains alternate left, right.
+	const __m256 gains8 = _mm256_setr_ps( gainLeft, gainRight, gainLeft, gainRight, gainLeft, gainRight, gainLeft,
+										  gainRight );
+
+	for ( ; i + 8 <= numSamples; i += 8 )
+	{
+		const __m256 mixed = _mm256_add_ps( _mm256_loadu_ps( pOut + i ),
+											_mm256_mul_ps( _mm256_loadu_ps( pIn + i ), gains8 ) );
+		_mm256_storeu_ps( pOut + i, mixed );
+	}
+#endif
+
+#if defined( SCION_MIX_SSE2 )
+	const __m128 gains4 = _mm_setr_ps( gainLeft, gainRight, gainLeft, gainRight );
+
+	for ( ; i + 4 <= numSamples; i += 4 )
+	{
+		const __m128 mixed = _mm_add_ps( _mm_loadu_ps( pOut + i ), _mm_mul_ps( _mm_loadu_ps( pIn + i ), gains4 ) );
+		_mm_storeu_ps( pOut + i, mixed );
+	}
+#endif
+
+	for ( ; i < numSamples; i += 2 )
+	{
+		pOut[ i ] += pIn[ i ] * gainLeft;
+		pOut[ i + 1 ] += pIn[ i + 1 ] * gainRight;
+	}
+}
+
+void AddToS16( std::int16_t* pStream, const float* pMix, std::size_t numSamples )
+{
+	std::size_t i{ 0 };
+
+#if defined( SCION_MIX_SSE2 )
+	const __m128 scale = _mm_set1_ps( 32767.f );
+
+	for ( ; i + 8 <= numSamples; i += 8 )
+	{
+		// Convert with saturation, then add with saturation, so loud mixes clip instead of wrapping.
+		const __m128i low = _mm_cvtps_epi32( _mm_mul_ps( _mm_loadu_ps( pMix + i ), scale ) );
+		const __m128i high = _mm_cvtps_epi32( _mm_mul_ps( _mm_loadu_ps( pMix + i + 4 ), scale ) );
+		const __m128i mix = _mm_packs_epi32( low, high );
+
+		auto* pDest = reinterpret_cast<__m128i*>( pStream + i );
+		_mm_storeu_si128( pDest, _mm_adds_epi16( _mm_loadu_si128( pDest ), mix ) );
+	}
+#endif
+
+	for ( ; i < numSamples; ++i )
+	{
+		const float sample = pStream[ i ] + pMix[ i ] * 32767.f;
+		pStream[ i ] = static_cast<std::int16_t>( std::clamp( sample, -32768.f, 32767.f ) );
+	}
+}
+
+void AddToF32( float* pStream, const float* pMix, std::size_t numSamples )
+{
+	std::size_t i{ 0 };
+
+#if defined( SCION_MIX_AVX )
+	for ( ; i + 8 <= numSamples; i += 8 )
+		_mm256_storeu_ps( pStream + i, _mm256_add_ps( _mm256_loadu_ps( pStream + i ), _mm256_loadu_ps( pMix + i ) ) );
+#endif
+
+#if defined( SCION_MIX_SSE2 )
+	for ( ; i + 4 <= numSamples; i += 4 )
+		_mm_storeu_ps( pStream + i, _mm_add_ps( _mm_loadu_ps( pStream + i ), _mm_loadu_ps( pMix + i ) ) );
+#endif
+
+	for ( ; i < numSamples; ++i )
+		pStream[ i ] += pMix[ i ];
+}
+} // namespace Scion::Sounds::MixKernels
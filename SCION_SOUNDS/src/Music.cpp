@@ -1,7 +1,46 @@
 #include "Sounds/Essentials/Music.h"
+#include <Logger/Logger.h>
 
 Scion::Sounds::Music::Music( const SoundParams& params, MusicPtr pMusic )
 	: m_Params{ params }
 	, m_pMusic{ std::move( pMusic ) }
+	, m_optSource{ std::nullopt }
 {
 }
+
+Scion::Sounds::Music::Music( const SoundParams& params, const MusicSource& source )
+	: m_Params{ params }
+	, m_pMusic{ nullptr }
+	, m_optSource{ source }
+{
+}
+
+bool Scion::Sounds::Music::Load()
+{
+	if ( m_pMusic || !m_optSource )
+		return m_pMusic != nullptr;
+
+	SDL_RWops* pRWops = MusicStream::Open( *m_optSource );
+	if ( !pRWops )
+		return false;
+
+	// SDL_mixer closes the stream when the music is freed, or right away if it fails to load.
+	Mix_Music* pMusic = m_optSource->eType != MUS_NONE ? Mix_LoadMUSType_RW( pRWops, m_optSource->eType, 1 )
+													   : Mix_LoadMUS_RW( pRWops, 1 );
+	if ( !pMusic )
+	{
+		std::string error{ Mix_GetError() };
+		SCION_ERROR( "Failed to load streamed music [{}] -- Mixer Error: {}", m_Params.name, error );
+		return false;
+	}
+
+	m_pMusic = MusicPtr{ pMusic };
+	m_Params.duration = Mix_MusicDuration( pMusic );
+	return true;
+}
+
+void Scion::Sounds::Music::Unload()
+{
+	if ( m_optSource )
+		m_pMusic.reset();
+}
@@ -1,5 +1,6 @@
 #include "Sounds/MusicPlayer/MusicPlayer.h"
 #include "Sounds/Essentials/Music.h"
+#include "Sounds/SoundPlayer/VoicePool.h"
 #include <Logger/Logger.h>
 
 namespace Scion::Sounds
@@ -13,7 +14,7 @@ MusicPlayer::MusicPlayer()
 		SCION_ERROR( "Unable to open SDL Music Mixer - {}", error );
 		return;
 	}
-	SCION_LOG( "CHANNELS ALLOCATED [{}]", Mix_AllocateChannels( 16 ) );
+	SCION_LOG( "CHANNELS ALLOCATED [{}]", Mix_AllocateChannels( DEFAULT_SOUND_CHANNELS ) );
 
 	if ( ( Mix_Init( MIX_INIT_MP3 ) & MIX_INIT_MP3 ) == 0 )
 	{
@@ -31,7 +32,7 @@ MusicPlayer::~MusicPlayer()
 
 void MusicPlayer::Play( Music& music, int loops )
 {
-	if ( !music.GetMusicPtr() )
+	if ( !music.Load() )
 	{
 		SCION_ERROR( "Failed to play music [{}] - Mix Music was Null!", music.GetName() );
 		return;
@@ -41,7 +42,10 @@ void MusicPlayer::Play( Music& music, int loops )
 	{
 		std::string error{ Mix_GetError() };
 		SCION_ERROR( "Failed to play music [{}] Mix Error - {}", music.GetName(), error );
+		return;
 	}
+
+	m_pCurrentMusic = &music;
 }
 
 void MusicPlayer::Pause()
@@ -82,4 +86,9 @@ bool MusicPlayer::IsPaused()
 	return Mix_PausedMusic();
 }
 
+bool MusicPlayer::IsCurrent( const Music& music ) const
+{
+	return m_pCurrentMusic == &music && Mix_PlayingMusic();
+}
+
 } // namespace Scion::Sounds
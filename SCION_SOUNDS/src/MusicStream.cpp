@@ -0,0 +1,257 @@
+#include "Sounds/MusicPlayer/MusicStream.h"
+#include <Logger/Logger.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+namespace Scion::Sounds
+{
+SDL_RWops* MusicStream::Open( const MusicSource& source )
+{
+	std::error_code ec;
+	const auto fileSize = std::filesystem::file_size( source.sFilepath, ec );
+	if ( ec || source.offset > fileSize || source.size > fileSize - source.offset )
+	{
+		SCION_ERROR( "Failed to open music stream [{}] -- The file is missing or smaller than the track.",
+					 source.sFilepath );
+		return nullptr;
+	}
+
+	std::ifstream file{ source.sFilepath, std::ios::in | std::ios::binary };
+	if ( !file.is_open() )
+	{
+		SCION_ERROR( "Failed to open music stream [{}].", source.sFilepath );
+		return nullptr;
+	}
+
+	SDL_RWops* pRWops = SDL_AllocRW();
+	if ( !pRWops )
+	{
+		SCION_ERROR( "Failed to open music stream [{}] -- {}", source.sFilepath, SDL_GetError() );
+		return nullptr;
+	}
+
+	const std::uint64_t size = source.size > 0 ? source.size : fileSize - source.offset;
+
+	pRWops->type = SDL_RWOPS_UNKNOWN;
+	pRWops->hidden.unknown.data1 = new MusicStream{ std::move( file ), source, size };
+
+	pRWops->size = []( SDL_RWops* pContext ) -> Sint64 {
+		return static_cast<Sint64>( static_cast<MusicStream*>( pContext->hidden.unknown.data1 )->m_Size );
+	};
+
+	pRWops->seek = []( SDL_RWops* pContext, Sint64 offset, int whence ) -> Sint64 {
+		return static_cast<MusicStream*>( pContext->hidden.unknown.data1 )->Seek( offset, whence );
+	};
+
+	pRWops->read = []( SDL_RWops* pContext, void* pDest, size_t size, size_t maxNum ) -> size_t {
+		if ( size == 0 )
+			return 0;
+
+		auto* pStream = static_cast<MusicStream*>( pContext->hidden.unknown.data1 );
+		return pStream->Read( pDest, size * maxNum ) / size;
+	};
+
+	pRWops->write = []( SDL_RWops*, const void*, size_t, size_t ) -> size_t {
+		SDL_SetError( "Music streams are read only." );
+		return 0;
+	};
+
+	pRWops->close = []( SDL_RWops* pContext ) -> int {
+		delete static_cast<MusicStream*>( pContext->hidden.unknown.data1 );
+		SDL_FreeRW( pContext );
+		return 0;
+	};
+
+	return pRWops;
+}
+
+MusicStream::MusicStream( std::ifstream file, const MusicSource& source, std::uint64_t size )
+	: m_File{ std::move( file ) }
+	, m_Offset{ source.offset }
+	, m_Size{ size }
+	, m_Mutex{}
+	, m_BlockQueued{}
+	, m_BlockRead{}
+	, m_Blocks{}
+	, m_Position{ 0 }
+	, m_NextRead{ 0 }
+	, m_bFailed{ false }
+	, m_bClosing{ false }
+	, m_Worker{}
+{
+	for ( auto& block : m_Blocks )
+		block.pData = std::make_unique<unsigned char[]>( MUSIC_STREAM_BLOCK_SIZE );
+
+	// Start reading the beginning of the track, SDL_mixer reads the header as soon as it is opened.
+	ScheduleBlocks();
+	m_Worker = std::thread{ &MusicStream::ReadBlocks, this };
+}
+
+MusicStream::~MusicStream()
+{
+	{
+		std::lock_guard lock{ m_Mutex };
+		m_bClosing = true;
+	}
+
+	m_BlockQueued.notify_one();
+	if ( m_Worker.joinable() )
+		m_Worker.join();
+}
+
+std::size_t MusicStream::Read( void* pDest, std::size_t numBytes )
+{
+	std::unique_lock lock{ m_Mutex };
+	auto* pOut = static_cast<unsigned char*>( pDest );
+	std::size_t numRead{ 0 };
+
+	while ( numRead < numBytes && m_Position < m_Size )
+	{
+		Block* pBlock = FindBlock( m_Position );
+		if ( !pBlock )
+		{
+			// The position was not read ahead, start reading from it instead.
+			if ( !IsPending( m_Position ) )
+			{
+				m_NextRead = m_Position;
+				for ( auto& block : m_Blocks )
+				{
+					if ( block.eState == EBlockState::Ready )
+						block.eState = EBlockState::Empty;
+				}
+			}
+
+			ScheduleBlocks();
+
+			// Wait for the next block to be read, then check again, it may have been queued for another position.
+			m_BlockRead.wait( lock );
+			if ( m_bFailed )
+				break;
+
+			continue;
+		}
+
+		const auto blockOffset = static_cast<std::size_t>( m_Position - pBlock->start );
+		const std::size_t count = std::min( numBytes - numRead, pBlock->size - blockOffset );
+		std::memcpy( pOut + numRead, pBlock->pData.get() + blockOffset, count );
+
+		numRead += count;
+		m_Position += count;
+	}
+
+	ScheduleBlocks();
+	return numRead;
+}
+
+std::int64_t MusicStream::Seek( std::int64_t offset, int whence )
+{
+	std::lock_guard lock{ m_Mutex };
+
+	std::int64_t position{ offset };
+	if ( whence == RW_SEEK_CUR )
+		position += static_cast<std::int64_t>( m_Position );
+	else if ( whence == RW_SEEK_END )
+		position += static_cast<std::int64_t>( m_Size );
+
+	if ( position < 0 )
+	{
+		SDL_SetError( "Seek before the start of the music stream." );
+		return -1;
+	}
+
+	m_Position = std::min( static_cast<std::uint64_t>( position ), m_Size );
+	return static_cast<std::int64_t>( m_Position );
+}
+
+MusicStream::Block* MusicStream::FindBlock( std::uint64_t position )
+{
+	auto itBlock = std::ranges::find_if( m_Blocks, [ position ]( const Block& block ) {
+		return block.eState == EBlockState::Ready && position >= block.start && position < block.start + block.size;
+	} );
+
+	return itBlock != m_Blocks.end() ? &*itBlock : nullptr;
+}
+
+bool MusicStream::IsPending( std::uint64_t position ) const
+{
+	return std::ranges::any_of( m_Blocks, [ position ]( const Block& block ) {
+		return block.eState == EBlockState::Pending && position >= block.start &&
+			   position < block.start + MUSIC_STREAM_BLOCK_SIZE;
+	} );
+}
+
+void MusicStream::ScheduleBlocks()
+{
+	bool bQueued{ false };
+
+	for ( auto& block : m_Blocks )
+	{
+		// Blocks behind the read position are done with, unless the track loops back to them.
+		if ( block.eState == EBlockState::Ready && block.start + block.size <= m_Position )
+			block.eState = EBlockState::Empty;
+
+		if ( block.eState != EBlockState::Empty || m_NextRead >= m_Size )
+			continue;
+
+		block.start = m_NextRead;
+		block.size = 0;
+		block.eState = EBlockState::Pending;
+		m_NextRead += MUSIC_STREAM_BLOCK_SIZE;
+		bQueued = true;
+	}
+
+	if ( bQueued )
+		m_BlockQueued.notify_one();
+}
+
+void MusicStream::ReadBlocks()
+{
+	std::unique_lock lock{ m_Mutex };
+
+	while ( !m_bClosing )
+	{
+		// Read the pending block nearest the start first, it is the one the audio thread needs next.
+		Block* pNext{ nullptr };
+		for ( auto& block : m_Blocks )
+		{
+			if ( block.eState == EBlockState::Pending && ( !pNext || block.start < pNext->start ) )
+				pNext = &block;
+		}
+
+		if ( !pNext )
+		{
+			m_BlockQueued.wait( lock );
+			continue;
+		}
+
+		const std::uint64_t start = pNext->start;
+		const auto size =
+			static_cast<std::size_t>( std::min<std::uint64_t>( MUSIC_STREAM_BLOCK_SIZE, m_Size - start ) );
+
+		// The block stays pending while it is read, so the audio thread does not touch its data.
+		lock.unlock();
+		m_File.seekg( static_cast<std::streamoff>( m_Offset + start ) );
+		m_File.read( reinterpret_cast<char*>( pNext->pData.get() ), static_cast<std::streamsize>( size ) );
+		const bool bFailed = m_File.gcount() != static_cast<std::streamsize>( size );
+		m_File.clear();
+		lock.lock();
+
+		if ( bFailed )
+		{
+			SCION_ERROR( "Failed to read music stream at [{}].", m_Offset + start );
+			m_bFailed = true;
+			pNext->eState = EBlockState::Empty;
+		}
+		else
+		{
+			pNext->size = size;
+			pNext->eState = EBlockState::Ready;
+		}
+
+		m_BlockRead.notify_all();
+	}
+}
+
+} // namespace Scion::Sounds
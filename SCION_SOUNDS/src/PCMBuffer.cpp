@@ -0,0 +1,59 @@
+#include "Sounds/Mixer/PCMBuffer.h"
+#include <ScionUtilities/SDL_Wrappers.h>
+#include <Logger/Logger.h>
+
+#include <cstring>
+
+namespace Scion::Sounds
+{
+PCMBuffer::PCMBuffer( std::vector<float> samples, int sampleRate )
+	: m_Samples{ std::move( samples ) }
+	, m_SampleRate{ sampleRate }
+{
+}
+
+std::shared_ptr<PCMBuffer> PCMBuffer::CreateFromChunk( const Mix_Chunk& chunk )
+{
+	int frequency{ 0 }, channels{ 0 };
+	Uint16 format{ 0 };
+	if ( Mix_QuerySpec( &frequency, &format, &channels ) == 0 )
+	{
+		SCION_ERROR( "Failed to create PCM buffer -- The audio device is not open." );
+		return nullptr;
+	}
+
+	if ( channels != 1 && channels != 2 )
+	{
+		SCION_ERROR( "Failed to create PCM buffer -- [{}] channels are not supported.", channels );
+		return nullptr;
+	}
+
+	if ( format != AUDIO_S16SYS && format != AUDIO_F32SYS )
+	{
+		SCION_ERROR( "Failed to create PCM buffer -- Audio format [{:#x}] is not supported.", format );
+		return nullptr;
+	}
+
+	const std::size_t bytesPerSample = SDL_AUDIO_BITSIZE( format ) / 8;
+	const std::size_t numFrames = chunk.alen / ( bytesPerSample * channels );
+	std::vector<float> samples( numFrames * 2 );
+
+	auto readSample = [ & ]( std::size_t index ) {
+		if ( format == AUDIO_S16SYS )
+			return reinterpret_cast<const Sint16*>( chunk.abuf )[ index ] / 32768.f;
+
+		float sample;
+		std::memcpy( &sample, chunk.abuf + index * sizeof( float ), sizeof( float ) );
+		return sample;
+	};
+
+	for ( std::size_t frame = 0; frame < numFrames; ++frame )
+	{
+		// Mono devices are mixed as stereo, with the same sample on both sides.
+		samples[ frame * 2 ] = readSample( frame * channels );
+		samples[ frame * 2 + 1 ] = readSample( frame * channels + channels - 1 );
+	}
+
+	return std::make_shared<PCMBuffer>( std::move( samples ), frequency );
+}
+} // namespace Scion::Sounds
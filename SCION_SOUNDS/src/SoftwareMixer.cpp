@@ -0,0 +1,385 @@
+#include "Sounds/Mixer/SoftwareMixer.h"
+#include "Sounds/Mixer/MixKernels.h"
+#include "Sounds/Mixer/PCMBuffer.h"
+#include <ScionUtilities/SDL_Wrappers.h>
+#include <Logger/Logger.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace
+{
+/* Ids keep the slot in the low bits and the generation in the rest. */
+constexpr std::uint32_t VOICE_SLOT_BITS = 8;
+constexpr std::uint32_t VOICE_SLOT_MASK = ( 1u << VOICE_SLOT_BITS ) - 1;
+constexpr std::uint32_t MAX_VOICE_GENERATION = ( 1u << ( 32 - VOICE_SLOT_BITS ) ) - 1;
+
+static_assert( Scion::Sounds::MAX_MIXER_VOICES <= VOICE_SLOT_MASK + 1, "Voice slots must fit in the id!" );
+
+/*
+ * @brief Gets the left and right gains of a voice. Positional voices fade out linearly between the min and max
+ * distance, and are panned by how far left or right of the listener they are.
+ */
+void GetVoiceGains( const Scion::Sounds::MixerVoiceParams& params, float listenerX, float listenerY, float& gainLeft,
+					float& gainRight )
+{
+	float gain = params.gain;
+	float pan = params.pan;
+
+	if ( params.bPositional )
+	{
+		const float dx = params.x - listenerX;
+		const float dy = params.y - listenerY;
+		const float distance = std::sqrt( dx * dx + dy * dy );
+		const float maxDistance = std::max( params.maxDistance, params.minDistance + 1.f );
+
+		if ( distance >= maxDistance )
+			gain = 0.f;
+		else if ( distance > params.minDistance )
+			gain *= 1.f - ( distance - params.minDistance ) / ( maxDistance - params.minDistance );
+
+		pan += dx / maxDistance;
+	}
+
+	// Constant power pan, scaled so a centered voice plays at its full gain on both sides.
+	const float angle = ( std::clamp( pan, -1.f, 1.f ) + 1.f ) * std::numbers::pi_v<float> * 0.25f;
+	gainLeft = std::cos( angle ) * std::numbers::sqrt2_v<float> * gain;
+	gainRight = std::sin( angle ) * std::numbers::sqrt2_v<float> * gain;
+}
+} // namespace
+
+namespace Scion::Sounds
+{
+SoftwareMixer::SoftwareMixer()
+	: m_Commands{}
+	, m_FinishedGenerations{}
+	, m_MixVoices{}
+	, m_ListenerX{ 0.f }
+	, m_ListenerY{ 0.f }
+	, m_MixBuffer( MIXER_BLOCK_FRAMES * 2, 0.f )
+	, m_bFloatStream{ false }
+	, m_GameVoices{}
+	, m_NextGeneration{ 1 }
+	, m_Stats{}
+	, m_bAttached{ false }
+	, m_bManualMix{ false }
+{
+	for ( auto& finished : m_FinishedGenerations )
+		finished.store( 0, std::memory_order_relaxed );
+}
+
+SoftwareMixer::~SoftwareMixer()
+{
+	Detach();
+}
+
+bool SoftwareMixer::Attach()
+{
+	if ( m_bAttached )
+		return true;
+
+	int frequency{ 0 }, channels{ 0 };
+	Uint16 format{ 0 };
+	if ( Mix_QuerySpec( &frequency, &format, &channels ) == 0 )
+	{
+		SCION_ERROR( "Failed to attach the software mixer -- The audio device is not open." );
+		return false;
+	}
+
+	if ( channels != 2 || ( format != AUDIO_S16SYS && format != AUDIO_F32SYS ) )
+	{
+		SCION_ERROR( "Failed to attach the software mixer -- Only stereo 16 bit or float devices are supported." );
+		return false;
+	}
+
+	m_bFloatStream = format == AUDIO_F32SYS;
+	Mix_SetPostMix( &SoftwareMixer::PostMix, this );
+	m_bAttached = true;
+
+	SCION_LOG( "Software mixer attached. [{}] Hz, [{}] kernels.", frequency, MixKernels::GetInstructionSet() );
+	return true;
+}
+
+void SoftwareMixer::Detach()
+{
+	if ( !m_bAttached )
+		return;
+
+	// SDL_mixer locks the device while replacing the callback, so it has returned by the time this does.
+	Mix_SetPostMix( nullptr, nullptr );
+	m_bAttached = false;
+
+	if ( m_bManualMix )
+		return;
+
+	// Nothing would finish the voices anymore. The callback has returned, so the queue can be drained here.
+	ApplyCommands();
+	for ( std::uint32_t slot = 0; slot < MAX_MIXER_VOICES; ++slot )
+	{
+		if ( m_MixVoices[ slot ].pBuffer )
+			FinishVoice( m_MixVoices[ slot ], slot );
+	}
+
+	Update();
+}
+
+MixerVoiceID SoftwareMixer::Play( std::shared_ptr<const PCMBuffer> pBuffer, const MixerVoiceParams& params )
+{
+	if ( !pBuffer )
+	{
+		SCION_ERROR( "Failed to play on the software mixer -- The PCM buffer was null." );
+		return INVALID_MIXER_VOICE;
+	}
+
+	// The voice would never finish, the device failed to attach, or is not supported.
+	if ( !IsMixing() )
+		return INVALID_MIXER_VOICE;
+
+	Update();
+
+	auto itVoice = std::ranges::find_if( m_GameVoices, []( const GameVoice& voice ) { return !voice.pBuffer; } );
+	if ( itVoice == m_GameVoices.end() )
+	{
+		++m_Stats.numRejected;
+		return INVALID_MIXER_VOICE;
+	}
+
+	const auto slot = static_cast<std::uint32_t>( std::distance( m_GameVoices.begin(), itVoice ) );
+	const std::uint32_t generation = m_NextGeneration;
+
+	if ( !PushCommand( Command{ .type = CommandType::Play,
+								.slot = slot,
+								.generation = generation,
+								.pBuffer = pBuffer.get(),
+								.params = params } ) )
+	{
+		return INVALID_MIXER_VOICE;
+	}
+
+	m_NextGeneration = m_NextGeneration == MAX_VOICE_GENERATION ? 1 : m_NextGeneration + 1;
+	*itVoice = GameVoice{ .pBuffer = std::move( pBuffer ), .generation = generation, .params = params };
+
+	return ( generation << VOICE_SLOT_BITS ) | slot;
+}
+
+void SoftwareMixer::Stop( MixerVoiceID voiceId )
+{
+	const int slot = GetSlot( voiceId );
+	if ( slot == -1 )
+		return;
+
+	PushCommand( Command{ .type = CommandType::Stop,
+						  .slot = static_cast<std::uint32_t>( slot ),
+						  .generation = m_GameVoices[ slot ].generation } );
+}
+
+void SoftwareMixer::StopAll()
+{
+	for ( std::uint32_t slot = 0; slot < MAX_MIXER_VOICES; ++slot )
+	{
+		if ( m_GameVoices[ slot ].pBuffer )
+			Stop( ( m_GameVoices[ slot ].generation << VOICE_SLOT_BITS ) | slot );
+	}
+}
+
+void SoftwareMixer::SetParams( MixerVoiceID voiceId, const MixerVoiceParams& params )
+{
+	const int slot = GetSlot( voiceId );
+	if ( slot == -1 )
+		return;
+
+	auto& voice = m_GameVoices[ slot ];
+	if ( PushCommand( Command{ .type = CommandType::SetParams,
+							   .slot = static_cast<std::uint32_t>( slot ),
+							   .generation = voice.generation,
+							   .params = params } ) )
+	{
+		voice.params = params;
+	}
+}
+
+const MixerVoiceParams* SoftwareMixer::GetParams( MixerVoiceID voiceId ) const
+{
+	const int slot = GetSlot( voiceId );
+	return slot == -1 ? nullptr : &m_GameVoices[ slot ].params;
+}
+
+bool SoftwareMixer::IsPlaying( MixerVoiceID voiceId ) const
+{
+	return GetSlot( voiceId ) != -1;
+}
+
+void SoftwareMixer::SetListener( float x, float y )
+{
+	if ( !IsMixing() )
+		return;
+
+	PushCommand( Command{ .type = CommandType::SetListener, .params = MixerVoiceParams{ .x = x, .y = y } } );
+}
+
+void SoftwareMixer::Update()
+{
+	for ( std::uint32_t slot = 0; slot < MAX_MIXER_VOICES; ++slot )
+	{
+		auto& voice = m_GameVoices[ slot ];
+		if ( voice.pBuffer &&
+			 m_FinishedGenerations[ slot ].load( std::memory_order_acquire ) == voice.generation )
+		{
+			voice.pBuffer.reset();
+		}
+	}
+}
+
+const MixerStats& SoftwareMixer::GetStats()
+{
+	Update();
+	m_Stats.activeVoices = static_cast<int>(
+		std::ranges::count_if( m_GameVoices, []( const GameVoice& voice ) { return voice.pBuffer != nullptr; } ) );
+
+	return m_Stats;
+}
+
+void SoftwareMixer::Mix( float* pOut, std::size_t numFrames )
+{
+	SCION_ASSERT( numFrames <= MIXER_BLOCK_FRAMES && "Mix blocks must not be larger than MIXER_BLOCK_FRAMES." );
+
+	ApplyCommands();
+	std::fill_n( pOut, numFrames * 2, 0.f );
+
+	for ( std::uint32_t slot = 0; slot < MAX_MIXER_VOICES; ++slot )
+	{
+		if ( m_MixVoices[ slot ].pBuffer )
+			MixVoiceFrames( m_MixVoices[ slot ], slot, pOut, numFrames );
+	}
+}
+
+void SoftwareMixer::PostMix( void* pUserData, std::uint8_t* pStream, int length )
+{
+	auto* pMixer = static_cast<SoftwareMixer*>( pUserData );
+	const std::size_t sampleSize = pMixer->m_bFloatStream ? sizeof( float ) : sizeof( std::int16_t );
+	const std::size_t numFrames = static_cast<std::size_t>( length ) / ( sampleSize * 2 );
+
+	for ( std::size_t frame = 0; frame < numFrames; frame += MIXER_BLOCK_FRAMES )
+	{
+		const std::size_t blockFrames = std::min( MIXER_BLOCK_FRAMES, numFrames - frame );
+		pMixer->Mix( pMixer->m_MixBuffer.data(), blockFrames );
+
+		if ( pMixer->m_bFloatStream )
+		{
+			MixKernels::AddToF32(
+				reinterpret_cast<float*>( pStream ) + frame * 2, pMixer->m_MixBuffer.data(), blockFrames * 2 );
+		}
+		else
+		{
+			MixKernels::AddToS16(
+				reinterpret_cast<std::int16_t*>( pStream ) + frame * 2, pMixer->m_MixBuffer.data(), blockFrames * 2 );
+		}
+	}
+}
+
+void SoftwareMixer::ApplyCommands()
+{
+	Command command{};
+	while ( m_Commands.TryPop( command ) )
+	{
+		auto& voice = m_MixVoices[ command.slot ];
+
+		switch ( command.type )
+		{
+		case CommandType::Play:
+			voice = MixVoice{ .pBuffer = command.pBuffer,
+							  .generation = command.generation,
+							  .frame = 0,
+							  .loopsLeft = command.params.loops,
+							  .params = command.params };
+			break;
+		case CommandType::Stop:
+			if ( voice.pBuffer && voice.generation == command.generation )
+				FinishVoice( voice, command.slot );
+			break;
+		case CommandType::SetParams:
+			if ( voice.pBuffer && voice.generation == command.generation )
+				voice.params = command.params;
+			break;
+		case CommandType::SetListener:
+			m_ListenerX = command.params.x;
+			m_ListenerY = command.params.y;
+			break;
+		}
+	}
+}
+
+void SoftwareMixer::FinishVoice( MixVoice& voice, std::uint32_t slot )
+{
+	voice.pBuffer = nullptr;
+	// Hands the slot back to the game thread, which releases the buffer on its next update.
+	m_FinishedGenerations[ slot ].store( voice.generation, std::memory_order_release );
+}
+
+void SoftwareMixer::MixVoiceFrames( MixVoice& voice, std::uint32_t slot, float* pOut, std::size_t numFrames )
+{
+	float gainLeft{ 0.f }, gainRight{ 0.f };
+	GetVoiceGains( voice.params, m_ListenerX, m_ListenerY, gainLeft, gainRight );
+
+	const std::size_t bufferFrames = voice.pBuffer->GetNumFrames();
+	std::size_t mixed{ 0 };
+
+	while ( mixed < numFrames )
+	{
+		if ( voice.frame >= bufferFrames )
+		{
+			if ( voice.loopsLeft == 0 || bufferFrames == 0 )
+			{
+				FinishVoice( voice, slot );
+				return;
+			}
+
+			if ( voice.loopsLeft > 0 )
+				--voice.loopsLeft;
+
+			voice.frame = 0;
+		}
+
+		const std::size_t count = std::min( numFrames - mixed, bufferFrames - voice.frame );
+
+		// Silent voices keep their place, so they come back in sync when they are in range again.
+		if ( gainLeft > 0.f || gainRight > 0.f )
+		{
+			MixKernels::MixStereo(
+				pOut + mixed * 2, voice.pBuffer->GetSamples() + voice.frame * 2, count, gainLeft, gainRight );
+		}
+
+		voice.frame += count;
+		mixed += count;
+	}
+}
+
+bool SoftwareMixer::PushCommand( const Command& command )
+{
+	if ( m_Commands.TryPush( command ) )
+		return true;
+
+	++m_Stats.numDroppedCommands;
+	return false;
+}
+
+int SoftwareMixer::GetSlot( MixerVoiceID voiceId ) const
+{
+	const std::uint32_t slot = voiceId & VOICE_SLOT_MASK;
+	const std::uint32_t generation = voiceId >> VOICE_SLOT_BITS;
+
+	if ( voiceId == INVALID_MIXER_VOICE || slot >= MAX_MIXER_VOICES )
+		return -1;
+
+	const auto& voice = m_GameVoices[ slot ];
+	if ( !voice.pBuffer || voice.generation != generation ||
+		 m_FinishedGenerations[ slot ].load( std::memory_order_acquire ) == generation )
+	{
+		return -1;
+	}
+
+	return static_cast<int>( slot );
+}
+
+} // namespace Scion::Sounds
@@ -1,7 +1,19 @@
 #include "Sounds/Essentials/SoundFX.h"
+#include "Sounds/Mixer/PCMBuffer.h"
 
 Scion::Sounds::SoundFX::SoundFX( const SoundParams& params, SoundFxPtr pSoundFx )
 	: m_Params{ params }
 	, m_pSoundFx{ std::move( pSoundFx ) }
+	, m_Priority{ 0 }
+	, m_MaxInstances{ 0 }
+	, m_pPCMBuffer{ nullptr }
 {
 }
+
+std::shared_ptr<const Scion::Sounds::PCMBuffer> Scion::Sounds::SoundFX::GetPCMBuffer()
+{
+	if ( !m_pPCMBuffer && m_pSoundFx )
+		m_pPCMBuffer = PCMBuffer::CreateFromChunk( *m_pSoundFx );
+
+	return m_pPCMBuffer;
+}
@@ -18,11 +18,10 @@ void SoundFxPlayer::Play( SoundFX& soundFx, int loops, int channel )
 		return;
 	}
 
-	if ( Mix_PlayChannel( channel, soundFx.GetSoundFxPtr(), loops ) == -1 )
-	{
-		std::string error{ Mix_GetError() };
-		SCION_ERROR( "Failed to play SoundFX[{}] on channel[{}] -- ERROR: {}", soundFx.GetName(), channel, error );
-	}
+	if ( channel == -1 )
+		m_VoicePool.Play( soundFx, loops );
+	else
+		m_VoicePool.PlayOnChannel( soundFx, loops, channel );
 }
 
 void SoundFxPlayer::SetVolume( int volume, int channel )
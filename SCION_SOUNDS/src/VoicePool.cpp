@@ -0,0 +1,155 @@
+#include "Sounds/SoundPlayer/VoicePool.h"
+#include "Sounds/Essentials/SoundFX.h"
+#include <Logger/Logger.h>
+
+#include <algorithm>
+
+namespace Scion::Sounds
+{
+VoicePool::VoicePool()
+	: m_Voices{}
+	, m_FrameSounds{}
+	, m_NextStartOrder{ 0 }
+	, m_Stats{}
+{
+}
+
+void VoicePool::Update()
+{
+	m_FrameSounds.clear();
+	SyncChannels();
+}
+
+int VoicePool::Play( SoundFX& soundFx, int loops )
+{
+	if ( std::ranges::find( m_FrameSounds, &soundFx ) != m_FrameSounds.end() )
+	{
+		++m_Stats.numDeduplicated;
+		return -1;
+	}
+
+	SyncChannels();
+	RefreshVoices();
+
+	const int channel = FindVoice( soundFx );
+	if ( channel == -1 )
+	{
+		++m_Stats.numRejected;
+		return -1;
+	}
+
+	const bool bStealing = m_Voices[ channel ].pSoundFx != nullptr;
+	if ( !StartVoice( channel, soundFx, loops, soundFx.GetPriority() ) )
+		return -1;
+
+	if ( bStealing )
+		++m_Stats.numStolen;
+
+	m_FrameSounds.push_back( &soundFx );
+	return channel;
+}
+
+bool VoicePool::PlayOnChannel( SoundFX& soundFx, int loops, int channel )
+{
+	SyncChannels();
+
+	if ( channel < 0 || channel >= static_cast<int>( m_Voices.size() ) )
+	{
+		SCION_ERROR( "Failed to play SoundFX[{}] -- Channel [{}] has not been allocated.", soundFx.GetName(), channel );
+		return false;
+	}
+
+	return StartVoice( channel, soundFx, loops, PINNED_VOICE_PRIORITY );
+}
+
+const VoicePoolStats& VoicePool::GetStats()
+{
+	SyncChannels();
+	RefreshVoices();
+
+	m_Stats.activeVoices = static_cast<int>(
+		std::ranges::count_if( m_Voices, []( const Voice& voice ) { return voice.pSoundFx != nullptr; } ) );
+
+	return m_Stats;
+}
+
+void VoicePool::SyncChannels()
+{
+	// Passing -1 gets the number of allocated channels without changing it.
+	const int numChannels = std::max( Mix_AllocateChannels( -1 ), 0 );
+	if ( numChannels != static_cast<int>( m_Voices.size() ) )
+		m_Voices.resize( numChannels );
+
+	m_Stats.numChannels = numChannels;
+}
+
+void VoicePool::RefreshVoices()
+{
+	for ( int i = 0; i < static_cast<int>( m_Voices.size() ); ++i )
+	{
+		if ( m_Voices[ i ].pSoundFx && Mix_Playing( i ) == 0 )
+			m_Voices[ i ] = Voice{};
+	}
+}
+
+int VoicePool::FindVoice( const SoundFX& soundFx )
+{
+	int freeVoice{ -1 }, lowestVoice{ -1 }, oldestInstance{ -1 }, numInstances{ 0 };
+
+	for ( int i = 0; i < static_cast<int>( m_Voices.size() ); ++i )
+	{
+		const auto& voice = m_Voices[ i ];
+		if ( !voice.pSoundFx )
+		{
+			if ( freeVoice == -1 )
+				freeVoice = i;
+
+			continue;
+		}
+
+		// Pinned voices belong to whoever picked the channel, they do not count towards any limits.
+		if ( voice.priority == PINNED_VOICE_PRIORITY )
+			continue;
+
+		if ( voice.pSoundFx == &soundFx )
+		{
+			++numInstances;
+			if ( oldestInstance == -1 || voice.startOrder < m_Voices[ oldestInstance ].startOrder )
+				oldestInstance = i;
+		}
+
+		if ( lowestVoice == -1 || voice.priority < m_Voices[ lowestVoice ].priority ||
+			 ( voice.priority == m_Voices[ lowestVoice ].priority &&
+			   voice.startOrder < m_Voices[ lowestVoice ].startOrder ) )
+		{
+			lowestVoice = i;
+		}
+	}
+
+	if ( soundFx.GetMaxInstances() > 0 && numInstances >= soundFx.GetMaxInstances() )
+		return oldestInstance;
+
+	if ( freeVoice != -1 )
+		return freeVoice;
+
+	if ( lowestVoice != -1 && m_Voices[ lowestVoice ].priority <= soundFx.GetPriority() )
+		return lowestVoice;
+
+	return -1;
+}
+
+bool VoicePool::StartVoice( int channel, SoundFX& soundFx, int loops, int priority )
+{
+	if ( Mix_PlayChannel( channel, soundFx.GetSoundFxPtr(), loops ) == -1 )
+	{
+		std::string error{ Mix_GetError() };
+		SCION_ERROR( "Failed to play SoundFX[{}] on channel[{}] -- ERROR: {}", soundFx.GetName(), channel, error );
+		return false;
+	}
+
+	m_Voices[ channel ] = Voice{ .pSoundFx = &soundFx, .priority = priority, .startOrder = m_NextStartOrder++ };
+	++m_Stats.numPlayed;
+	return true;
+}
+
+} // namespace Scion::Sounds
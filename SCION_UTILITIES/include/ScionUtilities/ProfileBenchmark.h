@@ -0,0 +1,24 @@
+#pragma once
+#include <cstdint>
+
+namespace Scion::Utilities
+{
+struct ProfileBenchmarkResult
+{
+	std::uint32_t numZones{ 0 };
+	/* The average cost of a zone recorded by SCION_PROFILE_SCOPE. */
+	double scopeNs{ 0.0 };
+	/* The average cost of a zone opened with a name returned by InternName, as scripts do with zone_name. */
+	double namedZoneNs{ 0.0 };
+	/* The average cost of a zone opened with a string, which interns the name on every call. */
+	double stringZoneNs{ 0.0 };
+};
+
+/*
+ * @brief Measures the cost of recording a zone by recording many empty zones on the calling thread.
+ * The profiler is enabled for the run and restored afterwards.
+ * @param Takes the number of zones recorded for each way of opening a zone.
+ * @return Returns the average cost of a zone for each way of opening it.
+ */
+ProfileBenchmarkResult RunProfileBenchmark( std::uint32_t numZones );
+} // namespace Scion::Utilities
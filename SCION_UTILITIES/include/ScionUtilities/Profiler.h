@@ -0,0 +1,215 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#define SCION_PROFILE_CONCAT_IMPL( a, b ) a##b
+#define SCION_PROFILE_CONCAT( a, b ) SCION_PROFILE_CONCAT_IMPL( a, b )
+
+#ifdef SCION_PROFILER
+/*
+ * @brief Times the rest of the enclosing scope as a zone with the given name.
+ * @param Takes the name of the zone. It must be a string literal, or outlive the profiler.
+ */
+#define SCION_PROFILE_SCOPE( name )                                                                                    \
+	Scion::Utilities::ProfileScope SCION_PROFILE_CONCAT( profileScope, __LINE__ ) { name }
+#define SCION_PROFILE_FUNCTION() SCION_PROFILE_SCOPE( __func__ )
+#define SCION_PROFILE_BEGIN_FRAME() Scion::Utilities::Profiler::GetInstance().BeginFrame()
+#define SCION_PROFILE_END_FRAME() Scion::Utilities::Profiler::GetInstance().EndFrame()
+#else
+#define SCION_PROFILE_SCOPE( name )
+#define SCION_PROFILE_FUNCTION()
+#define SCION_PROFILE_BEGIN_FRAME()
+#define SCION_PROFILE_END_FRAME()
+#endif
+
+namespace Scion::Utilities
+{
+/* The number of zones kept for each thread. Once full, the oldest zones are overwritten. */
+constexpr std::size_t PROFILE_EVENTS_PER_THREAD = 32768;
+
+struct ProfileEvent
+{
+	const char* sName{ nullptr };
+	std::uint64_t startNs{ 0 };
+	std::uint64_t endNs{ 0 };
+	/* The number of zones that were open on the thread when this zone started. */
+	std::uint32_t depth{ 0 };
+};
+
+struct ProfileNode
+{
+	const char* sName{ nullptr };
+	double totalMs{ 0.0 };
+	/* The time that was not spent in any of the child zones. */
+	double selfMs{ 0.0 };
+	std::uint32_t numCalls{ 0 };
+	std::uint32_t depth{ 0 };
+	/* Indices into the frame tree, -1 if there is none. */
+	int parent{ -1 };
+	int firstChild{ -1 };
+	int nextSibling{ -1 };
+};
+
+/*
+ * ProfileZoneName
+ * A zone name that has already been interned, zones opened with it skip the lookup of the name.
+ */
+struct ProfileZoneName
+{
+	const char* sName{ nullptr };
+};
+
+/*
+ * Profiler
+ * Records timed zones into a ring of events for each thread. Only the owning thread writes to its ring,
+ * so recording a zone does not take any locks. The zones of the thread that calls BeginFrame and EndFrame
+ * are merged into a tree each frame, and the zones of every thread can be exported as a chrome trace.
+ */
+class Profiler
+{
+  public:
+	static Profiler& GetInstance();
+
+	~Profiler() = default;
+	Profiler( const Profiler& ) = delete;
+	Profiler& operator=( const Profiler& ) = delete;
+
+	inline bool IsEnabled() const { return m_bEnabled.load( std::memory_order_relaxed ); }
+	inline void SetEnabled( bool bEnabled ) { m_bEnabled.store( bEnabled, std::memory_order_relaxed ); }
+
+	void BeginFrame();
+	void EndFrame();
+
+	/*
+	 * @brief Gets the zones of the last finished frame, merged by their call path.
+	 * The first node is the frame itself. The nodes are in depth first order.
+	 */
+	inline const std::vector<ProfileNode>& GetFrameTree() const { return m_FrameTree; }
+
+	/*
+	 * @brief Records a finished zone for the calling thread.
+	 */
+	void Record( const char* sName, std::uint64_t startNs, std::uint64_t endNs, std::uint32_t depth );
+
+	/*
+	 * @brief Opens and closes zones that are not tied to a C++ scope, such as the zones marked by scripts.
+	 * EndZone closes the last zone that was opened on the calling thread.
+	 */
+	void BeginZone( const std::string& sName );
+	void EndZone();
+
+	/*
+	 * @brief Opens a zone with a name returned by InternName, without looking the name up again.
+	 */
+	void BeginZone( ProfileZoneName zoneName );
+
+	/*
+	 * @brief Stores a copy of the name that lives as long as the profiler.
+	 * @return Returns the stored name. The same name always returns the same pointer.
+	 */
+	const char* InternName( const std::string& sName );
+
+	/*
+	 * @brief Writes the zones of every thread to a json file that can be opened in chrome://tracing or Perfetto.
+	 * @return Returns true if the file was written.
+	 */
+	bool WriteChromeTrace( const std::string& sFilepath );
+
+	/* @brief Gets the nanoseconds since the profiler was created. */
+	inline std::uint64_t Now() const
+	{
+		return static_cast<std::uint64_t>(
+			std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - m_StartTime )
+				.count() );
+	}
+
+	/* @brief Gets the number of zones that are open on the calling thread. */
+	static std::uint32_t& ThreadDepth();
+
+  private:
+	struct ThreadBuffer
+	{
+		std::unique_ptr<ProfileEvent[]> pEvents{ std::make_unique<ProfileEvent[]>( PROFILE_EVENTS_PER_THREAD ) };
+		/* The number of events ever written. Only the owning thread writes it. */
+		std::atomic<std::uint64_t> head{ 0 };
+		std::uint32_t index{ 0 };
+	};
+
+	Profiler();
+
+	ThreadBuffer& GetThreadBuffer();
+	void CopyEvents( const ThreadBuffer& buffer, std::uint64_t first, std::vector<ProfileEvent>& events ) const;
+	int FindOrAddChild( int parent, const char* sName );
+	void BuildFrameTree( double frameMs );
+
+  private:
+	const std::chrono::steady_clock::time_point m_StartTime;
+	std::atomic_bool m_bEnabled;
+
+	std::mutex m_ThreadsMutex;
+	std::vector<std::unique_ptr<ThreadBuffer>> m_ThreadBuffers;
+
+	std::mutex m_NamesMutex;
+	std::unordered_set<std::string> m_Names;
+
+	/* Only used by the thread that calls BeginFrame and EndFrame. */
+	ThreadBuffer* m_pFrameBuffer;
+	std::uint64_t m_FrameStartEvent;
+	std::uint64_t m_FrameStartNs;
+	/* The thread that runs the frames, named Main in the trace. */
+	int m_FrameThreadIndex;
+	std::vector<ProfileEvent> m_FrameEvents;
+	std::vector<ProfileNode> m_FrameTree;
+	std::vector<int> m_NodeStack;
+	std::vector<ProfileNode> m_SortedTree;
+	std::vector<int> m_NewIndices;
+};
+
+/*
+ * ProfileScope
+ * Records a zone from its construction to its destruction. Use the SCION_PROFILE_SCOPE macro instead,
+ * so the zone compiles out when the profiler is disabled.
+ */
+class ProfileScope
+{
+  public:
+	explicit ProfileScope( const char* sName )
+		: m_sName{ sName }
+		, m_StartNs{ 0 }
+		, m_Depth{ 0 }
+		, m_bActive{ Profiler::GetInstance().IsEnabled() }
+	{
+		if ( !m_bActive )
+			return;
+
+		m_Depth = Profiler::ThreadDepth()++;
+		m_StartNs = Profiler::GetInstance().Now();
+	}
+
+	~ProfileScope()
+	{
+		if ( !m_bActive )
+			return;
+
+		auto& profiler = Profiler::GetInstance();
+		const std::uint64_t endNs = profiler.Now();
+		--Profiler::ThreadDepth();
+		profiler.Record( m_sName, m_StartNs, endNs, m_Depth );
+	}
+
+	ProfileScope( const ProfileScope& ) = delete;
+	ProfileScope& operator=( const ProfileScope& ) = delete;
+
+  private:
+	const char* m_sName;
+	std::uint64_t m_StartNs;
+	std::uint32_t m_Depth;
+	bool m_bActive;
+};
+} // namespace Scion::Utilities
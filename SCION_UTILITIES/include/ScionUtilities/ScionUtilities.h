@@ -47,8 +47,13 @@ struct S2DAsset
 	std::optional<float> optFontSize{ std::nullopt };
 	/* Optional parameter if asset is a texture. */
 	std::optional<bool> optPixelArt{ std::nullopt };
+	/* Optional parameter if the asset is music. Packaged music is kept in the music pack at this offset. */
+	std::optional<std::uint64_t> optPackOffset{ std::nullopt };
 };
 
+/* The name of the file packaged music is kept in, next to the zipped assets. */
+constexpr const char* MUSIC_PACK_FILENAME = "ScionMusic.pak";
+
 /* Ensure the types that are passed in are associative map types. */
 template <typename T>
 concept MapType = std::same_as<T, std::map<typename T::key_type, typename T::mapped_type, typename T::key_compare,
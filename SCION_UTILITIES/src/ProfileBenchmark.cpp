@@ -0,0 +1,44 @@
+#include "ScionUtilities/ProfileBenchmark.h"
+#include "ScionUtilities/Profiler.h"
+
+#include <chrono>
+#include <string>
+
+namespace Scion::Utilities
+{
+ProfileBenchmarkResult RunProfileBenchmark( std::uint32_t numZones )
+{
+	if ( numZones == 0 )
+		return ProfileBenchmarkResult{};
+
+	auto& profiler = Profiler::GetInstance();
+	const bool bWasEnabled = profiler.IsEnabled();
+	profiler.SetEnabled( true );
+
+	auto timeZones = [ numZones ]( auto&& recordZone ) {
+		const auto start = std::chrono::steady_clock::now();
+		for ( std::uint32_t i = 0; i < numZones; ++i )
+			recordZone();
+
+		return std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - start ).count() /
+			   numZones;
+	};
+
+	const std::string sName{ "ProfileBenchmark" };
+	const ProfileZoneName zoneName{ profiler.InternName( sName ) };
+
+	ProfileBenchmarkResult result{ .numZones = numZones };
+	result.scopeNs = timeZones( [] { ProfileScope scope{ "ProfileBenchmark" }; } );
+	result.namedZoneNs = timeZones( [ & ] {
+		profiler.BeginZone( zoneName );
+		profiler.EndZone();
+	} );
+	result.stringZoneNs = timeZones( [ & ] {
+		profiler.BeginZone( sName );
+		profiler.EndZone();
+	} );
+
+	profiler.SetEnabled( bWasEnabled );
+	return result;
+}
+} // namespace Scion::Utilities
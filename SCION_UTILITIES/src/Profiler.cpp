@@ -0,0 +1,326 @@
+#include "ScionUtilities/Profiler.h"
+#include <Logger/Logger.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <fmt/format.h>
+
+namespace Scion::Utilities
+{
+namespace
+{
+/* A zone opened with BeginZone, waiting for its EndZone. */
+struct OpenZone
+{
+	const char* sName{ nullptr };
+	std::uint64_t startNs{ 0 };
+	std::uint32_t depth{ 0 };
+};
+
+thread_local std::vector<OpenZone> tl_OpenZones;
+
+void WriteJsonString( std::ofstream& file, const char* sValue )
+{
+	file << '"';
+	for ( const char* c = sValue; *c != '\0'; ++c )
+	{
+		switch ( *c )
+		{
+		case '"': file << "\\\""; break;
+		case '\\': file << "\\\\"; break;
+		case '\n': file << "\\n"; break;
+		case '\t': file << "\\t"; break;
+		default:
+			if ( static_cast<unsigned char>( *c ) >= 0x20 )
+				file << *c;
+			break;
+		}
+	}
+	file << '"';
+}
+} // namespace
+
+Profiler& Profiler::GetInstance()
+{
+	static Profiler instance{};
+	return instance;
+}
+
+Profiler::Profiler()
+	: m_StartTime{ std::chrono::steady_clock::now() }
+#ifdef SCION_PROFILER
+	, m_bEnabled{ true }
+#else
+	, m_bEnabled{ false }
+#endif
+	, m_ThreadBuffers{}
+	, m_Names{}
+	, m_pFrameBuffer{ nullptr }
+	, m_FrameStartEvent{ 0 }
+	, m_FrameStartNs{ 0 }
+	, m_FrameThreadIndex{ -1 }
+	, m_FrameEvents{}
+	, m_FrameTree{}
+	, m_NodeStack{}
+	, m_SortedTree{}
+	, m_NewIndices{}
+{
+}
+
+std::uint32_t& Profiler::ThreadDepth()
+{
+	thread_local std::uint32_t depth{ 0 };
+	return depth;
+}
+
+Profiler::ThreadBuffer& Profiler::GetThreadBuffer()
+{
+	thread_local ThreadBuffer* pBuffer{ nullptr };
+	if ( pBuffer )
+		return *pBuffer;
+
+	// The buffers are owned by the profiler, so the zones of threads that have exited can still be exported.
+	std::scoped_lock lock{ m_ThreadsMutex };
+	auto& buffer = m_ThreadBuffers.emplace_back( std::make_unique<ThreadBuffer>() );
+	buffer->index = static_cast<std::uint32_t>( m_ThreadBuffers.size() - 1 );
+	pBuffer = buffer.get();
+	return *pBuffer;
+}
+
+void Profiler::Record( const char* sName, std::uint64_t startNs, std::uint64_t endNs, std::uint32_t depth )
+{
+	auto& buffer = GetThreadBuffer();
+	const std::uint64_t head = buffer.head.load( std::memory_order_relaxed );
+
+	buffer.pEvents[ head % PROFILE_EVENTS_PER_THREAD ] =
+		ProfileEvent{ .sName = sName, .startNs = startNs, .endNs = endNs, .depth = depth };
+
+	buffer.head.store( head + 1, std::memory_order_release );
+}
+
+void Profiler::BeginZone( const std::string& sName )
+{
+	if ( !IsEnabled() )
+		return;
+
+	tl_OpenZones.push_back( OpenZone{ .sName = InternName( sName ), .startNs = Now(), .depth = ThreadDepth()++ } );
+}
+
+void Profiler::BeginZone( ProfileZoneName zoneName )
+{
+	if ( !IsEnabled() || !zoneName.sName )
+		return;
+
+	tl_OpenZones.push_back( OpenZone{ .sName = zoneName.sName, .startNs = Now(), .depth = ThreadDepth()++ } );
+}
+
+void Profiler::EndZone()
+{
+	if ( tl_OpenZones.empty() )
+		return;
+
+	const OpenZone zone = tl_OpenZones.back();
+	tl_OpenZones.pop_back();
+	--ThreadDepth();
+
+	Record( zone.sName, zone.startNs, Now(), zone.depth );
+}
+
+const char* Profiler::InternName( const std::string& sName )
+{
+	std::scoped_lock lock{ m_NamesMutex };
+	return m_Names.insert( sName ).first->c_str();
+}
+
+void Profiler::BeginFrame()
+{
+	if ( !IsEnabled() )
+		return;
+
+	m_pFrameBuffer = &GetThreadBuffer();
+	m_FrameThreadIndex = static_cast<int>( m_pFrameBuffer->index );
+	m_FrameStartEvent = m_pFrameBuffer->head.load( std::memory_order_relaxed );
+	m_FrameStartNs = Now();
+}
+
+void Profiler::EndFrame()
+{
+	if ( !IsEnabled() || !m_pFrameBuffer )
+		return;
+
+	const std::uint64_t frameEndNs = Now();
+
+	m_FrameEvents.clear();
+	CopyEvents( *m_pFrameBuffer, m_FrameStartEvent, m_FrameEvents );
+
+	// Zones that were opened before the frame began, such as the main loop itself, are not part of the frame.
+	std::erase_if( m_FrameEvents, [ this ]( const ProfileEvent& event ) { return event.startNs < m_FrameStartNs; } );
+
+	// Zones are recorded when they end, so sort them back into the order they started. Parents come first.
+	std::sort( m_FrameEvents.begin(), m_FrameEvents.end(), []( const ProfileEvent& a, const ProfileEvent& b ) {
+		return a.startNs < b.startNs || ( a.startNs == b.startNs && a.depth < b.depth );
+	} );
+
+	BuildFrameTree( ( frameEndNs - m_FrameStartNs ) / 1'000'000.0 );
+	m_pFrameBuffer = nullptr;
+}
+
+void Profiler::CopyEvents( const ThreadBuffer& buffer, std::uint64_t first, std::vector<ProfileEvent>& events ) const
+{
+	const std::uint64_t head = buffer.head.load( std::memory_order_acquire );
+	if ( head > PROFILE_EVENTS_PER_THREAD )
+		first = std::max( first, head - PROFILE_EVENTS_PER_THREAD );
+
+	const std::size_t firstCopied = events.size();
+	for ( std::uint64_t i = first; i < head; ++i )
+		events.push_back( buffer.pEvents[ i % PROFILE_EVENTS_PER_THREAD ] );
+
+	// Other threads keep recording while their events are copied. Drop any that were overwritten during the copy.
+	std::atomic_thread_fence( std::memory_order_acquire );
+	const std::uint64_t newHead = buffer.head.load( std::memory_order_relaxed );
+	if ( newHead > PROFILE_EVENTS_PER_THREAD && newHead - PROFILE_EVENTS_PER_THREAD > first )
+	{
+		const std::uint64_t firstValid = std::min( newHead - PROFILE_EVENTS_PER_THREAD, head );
+		events.erase( events.begin() + firstCopied, events.begin() + firstCopied + ( firstValid - first ) );
+	}
+}
+
+int Profiler::FindOrAddChild( int parent, const char* sName )
+{
+	int lastChild{ -1 };
+	for ( int child = m_FrameTree[ parent ].firstChild; child != -1; child = m_FrameTree[ child ].nextSibling )
+	{
+		const char* sChildName = m_FrameTree[ child ].sName;
+		if ( sChildName == sName || std::strcmp( sChildName, sName ) == 0 )
+			return child;
+
+		lastChild = child;
+	}
+
+	const int node = static_cast<int>( m_FrameTree.size() );
+	m_FrameTree.push_back(
+		ProfileNode{ .sName = sName, .depth = m_FrameTree[ parent ].depth + 1, .parent = parent } );
+
+	if ( lastChild == -1 )
+		m_FrameTree[ parent ].firstChild = node;
+	else
+		m_FrameTree[ lastChild ].nextSibling = node;
+
+	return node;
+}
+
+void Profiler::BuildFrameTree( double frameMs )
+{
+	m_FrameTree.clear();
+	m_FrameTree.push_back( ProfileNode{ .sName = "Frame", .totalMs = frameMs, .numCalls = 1 } );
+
+	m_NodeStack.clear();
+	m_NodeStack.push_back( 0 );
+
+	for ( const auto& event : m_FrameEvents )
+	{
+		// The stack holds the frame, followed by the open zone at each depth.
+		if ( m_NodeStack.size() > event.depth + 1 )
+			m_NodeStack.resize( event.depth + 1 );
+
+		const int node = FindOrAddChild( m_NodeStack.back(), event.sName );
+		m_FrameTree[ node ].totalMs += ( event.endNs - event.startNs ) / 1'000'000.0;
+		++m_FrameTree[ node ].numCalls;
+
+		m_NodeStack.push_back( node );
+	}
+
+	for ( auto& node : m_FrameTree )
+		node.selfMs = node.totalMs;
+
+	for ( std::size_t i = 1; i < m_FrameTree.size(); ++i )
+		m_FrameTree[ m_FrameTree[ i ].parent ].selfMs -= m_FrameTree[ i ].totalMs;
+
+	// Reorder the nodes depth first, so they can be drawn in a single pass.
+	auto& sortedTree = m_SortedTree;
+	sortedTree.clear();
+	auto& newIndices = m_NewIndices;
+	newIndices.assign( m_FrameTree.size(), -1 );
+
+	m_NodeStack.clear();
+	m_NodeStack.push_back( 0 );
+	while ( !m_NodeStack.empty() )
+	{
+		const int node = m_NodeStack.back();
+		m_NodeStack.pop_back();
+
+		newIndices[ node ] = static_cast<int>( sortedTree.size() );
+		sortedTree.push_back( m_FrameTree[ node ] );
+
+		// Push the children in reverse, so the first child is visited first.
+		const std::size_t firstPushed = m_NodeStack.size();
+		for ( int child = m_FrameTree[ node ].firstChild; child != -1; child = m_FrameTree[ child ].nextSibling )
+			m_NodeStack.push_back( child );
+
+		std::reverse( m_NodeStack.begin() + firstPushed, m_NodeStack.end() );
+	}
+
+	for ( auto& node : sortedTree )
+	{
+		if ( node.parent != -1 )
+			node.parent = newIndices[ node.parent ];
+		if ( node.firstChild != -1 )
+			node.firstChild = newIndices[ node.firstChild ];
+		if ( node.nextSibling != -1 )
+			node.nextSibling = newIndices[ node.nextSibling ];
+	}
+
+	std::swap( m_FrameTree, m_SortedTree );
+}
+
+bool Profiler::WriteChromeTrace( const std::string& sFilepath )
+{
+	std::ofstream traceFile{ sFilepath, std::ios::out | std::ios::trunc };
+	if ( !traceFile.is_open() )
+	{
+		SCION_ERROR( "Failed to open trace file [{}]", sFilepath );
+		return false;
+	}
+
+	std::vector<ProfileEvent> events;
+	bool bFirstEvent{ true };
+
+	traceFile << "{\"traceEvents\":[\n";
+
+	std::scoped_lock lock{ m_ThreadsMutex };
+	for ( const auto& pBuffer : m_ThreadBuffers )
+	{
+		if ( !bFirstEvent )
+			traceFile << ",\n";
+
+		bFirstEvent = false;
+		const std::string sThreadName{ static_cast<int>( pBuffer->index ) == m_FrameThreadIndex
+											? std::string{ "Main" }
+											: fmt::format( "Thread {}", pBuffer->index ) };
+		traceFile << fmt::format(
+			"{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}",
+			pBuffer->index,
+			sThreadName );
+
+		events.clear();
+		CopyEvents( *pBuffer, 0, events );
+
+		for ( const auto& event : events )
+		{
+			traceFile << ",\n{\"name\":";
+			WriteJsonString( traceFile, event.sName );
+			traceFile << fmt::format( ",\"cat\":\"scion\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},",
+									  event.startNs / 1000.0,
+									  ( event.endNs - event.startNs ) / 1000.0 )
+				  << fmt::format( "\"pid\":0,\"tid\":{}}}", pBuffer->index );
+		}
+	}
+
+	traceFile << "\n]}\n";
+
+	SCION_LOG( "Wrote profiler trace to [{}]", sFilepath );
+	return true;
+}
+
+} // namespace Scion::Utilities
@@ -0,0 +1,73 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace Scion::Windowing::Inputs
+{
+/*
+ * ButtonStates
+ * Stores the state of a fixed number of buttons as packed bitsets, indexed by a dense button index.
+ * A set bit in the changed bitset means that the button changed state this frame. Combined with the
+ * current state, that gives the just pressed and just released states without any per button structs.
+ * The index must be validated by the owner, it is not checked here.
+ */
+template <std::size_t NumButtons>
+class ButtonStates
+{
+  public:
+	static constexpr std::size_t NUM_BUTTONS = NumButtons;
+	static constexpr std::size_t NUM_WORDS = ( NumButtons + 63 ) / 64;
+
+	/*
+	 * @brief Sets the state of the button. Pressing an already pressed button,
+	 * or releasing an already released button, clears its just pressed/released state.
+	 */
+	inline void Update( std::size_t index, bool bPressed )
+	{
+		const std::size_t word = index >> 6;
+		const std::uint64_t mask = std::uint64_t{ 1 } << ( index & 63 );
+		const bool bWasPressed = ( m_Current[ word ] & mask ) != 0;
+
+		m_Changed[ word ] = bWasPressed != bPressed ? m_Changed[ word ] | mask : m_Changed[ word ] & ~mask;
+		m_Current[ word ] = bPressed ? m_Current[ word ] | mask : m_Current[ word ] & ~mask;
+	}
+
+	/*
+	 * @brief Clears the just pressed/released states for a new frame.
+	 */
+	inline void Reset() { m_Changed.fill( 0 ); }
+
+	inline bool IsPressed( std::size_t index ) const { return ( m_Current[ index >> 6 ] & Mask( index ) ) != 0; }
+
+	inline bool IsJustPressed( std::size_t index ) const
+	{
+		return ( m_Current[ index >> 6 ] & m_Changed[ index >> 6 ] & Mask( index ) ) != 0;
+	}
+
+	inline bool IsJustReleased( std::size_t index ) const
+	{
+		return ( ~m_Current[ index >> 6 ] & m_Changed[ index >> 6 ] & Mask( index ) ) != 0;
+	}
+
+	/*
+	 * @brief Calls the function with the index of every pressed button.
+	 */
+	template <typename TFunc>
+	void ForEachPressed( TFunc&& func ) const
+	{
+		for ( std::size_t word = 0; word < NUM_WORDS; ++word )
+		{
+			for ( std::uint64_t bits = m_Current[ word ]; bits != 0; bits &= bits - 1 )
+				func( word * 64 + std::countr_zero( bits ) );
+		}
+	}
+
+  private:
+	static constexpr std::uint64_t Mask( std::size_t index ) { return std::uint64_t{ 1 } << ( index & 63 ); }
+
+  private:
+	std::array<std::uint64_t, NUM_WORDS> m_Current{};
+	std::array<std::uint64_t, NUM_WORDS> m_Changed{};
+};
+} // namespace Scion::Windowing::Inputs
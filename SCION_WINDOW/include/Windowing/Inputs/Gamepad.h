@@ -1,6 +1,6 @@
 #pragma once
 #include "GPButtons.h"
-#include "Button.h"
+#include "ButtonStates.h"
 #include <ScionUtilities/SDL_Wrappers.h>
 
 namespace Scion::Windowing::Inputs
@@ -17,6 +17,13 @@ class Gamepad
 	 * @param controller SDL2 controller handle (RAII wrapped).
 	 */
 	explicit Gamepad( Controller controller );
+
+	/**
+	 * @brief Constructs a virtual Gamepad that is not backed by a device.
+	 *
+	 * Its state is only driven by the events it is given, used when replaying recorded input.
+	 */
+	Gamepad();
 	~Gamepad() = default;
 
 	/**
@@ -138,11 +145,22 @@ class Gamepad
 	 */
 	inline const std::string& GetName() const { return m_sName; }
 
+	/**
+	 * @brief Checks if this gamepad is virtual and not backed by a device.
+	 *
+	 * @return true if there is no SDL controller behind this gamepad, false otherwise.
+	 */
+	inline const bool IsVirtual() const { return m_pController == nullptr; }
+
   private:
+	static constexpr int NUM_GP_BTNS = SDL_CONTROLLER_BUTTON_MAX;
+	static constexpr int NUM_GP_AXES = SDL_CONTROLLER_AXIS_MAX;
+	inline static bool IsValidBtn( int btn ) { return btn >= 0 && btn < NUM_GP_BTNS; }
+
 	Controller m_pController;
-	std::map<int, Button> m_mapButtons;
+	ButtonStates<NUM_GP_BTNS> m_Buttons;
 	SDL_JoystickID m_InstanceID;
-	std::map<Uint8, Sint16> m_mapAxisValues;
+	std::array<Sint16, NUM_GP_AXES> m_AxisValues;
 	Uint8 m_JoystickHatValue;
 	std::string m_sName;
 };
@@ -1,13 +1,15 @@
 #pragma once
 #include "Keys.h"
-#include "Button.h"
+#include "ButtonStates.h"
+#include <span>
+#include <vector>
 
 namespace Scion::Windowing::Inputs
 {
 class Keyboard
 {
   public:
-	Keyboard();
+	Keyboard() = default;
 	~Keyboard() = default;
 
 	/**
@@ -59,9 +61,40 @@ class Keyboard
 	 */
 	const bool IsKeyJustReleased( int key ) const;
 
-	const std::map<int, Button>& GetButtonMap() const { return m_mapButtons; }
+	/**
+	 * @brief Gets all of the keys that are currently pressed.
+	 *
+	 * @return A vector of the pressed key identifiers.
+	 */
+	std::vector<int> GetPressedKeys() const;
+
+	/**
+	 * @brief Checks many keys at once.
+	 *
+	 * Bit i of the result is set if keys[ i ] is pressed. Only the first 64 keys are checked.
+	 *
+	 * @param keys Key identifiers to check.
+	 * @param bJustPressed If true, checks if the keys were just pressed instead.
+	 * @return The packed results.
+	 */
+	std::uint64_t PressedMask( std::span<const int> keys, bool bJustPressed = false ) const;
+
+  private:
+	/*
+	 * SDL keycodes are either ASCII values or a scancode with SDLK_SCANCODE_MASK set.
+	 * The ASCII keys use the first 128 slots and the scancode keys use the slots after them.
+	 */
+	static constexpr std::size_t NUM_ASCII_KEYS = 128;
+	static constexpr std::size_t NUM_KEYS = NUM_ASCII_KEYS + SDL_NUM_SCANCODES;
+
+	/*
+	 * @brief Converts the key to its index in the key states.
+	 * @return Returns the index of the key, or -1 if the key is not valid.
+	 */
+	static int KeyToIndex( int key );
+	static int IndexToKey( std::size_t index );
 
   private:
-	std::map<int, Button> m_mapButtons;
+	ButtonStates<NUM_KEYS> m_Keys;
 };
 } // namespace Scion::Windowing::Inputs
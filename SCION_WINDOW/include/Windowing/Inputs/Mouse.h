@@ -1,5 +1,5 @@
 #pragma once
-#include "Button.h"
+#include "ButtonStates.h"
 #include "MouseButtons.h"
 
 namespace Scion::Windowing::Inputs
@@ -24,21 +24,33 @@ class Mouse
 	inline void SetMouseWheelY( int wheel ) { m_WheelY = wheel; }
 	inline void SetMouseMoving( bool moving ) { m_bMouseMoving = moving; }
 
+	/*
+	 * @brief Overrides the mouse screen position. Once set, GetMouseScreenPosition will no longer
+	 * query SDL. This is used when replaying recorded input.
+	 */
+	inline void OverrideScreenPosition( int x, int y )
+	{
+		m_X = x;
+		m_Y = y;
+		m_bPositionOverridden = true;
+	}
+
 	inline const int GetMouseWheelX() const { return m_WheelX; }
 	inline const int GetMouseWheelY() const { return m_WheelY; }
 	inline const bool IsMouseMoving() const { return m_bMouseMoving; }
 
   private:
-	std::map<int, Button> m_mapButtons{
-		{ SCION_MOUSE_LEFT, Button{} },
-		{ SCION_MOUSE_MIDDLE, Button{} },
-		{ SCION_MOUSE_RIGHT, Button{} },
-	};
+	/* SDL mouse buttons go from 1 to 5 (SDL_BUTTON_X2), index 0 is never used. */
+	static constexpr int NUM_MOUSE_BTNS = 8;
+	inline static bool IsValidBtn( int btn ) { return btn > 0 && btn < NUM_MOUSE_BTNS; }
+
+	ButtonStates<NUM_MOUSE_BTNS> m_Buttons;
 
 	int m_X{ 0 };
 	int m_Y{ 0 };
 	int m_WheelX{ 0 };
 	int m_WheelY{ 0 };
 	bool m_bMouseMoving{ false };
+	bool m_bPositionOverridden{ false };
 };
 } // namespace Scion::Windowing::Inputs
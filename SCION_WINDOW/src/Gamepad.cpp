@@ -6,27 +6,9 @@ namespace Scion::Windowing::Inputs
 
 Gamepad::Gamepad(Controller controller)
         : m_pController{std::move(controller)}
-        , m_mapButtons{
-            {SCION_GP_BTN_A, Button{}},
-            {SCION_GP_BTN_B, Button{}},
-            {SCION_GP_BTN_X, Button{}},
-            {SCION_GP_BTN_Y, Button{}},
-            {SCION_GP_BTN_BACK, Button{}},
-            {SCION_GP_BTN_GUIDE, Button{}},
-            {SCION_GP_BTN_START, Button{}},
-            {SCION_GP_BTN_LSTICK, Button{}},
-            {SCION_GP_BTN_RSTICK, Button{}},
-            {SCION_GP_BTN_LSHOULDER, Button{}},
-            {SCION_GP_BTN_RSHOULDER, Button{}},
-            {SCION_GP_BTN_DPAD_UP, Button{}},
-            {SCION_GP_BTN_DPAD_DOWN, Button{}},
-            {SCION_GP_BTN_DPAD_LEFT, Button{}},
-            {SCION_GP_BTN_DPAD_RIGHT, Button{}},
-        }
+        , m_Buttons{}
         , m_InstanceID{-1}
-        , m_mapAxisValues{
-            {0, 0}, {1, 0}, {2, 0}, {3, 0}, {4, 0}, {5, 0}
-        }
+        , m_AxisValues{}
         , m_JoystickHatValue{SCION_HAT_CENTERED}
 {
 	SDL_Joystick* joystick = SDL_GameControllerGetJoystick( m_pController.get() );
@@ -49,105 +31,83 @@ Gamepad::Gamepad(Controller controller)
 	SCION_LOG( "Gamepad num buttons: {}", num_buttons );
 }
 
+Gamepad::Gamepad()
+	: m_pController{ nullptr }
+	, m_Buttons{}
+	, m_InstanceID{ -1 }
+	, m_AxisValues{}
+	, m_JoystickHatValue{ SCION_HAT_CENTERED }
+	, m_sName{ "Virtual Gamepad" }
+{
+}
+
 void Gamepad::Update()
 {
-	for ( auto& [ btn, button ] : m_mapButtons )
-		button.Reset();
+	m_Buttons.Reset();
 }
 
 void Gamepad::OnBtnPressed( int btn )
 {
-	if ( btn == SCION_GP_BTN_UNKNOWN )
+	if ( !IsValidBtn( btn ) )
 	{
 		SCION_ERROR( "Gamepad button [{}] is unknown!", btn );
 		return;
 	}
 
-	auto btnItr = m_mapButtons.find( btn );
-	if ( btnItr == m_mapButtons.end() )
-	{
-		SCION_ERROR( "Gamepad button [{}] does not exist!", btn );
-		return;
-	}
-
-	btnItr->second.Update( true );
+	m_Buttons.Update( btn, true );
 }
 
 void Gamepad::OnBtnReleased( int btn )
 {
-	if ( btn == SCION_GP_BTN_UNKNOWN )
+	if ( !IsValidBtn( btn ) )
 	{
 		SCION_ERROR( "Gamepad button [{}] is unknown!", btn );
 		return;
 	}
 
-	auto btnItr = m_mapButtons.find( btn );
-	if ( btnItr == m_mapButtons.end() )
-	{
-		SCION_ERROR( "Gamepad button [{}] does not exist!", btn );
-		return;
-	}
-
-	btnItr->second.Update( false );
+	m_Buttons.Update( btn, false );
 }
 
 const bool Gamepad::IsBtnPressed( int btn ) const
 {
-	if ( btn == SCION_GP_BTN_UNKNOWN )
+	if ( !IsValidBtn( btn ) )
 	{
 		SCION_ERROR( "Gamepad button [{}] is unknown!", btn );
 		return false;
 	}
 
-	auto btnItr = m_mapButtons.find( btn );
-	if ( btnItr == m_mapButtons.end() )
-	{
-		SCION_ERROR( "Gamepad button [{}] does not exist!", btn );
-		return false;
-	}
-
-	return btnItr->second.bIsPressed;
+	return m_Buttons.IsPressed( btn );
 }
 
 const bool Gamepad::IsBtnJustPressed( int btn ) const
 {
-	if ( btn == SCION_GP_BTN_UNKNOWN )
+	if ( !IsValidBtn( btn ) )
 	{
 		SCION_ERROR( "Gamepad button [{}] is unknown!", btn );
 		return false;
 	}
 
-	auto btnItr = m_mapButtons.find( btn );
-	if ( btnItr == m_mapButtons.end() )
-	{
-		SCION_ERROR( "Gamepad button [{}] does not exist!", btn );
-		return false;
-	}
-
-	return btnItr->second.bJustPressed;
+	return m_Buttons.IsJustPressed( btn );
 }
 
 const bool Gamepad::IsBtnJustReleased( int btn ) const
 {
-	if ( btn == SCION_GP_BTN_UNKNOWN )
+	if ( !IsValidBtn( btn ) )
 	{
 		SCION_ERROR( "Gamepad button [{}] is unknown!", btn );
 		return false;
 	}
 
-	auto btnItr = m_mapButtons.find( btn );
-	if ( btnItr == m_mapButtons.end() )
-	{
-		SCION_ERROR( "Gamepad button [{}] does not exist!", btn );
-		return false;
-	}
-
-	return btnItr->second.bJustReleased;
+	return m_Buttons.IsJustReleased( btn );
 }
 
 const bool Gamepad::IsGamepadPresent() const
 {
-	return m_pController != nullptr && SDL_NumJoysticks() > 0;
+	// A virtual gamepad is present for as long as it is mapped.
+	if ( IsVirtual() )
+		return true;
+
+	return SDL_NumJoysticks() > 0;
 }
 
 const bool Gamepad::IsRumbleSupported() const
@@ -157,30 +117,31 @@ const bool Gamepad::IsRumbleSupported() const
 
 const Sint16 Gamepad::GetAxisPosition( Uint8 axis )
 {
-	auto axisItr = m_mapAxisValues.find( axis );
-	if ( axisItr == m_mapAxisValues.end() )
+	if ( axis >= NUM_GP_AXES )
 	{
 		SCION_ERROR( "Axis [{}] does not exist!", axis );
 		return 0;
 	}
 
-	return axisItr->second;
+	return m_AxisValues[ axis ];
 }
 
 void Gamepad::SetAxisPositionValue( Uint8 axis, Sint16 value )
 {
-	auto axisItr = m_mapAxisValues.find( axis );
-	if ( axisItr == m_mapAxisValues.end() )
+	if ( axis >= NUM_GP_AXES )
 	{
 		SCION_ERROR( "Axis [{}] does not exist!", axis );
 		return;
 	}
 
-	axisItr->second = value;
+	m_AxisValues[ axis ] = value;
 }
 
 void Gamepad::RumbleController( Uint16 lowFrequencyRumble, Uint16 highFrequencyRumble, Uint32 durationMs )
 {
+	if ( IsVirtual() )
+		return;
+
 	if (SDL_GameControllerRumble(m_pController.get(), lowFrequencyRumble, highFrequencyRumble, durationMs) == -1)
 	{
 		SCION_WARN( "Rumble not supported for controller [{}] - Error: {}", m_InstanceID, SDL_GetError() );
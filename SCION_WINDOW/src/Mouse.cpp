@@ -7,8 +7,7 @@ namespace Scion::Windowing::Inputs
 
 void Mouse::Update()
 {
-	for ( auto& [ btn, button ] : m_mapButtons )
-		button.Reset();
+	m_Buttons.Reset();
 
 	m_WheelX = 0;
 	m_WheelY = 0;
@@ -17,97 +16,64 @@ void Mouse::Update()
 
 void Mouse::OnBtnPressed( int btn )
 {
-	if ( btn == SCION_MOUSE_UNKNOWN )
+	if ( !IsValidBtn( btn ) )
 	{
 		SCION_ERROR( "Mouse Button [{}] is unknown!", btn );
 		return;
 	}
 
-	auto btnItr = m_mapButtons.find( btn );
-	if ( btnItr == m_mapButtons.end() )
-	{
-		SCION_ERROR( "Mouse Button [{}] does not exist!", btn );
-		return;
-	}
-
-	btnItr->second.Update( true );
+	m_Buttons.Update( btn, true );
 }
 
 void Mouse::OnBtnReleased( int btn )
 {
-	if ( btn == SCION_MOUSE_UNKNOWN )
+	if ( !IsValidBtn( btn ) )
 	{
 		SCION_ERROR( "Mouse Button [{}] is unknown!", btn );
 		return;
 	}
 
-	auto btnItr = m_mapButtons.find( btn );
-	if ( btnItr == m_mapButtons.end() )
-	{
-		SCION_ERROR( "Mouse Button [{}] does not exist!", btn );
-		return;
-	}
-
-	btnItr->second.Update( false );
+	m_Buttons.Update( btn, false );
 }
 
 const bool Mouse::IsBtnPressed( int btn ) const
 {
-	if ( btn == SCION_MOUSE_UNKNOWN )
+	if ( !IsValidBtn( btn ) )
 	{
 		SCION_ERROR( "Mouse Button [{}] is unknown!", btn );
 		return false;
 	}
 
-	auto btnItr = m_mapButtons.find( btn );
-	if ( btnItr == m_mapButtons.end() )
-	{
-		SCION_ERROR( "Mouse Button [{}] does not exist!", btn );
-		return false;
-	}
-
-	return btnItr->second.bIsPressed;
+	return m_Buttons.IsPressed( btn );
 }
 
 const bool Mouse::IsBtnJustPressed( int btn ) const
 {
-	if ( btn == SCION_MOUSE_UNKNOWN )
+	if ( !IsValidBtn( btn ) )
 	{
 		SCION_ERROR( "Mouse Button [{}] is unknown!", btn );
 		return false;
 	}
 
-	auto btnItr = m_mapButtons.find( btn );
-	if ( btnItr == m_mapButtons.end() )
-	{
-		SCION_ERROR( "Mouse Button [{}] does not exist!", btn );
-		return false;
-	}
-
-	return btnItr->second.bJustPressed;
+	return m_Buttons.IsJustPressed( btn );
 }
 
 const bool Mouse::IsBtnJustReleased( int btn ) const
 {
-	if ( btn == SCION_MOUSE_UNKNOWN )
+	if ( !IsValidBtn( btn ) )
 	{
 		SCION_ERROR( "Mouse Button [{}] is unknown!", btn );
 		return false;
 	}
 
-	auto btnItr = m_mapButtons.find( btn );
-	if ( btnItr == m_mapButtons.end() )
-	{
-		SCION_ERROR( "Mouse Button [{}] does not exist!", btn );
-		return false;
-	}
-
-	return btnItr->second.bJustReleased;
+	return m_Buttons.IsJustReleased( btn );
 }
 
 const std::tuple<int, int> Mouse::GetMouseScreenPosition()
 {
-	SDL_GetMouseState( &m_X, &m_Y );
+	if ( !m_bPositionOverridden )
+		SDL_GetMouseState( &m_X, &m_Y );
+
 	return std::make_tuple( m_X, m_Y );
 }
 } // namespace Scion::Windowing::Inputs
\ No newline at end of file
@@ -29,6 +29,13 @@ end
 -------------------------------------------------------------------
 CollisionSystem = S2D_Class("CollisionSystem")
 
+-------------------------------------------------------------------
+-- @brief EntityPairEvent types sent through the collision event queue.
+-------------------------------------------------------------------
+CollisionEventType = {
+	Collision = 0,
+	Pickup = 1
+}
 
 -------------------------------------------------------------------
 -- @brief Initializes the collision system.
@@ -37,11 +44,20 @@ CollisionSystem = S2D_Class("CollisionSystem")
 function CollisionSystem:Init(params)
 	params = params or {}
 	
-	self.collisionEventDispatcher = EventDispatcher(DispatcherType.Lua)
-	self.collisionHandler = LuaEventHandler( function(event) self:HandleEvent(event) end )
-	self.pickupHandler = LuaEventHandler( function (event) self:HandlePickups(event) end )
-	self.collisionEventDispatcher:addHandler(self.collisionHandler, LuaEvent)
-	self.collisionEventDispatcher:addHandler(self.pickupHandler, LuaEvent)
+	-- Collisions are sent as pooled EntityPairEvents and handled in one batch per update.
+	self.collisionEventQueue = EventQueue()
+	self.collisionEventQueue:addHandler(EntityPairEvent, 
+		function(events) 
+			for i = 1, events.count do 
+				local event = events:at(i)
+				if event.type == CollisionEventType.Collision then 
+					self:HandleEvent(event)
+				else 
+					self:HandlePickups(event)
+				end
+			end
+		end
+	)
 	self.entitiesToDestroy = {}
 end
 
@@ -70,7 +86,7 @@ function CollisionSystem:UpdateCircleCollision()
 					end
 			
 					if self:Intersect(entity_a, entity_b) then 
-						self.collisionEventDispatcher:emitEvent( LuaEvent( { entityA = entity_a:id(), entityB = entity_b:id() } ))
+						self.collisionEventQueue:enqueuePair( entity_a:id(), entity_b:id(), CollisionEventType.Collision )
 					end
 					
 					::continue::
@@ -78,6 +94,9 @@ function CollisionSystem:UpdateCircleCollision()
 			)
 		end
 	)
+	
+	-- Handle the collisions found this frame
+	self.collisionEventQueue:update()
 		
 	for k, v in pairs(self.entitiesToDestroy) do 
 		local entity = Entity(v.id)
@@ -90,8 +109,8 @@ function CollisionSystem:UpdateCircleCollision()
 		end
 	end
 	
-	-- Handle enqueued events
-	self.collisionEventDispatcher:update()
+	-- Handle enqueued pickup events
+	self.collisionEventQueue:update()
 end
 
 -------------------------------------------------------------------
@@ -136,12 +155,12 @@ end
 
 -------------------------------------------------------------------
 -- @brief Handles collision events between entities.
--- @param event LuaEvent The collision event containing entity IDs.
+-- @param event EntityPairEvent The collision event containing entity IDs.
 -------------------------------------------------------------------
 function CollisionSystem:HandleEvent(event)
 	
-	local entityA = Entity(event.data.entityA)
-	local entityB = Entity(event.data.entityB)
+	local entityA = Entity(event.entityA)
+	local entityB = Entity(event.entityB)
 	local group_a = entityA:group()
 	local group_b = entityB:group()
 	
@@ -188,35 +207,23 @@ function CollisionSystem:HandleEvent(event)
 			CollisionData:Create({ id = entityB:id(), damage = 25 })
 		)
 	elseif name_a == "PlayerShip" and group_b == "pickups" then 
-		self.collisionEventDispatcher:enqueueEvent( 
-			LuaEvent( 
-				{ bIsPickup = true, shipID = entityA:id(), pickupID = entityB:id() } 
-			)
-		)
+		self.collisionEventQueue:enqueuePair( entityA:id(), entityB:id(), CollisionEventType.Pickup )
 	elseif name_b == "PlayerShip" and group_a == "pickups" then 
-		self.collisionEventDispatcher:enqueueEvent( 
-			LuaEvent( 
-				{ bIsPickup = true, shipID = entityB:id(), pickupID = entityA:id() } 
-			)
-		)
+		self.collisionEventQueue:enqueuePair( entityB:id(), entityA:id(), CollisionEventType.Pickup )
 	end
 end
 
 -------------------------------------------------------------------
 -- @brief Handles pickup collision events.
--- @param event LuaEvent Event containing ship and pickup IDs.
+-- @param event EntityPairEvent Event containing the ship (entityA) and pickup (entityB) IDs.
 -------------------------------------------------------------------
 function CollisionSystem:HandlePickups(event)
-	if not event.data.bIsPickup then 
-		return 
-	end 
-	
-	local ship = gShipHandler:GetShipByID(event.data.shipID)
+	local ship = gShipHandler:GetShipByID(event.entityA)
 	if not ship then 
 		S2D_warn("Failed to handle pickup. Ship is not valid")
 		return 
 	end 
 	
-	gPickupHandler:OnHandlePickup(event.data.pickupID, ship)
+	gPickupHandler:OnHandlePickup(event.entityB, ship)
 end
 
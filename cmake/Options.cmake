@@ -17,3 +17,8 @@ if(SCION_OPENGL_FORCE_DISCRETE_GPU)
 	add_compile_definitions(SCION_OPENGL_FORCE_DISCRETE_GPU)
 	message ( "Scion engine will attempt to force discrete GPU on optimus laptops." )
 endif()
+
+if(SCION_PROFILER)
+	add_compile_definitions($<$<NOT:$<CONFIG:Release>>:SCION_PROFILER>)
+	message ( "Scion engine will be built with profiler zones in non release builds." )
+endif()